@@ -1,5 +1,94 @@
 #include "array.h"
 #include "debug.h"
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+// Fast conversion of an array to GLfloat, for the common cases
+// every element get "width" components, multiplied by scale, then padded up to to_width
+// with 0, except the last one that get "last"
+// return false if the case is not handled, and the generic code must be used
+static bool fast_float_array(uintptr_t in, GLenum from, GLsizei width, GLsizei stride,
+                              GLsizei to_width, GLsizei n, GLfloat *out, GLfloat scale, GLfloat last) {
+    if (width<1 || to_width>4 || width>to_width)
+        return false;
+    GLfloat pad[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+    pad[to_width-1] = last;
+    // full 4 components to 4 floats, the most common case for vertex, colors and texcoords
+    if (width==4 && to_width==4) {
+        switch (from) {
+            case GL_FLOAT:
+                if (scale!=1.0f)
+                    break;
+                for (int i=0; i<n; i++, in+=stride, out+=4) {
+#if defined(__ARM_NEON__)
+                    vst1q_f32(out, vld1q_f32((const GLfloat*)in));
+#elif defined(__SSE2__)
+                    _mm_storeu_ps(out, _mm_loadu_ps((const GLfloat*)in));
+#else
+                    const GLfloat *src = (const GLfloat*)in;
+                    out[0] = src[0]; out[1] = src[1]; out[2] = src[2]; out[3] = src[3];
+#endif
+                }
+                return true;
+            case GL_UNSIGNED_BYTE:
+                for (int i=0; i<n; i++, in+=stride, out+=4) {
+#if defined(__ARM_NEON__)
+                    uint32_t v;
+                    memcpy(&v, (const void*)in, 4);
+                    uint32x4_t w = vmovl_u16(vget_low_u16(vmovl_u8(vreinterpret_u8_u32(vdup_n_u32(v)))));
+                    vst1q_f32(out, vmulq_n_f32(vcvtq_f32_u32(w), scale));
+#elif defined(__SSE2__)
+                    int v;
+                    memcpy(&v, (const void*)in, 4);
+                    const __m128i zero = _mm_setzero_si128();
+                    __m128i w = _mm_unpacklo_epi16(_mm_unpacklo_epi8(_mm_cvtsi32_si128(v), zero), zero);
+                    _mm_storeu_ps(out, _mm_mul_ps(_mm_cvtepi32_ps(w), _mm_set1_ps(scale)));
+#else
+                    const GLubyte *src = (const GLubyte*)in;
+                    out[0] = src[0]*scale; out[1] = src[1]*scale; out[2] = src[2]*scale; out[3] = src[3]*scale;
+#endif
+                }
+                return true;
+            case GL_SHORT:
+                for (int i=0; i<n; i++, in+=stride, out+=4) {
+#if defined(__ARM_NEON__)
+                    int16_t v[4];
+                    memcpy(v, (const void*)in, 8);
+                    vst1q_f32(out, vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vld1_s16(v))), scale));
+#elif defined(__SSE2__)
+                    __m128i w = _mm_loadl_epi64((const __m128i*)in);
+                    w = _mm_srai_epi32(_mm_unpacklo_epi16(w, w), 16);
+                    _mm_storeu_ps(out, _mm_mul_ps(_mm_cvtepi32_ps(w), _mm_set1_ps(scale)));
+#else
+                    const GLshort *src = (const GLshort*)in;
+                    out[0] = src[0]*scale; out[1] = src[1]*scale; out[2] = src[2]*scale; out[3] = src[3]*scale;
+#endif
+                }
+                return true;
+        }
+    }
+    // other widths, with short inner loops (width and to_width are 4 at most)
+    #define GO(T) { \
+        for (int i=0; i<n; i++, in+=stride, out+=to_width) { \
+            const T *src = (const T*)in; \
+            for (int j=0; j<width; j++) \
+                out[j] = src[j]*scale; \
+            for (int j=width; j<to_width; j++) \
+                out[j] = pad[j]; \
+        } \
+        return true; }
+    switch (from) {
+        case GL_FLOAT: GO(GLfloat);
+        case GL_DOUBLE: GO(GLdouble);
+        case GL_BYTE: GO(GLbyte);
+        case GL_UNSIGNED_BYTE: GO(GLubyte);
+        case GL_SHORT: GO(GLshort);
+        case GL_UNSIGNED_SHORT: GO(GLushort);
+    }
+    #undef GO
+    return false;
+}
 
 GLvoid *copy_gl_array(const GLvoid *src,
                       GLenum from, GLsizei width, GLsizei stride,
@@ -23,6 +112,8 @@ GLvoid *copy_gl_array(const GLvoid *src,
     // so we leave it in a uintptr_t and cast after incrementing
     uintptr_t in = (uintptr_t)src;
     in += stride*skip;
+    if (to == GL_FLOAT && fast_float_array(in, from, width, stride, to_width, count-skip, (GLfloat*)dst, 1.0f, 0.0f))
+        return dst;
     if (from == to && to_width >= width) {
         GL_TYPE_SWITCH(out, dst, to,
             for (int i = skip; i < count; i++) {
@@ -87,6 +178,8 @@ GLvoid *copy_gl_array_texcoord(const GLvoid *src,
     // so we leave it in a uintptr_t and cast after incrementing
     uintptr_t in = (uintptr_t)src;
     in += stride*skip;
+    if (to == GL_FLOAT && fast_float_array(in, from, width, stride, to_width, count-skip, (GLfloat*)dst, 1.0f, *(GLfloat*)filler))
+        return dst;
     if (from == to && to_width >= width) {
         GL_TYPE_SWITCH(out, dst, to,
             for (int i = skip; i < count; i++) {
@@ -146,6 +239,8 @@ GLvoid *copy_gl_array_quickconvert(const GLvoid *src,
     uintptr_t in = (uintptr_t)src;
     in += stride*skip;
     int j;
+    if (fast_float_array(in, from, 4, stride, 4, count-skip, (GLfloat*)dst, 1.0f/gl_max_value(from), 0.0f))
+        return dst;
     
     GLfloat *out = (GLfloat*)dst;
     GL_TYPE_SWITCH2(input, in, from,
@@ -190,6 +285,8 @@ GLvoid *copy_gl_array_convert(const GLvoid *src,
     uintptr_t in = (uintptr_t)src;
     in += stride*skip;
     int j;
+    if (to == GL_FLOAT && fast_float_array(in, from, width, stride, to_width, count-skip, (GLfloat*)dst, (from==GL_FLOAT)?1.0f:1.0f/gl_max_value(from), *(GLfloat*)filler))
+        return dst;
     if (from == to && to_width >= width) {
         GL_TYPE_SWITCH(out, dst, to,
             for (int i = skip; i < count; i++) {
@@ -54,6 +54,51 @@ int buffer_target(GLenum target) {
 	return 0;
 }
 
+void buffer_minmax_indices(glbuffer_t *buff, const GLvoid *indices, GLenum type, GLsizei count, GLsizei *max, GLsizei *min) {
+    // min/max of count indices of type. If buff is not NULL, indices is an offset inside buff
+    // and the result is cached in buff, so static element buffers are scanned only once
+    const GLvoid *data = indices;
+    if (buff) {
+        for (int i=0; i<buff->nranges; i++) {
+            buffer_range_t *r = &buff->ranges[i];
+            if (r->offset==(uintptr_t)indices && r->count==count && r->type==type) {
+                *max = r->max;
+                *min = r->min;
+                return;
+            }
+        }
+        data = (const char*)buff->data + (uintptr_t)indices;
+    }
+    *max = 0;
+    *min = 0;
+    if (count) {
+        #define GO(T) \
+            { const T *p = (const T*)data; \
+              *max = *min = p[0]; \
+              for (int i=1; i<count; i++) { if (p[i]>*max) *max = p[i]; if (p[i]<*min) *min = p[i]; } }
+        switch (type) {
+            case GL_UNSIGNED_BYTE: GO(GLubyte); break;
+            case GL_UNSIGNED_SHORT: GO(GLushort); break;
+            case GL_UNSIGNED_INT: GO(GLuint); break;
+        }
+        #undef GO
+    }
+    if (buff) {
+        buffer_range_t *r;
+        if (buff->nranges<BUFFER_RANGES)
+            r = &buff->ranges[buff->nranges++];
+        else {
+            r = &buff->ranges[buff->lastrange];
+            buff->lastrange = (buff->lastrange+1)%BUFFER_RANGES;
+        }
+        r->offset = (uintptr_t)indices;
+        r->count = count;
+        r->type = type;
+        r->max = *max;
+        r->min = *min;
+    }
+}
+
 void glshim_glGenBuffers(GLsizei n, GLuint * buffers) {
 //printf("glGenBuffers(%i, %p)\n", n, buffers);
 	noerrorShim();
@@ -103,6 +148,8 @@ void glshim_glBindBuffer(GLenum target, GLuint buffer) {
             buff->size = 0;
             buff->access = GL_READ_WRITE;
             buff->mapped = 0;
+            buff->nranges = 0;
+            buff->lastrange = 0;
         } else {
             buff = kh_value(list, k);
         }
@@ -130,6 +177,7 @@ void glshim_glBufferData(GLenum target, GLsizeiptr size, const GLvoid * data, GL
     buff->usage = usage;
     buff->data = malloc(size);
     buff->access = GL_READ_WRITE;
+    buff->nranges = 0;
     if (data)
         memcpy(buff->data, data, size);
     noerrorShim();
@@ -148,6 +196,7 @@ void glshim_glBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, con
         return;
     }
     memcpy(buff->data + offset, data, size);    //TODO, some check maybe?
+    buff->nranges = 0;
     noerrorShim();
 }
 
@@ -252,6 +301,8 @@ void *glshim_glMapBuffer(GLenum target, GLenum access) {
 		return (void*)NULL;		// Should generate an error!
 	buff->access = access;	// not used
 	buff->mapped = 1;
+	if (access!=GL_READ_ONLY)
+		buff->nranges = 0;
 	noerrorShim();
 	return buff->data;		// Not nice, should do some copy or something probably
 }
@@ -4,6 +4,14 @@
 #define GL_BUFFERS_H
 
 // VBO *****************
+#define BUFFER_RANGES 4
+typedef struct {
+    GLintptr    offset;
+    GLsizei     count;
+    GLenum      type;
+    GLsizei     min, max;
+} buffer_range_t;
+
 typedef struct {
     GLuint      buffer;
     GLenum      type;
@@ -12,10 +20,16 @@ typedef struct {
     GLint		access;
     int			mapped;
     GLvoid     *data;
+    // min/max of the last index ranges drawn, valid until the data change
+    buffer_range_t ranges[BUFFER_RANGES];
+    int         nranges;
+    int         lastrange;
 } glbuffer_t;
 
 KHASH_MAP_INIT_INT(buff, glbuffer_t *)
 
+void buffer_minmax_indices(glbuffer_t *buff, const GLvoid *indices, GLenum type, GLsizei count, GLsizei *max, GLsizei *min);
+
 void glshim_glGenBuffers(GLsizei n, GLuint * buffers);
 void glshim_glBindBuffer(GLenum target, GLuint buffer);
 void glshim_glBufferData(GLenum target, GLsizeiptr size, const GLvoid * data, GLenum usage);
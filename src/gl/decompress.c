@@ -1,5 +1,11 @@
 #include <stdint.h>
 #include <stddef.h>
+#include <string.h>
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include "decompress.h"
 
 /*
 DXT1/DXT3/DXT5 texture decompression
@@ -315,6 +321,188 @@ void DecompressBlockDXT3(uint32_t x, uint32_t y, uint32_t width,
 		image + x + (y * width), width, alphaValues);
 }
 
+/*
+Whole images: DecompressDXT() decodes rows of blocks, computing the palette of
+each block once (the 1/3 and 2/3 mixes with SIMD when available), then looking
+up the 16 pixels, directly in the output format and clipped to the image.
+*/
+
+// 8 bits channels of a 565 color, rounded as in DecompressBlockDXT1Internal
+static void Expand565(uint16_t color, uint16_t* rgba)
+{
+	uint32_t temp;
+
+	temp = (color >> 11) * 255 + 16;
+	rgba[0] = (temp/32 + temp)/32;
+	temp = ((color & 0x07E0) >> 5) * 255 + 32;
+	rgba[1] = (temp/64 + temp)/64;
+	temp = (color & 0x001F) * 255 + 16;
+	rgba[2] = (temp/32 + temp)/32;
+	rgba[3] = 255;
+}
+
+// the 4 RGBA colors of a color block; DXT1 blocks can be in 3 colors mode, alpha3
+// is then the alpha of the 4th color (DXT3 and DXT5 blocks are always in 4 colors mode)
+static void BlockPalette(const uint8_t* block, int dxt1, uint8_t alpha3, uint8_t* palette)
+{
+	uint16_t color0 = block[0] | (block[1] << 8);
+	uint16_t color1 = block[2] | (block[3] << 8);
+	int four = !dxt1 || (color0 > color1);
+	uint16_t c[8];
+
+	Expand565(color0, c);
+	Expand565(color1, c + 4);
+#if defined(__ARM_NEON__)
+	uint16x8_t v = vld1q_u16(c);
+	uint16x8_t w = vcombine_u16(vget_high_u16(v), vget_low_u16(v));
+	uint16x8_t mix;
+	if (four) {
+		// x/3 is (x*21846)>>16 for x < 768
+		mix = vaddq_u16(vaddq_u16(v, v), w);
+		mix = vcombine_u16(vshrn_n_u32(vmull_n_u16(vget_low_u16(mix), 21846), 16),
+		                   vshrn_n_u32(vmull_n_u16(vget_high_u16(mix), 21846), 16));
+	} else {
+		mix = vshrq_n_u16(vaddq_u16(v, w), 1);
+		mix = vcombine_u16(vget_low_u16(mix), vcreate_u16((uint64_t)alpha3 << 48));
+	}
+	vst1_u8(palette, vmovn_u16(v));
+	vst1_u8(palette + 8, vmovn_u16(mix));
+#elif defined(__SSE2__)
+	__m128i v = _mm_loadu_si128((const __m128i*)c);
+	__m128i w = _mm_shuffle_epi32(v, _MM_SHUFFLE(1, 0, 3, 2));
+	__m128i mix;
+	if (four) {
+		// x/3 is (x*21846)>>16 for x < 768
+		mix = _mm_add_epi16(_mm_add_epi16(v, v), w);
+		mix = _mm_mulhi_epu16(mix, _mm_set1_epi16(21846));
+	} else {
+		mix = _mm_srli_epi16(_mm_add_epi16(v, w), 1);
+		mix = _mm_insert_epi16(_mm_move_epi64(mix), alpha3, 7);
+	}
+	_mm_storeu_si128((__m128i*)palette, _mm_packus_epi16(v, mix));
+#else
+	int i;
+
+	for (i = 0; i < 4; ++i) {
+		palette[i] = c[i];
+		palette[4 + i] = c[4 + i];
+		if (four) {
+			palette[8 + i] = (2*c[i] + c[4 + i])/3;
+			palette[12 + i] = (c[i] + 2*c[4 + i])/3;
+		} else {
+			palette[8 + i] = (c[i] + c[4 + i])/2;
+			palette[12 + i] = 0;
+		}
+	}
+	if (!four)
+		palette[15] = alpha3;
+#endif
+}
+
+// the 16 alpha values of a DXT3 or DXT5 alpha block
+static void BlockAlpha(GLenum format, const uint8_t* block, uint8_t* alpha)
+{
+	int i;
+
+	if (format == GL_COMPRESSED_RGBA_S3TC_DXT3_EXT) {
+		for (i = 0; i < 16; ++i)
+			alpha[i] = ((block[i/2] >> (4*(i & 1))) & 0xF) * 17;
+	} else {
+		uint8_t values[8];
+		uint64_t bits = 0;
+		uint8_t alpha0 = block[0], alpha1 = block[1];
+
+		values[0] = alpha0;
+		values[1] = alpha1;
+		if (alpha0 > alpha1) {
+			for (i = 2; i < 8; ++i)
+				values[i] = ((8-i)*alpha0 + (i-1)*alpha1)/7;
+		} else {
+			for (i = 2; i < 6; ++i)
+				values[i] = ((6-i)*alpha0 + (i-1)*alpha1)/5;
+			values[6] = 0;
+			values[7] = 255;
+		}
+		for (i = 7; i >= 2; --i)
+			bits = (bits << 8) | block[i];
+		for (i = 0; i < 16; ++i)
+			alpha[i] = values[(bits >> 3*i) & 0x07];
+	}
+}
+
+static void DecompressBlock(GLenum format, const uint8_t* block, GLenum type,
+	uint8_t* output, uint32_t stride, uint32_t w, uint32_t h)
+{
+	uint8_t palette[16], alpha[16];
+	uint16_t palette16[4];
+	const uint8_t* color = block;
+	int has_alpha = (format == GL_COMPRESSED_RGBA_S3TC_DXT3_EXT || format == GL_COMPRESSED_RGBA_S3TC_DXT5_EXT);
+	uint32_t code, i, j;
+
+	if (has_alpha) {
+		BlockAlpha(format, block, alpha);
+		color += 8;
+	}
+	// the 4th color of a 3 colors DXT1 block is transparent for RGBA
+	BlockPalette(color, !has_alpha, (format == GL_COMPRESSED_RGBA_S3TC_DXT1_EXT) ? 0 : 255, palette);
+	code = color[4] | (color[5] << 8) | (color[6] << 16) | ((uint32_t)color[7] << 24);
+
+	for (i = 0; i < 4; ++i) {
+		const uint8_t* p = palette + 4*i;
+		if (type == GL_UNSIGNED_SHORT_5_6_5)
+			palette16[i] = ((p[0] & 0xf8) << 8) | ((p[1] & 0xfc) << 3) | (p[2] >> 3);
+		else if (type == GL_UNSIGNED_SHORT_4_4_4_4)
+			palette16[i] = ((p[0] & 0xf0) << 8) | ((p[1] & 0xf0) << 4) | (p[2] & 0xf0) | (p[3] >> 4);
+	}
+
+	for (j = 0; j < h; ++j, output += stride) {
+		for (i = 0; i < w; ++i) {
+			uint32_t k = 4*j + i;
+			uint32_t index = (code >> 2*k) & 0x03;
+			switch (type) {
+			case GL_UNSIGNED_SHORT_5_6_5:
+				((uint16_t*)output)[i] = palette16[index];
+				break;
+			case GL_UNSIGNED_SHORT_4_4_4_4:
+				((uint16_t*)output)[i] = has_alpha ? ((palette16[index] & 0xfff0) | (alpha[k] >> 4)) : palette16[index];
+				break;
+			default:
+				memcpy(output + 4*i, palette + 4*index, 4);
+				if (has_alpha)
+					output[4*i + 3] = alpha[k];
+				break;
+			}
+		}
+	}
+}
+
+/*
+void DecompressDXT(): Decompresses the rows of blocks [start, end) of a DXT1/DXT3/DXT5 texture.
+
+GLenum format:					compressed format of the texture.
+const uint8_t *blockStorage:	pointer to the first block of the texture.
+uint32_t width, height:			size of the texture, in pixels.
+GLenum type:					GL_UNSIGNED_BYTE for RGBA, GL_UNSIGNED_SHORT_5_6_5 or GL_UNSIGNED_SHORT_4_4_4_4.
+void *image:					pointer to the (whole) decompressed image, rows of width pixels.
+*/
+void DecompressDXT(GLenum format, const uint8_t* blockStorage, uint32_t width, uint32_t height,
+	uint32_t start, uint32_t end, GLenum type, void* image)
+{
+	uint32_t blocksize = (format == GL_COMPRESSED_RGB_S3TC_DXT1_EXT || format == GL_COMPRESSED_RGBA_S3TC_DXT1_EXT) ? 8 : 16;
+	uint32_t pixelsize = (type == GL_UNSIGNED_BYTE) ? 4 : 2;
+	uint32_t blocks = (width + 3)/4;
+	uint32_t x, y;
+
+	blockStorage += start * blocks * blocksize;
+	for (y = start; y < end; ++y) {
+		uint8_t* output = (uint8_t*)image + 4*y * width * pixelsize;
+		uint32_t h = (height - 4*y < 4) ? height - 4*y : 4;
+		for (x = 0; x < width; x += 4, blockStorage += blocksize)
+			DecompressBlock(format, blockStorage, type, output + x * pixelsize, width * pixelsize,
+				(width - x < 4) ? width - x : 4, h);
+	}
+}
+
 // Texture DXT1 / DXT5 compression
 // Using STB "on file" library
 // go there https://github.com/nothings/stb
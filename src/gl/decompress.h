@@ -14,6 +14,9 @@ void DecompressBlockDXT3(uint32_t x, uint32_t y, uint32_t width,
 void DecompressBlockDXT5(uint32_t x, uint32_t y, uint32_t width,
 	const uint8_t* blockStorage, uint32_t* image);
 
+// rows of blocks [start, end) of a whole image, to RGBA (GL_UNSIGNED_BYTE), RGB565 or RGBA4444
+void DecompressDXT(GLenum format, const uint8_t* blockStorage, uint32_t width, uint32_t height,
+	uint32_t start, uint32_t end, GLenum type, void* image);
 
 
 #endif
\ No newline at end of file
@@ -0,0 +1,77 @@
+#include "framealloc.h"
+
+#define FRAME_BLOCK_SIZE (1024*1024)
+#define FRAME_MAX_SIZE (64*1024*1024)
+
+typedef struct frame_block_s {
+    struct frame_block_s *next;
+    size_t size;
+    size_t used;
+    char *data;
+} frame_block_t;
+
+static frame_block_t *first = NULL;
+static frame_block_t *current = NULL;
+static size_t total = 0;
+static int users = 0;      // number of live objects using the pool
+
+void *frame_alloc(size_t size) {
+    // return NULL if the pool is full, caller should use malloc then
+    size = (size+15)&~15;
+    while (current && current->used+size > current->size)
+        current = current->next;
+    if (!current) {
+        size_t bsize = (size>FRAME_BLOCK_SIZE)?size:FRAME_BLOCK_SIZE;
+        if (total+bsize > FRAME_MAX_SIZE)
+            return NULL;
+        frame_block_t *block = (frame_block_t*)malloc(sizeof(frame_block_t));
+        block->data = (char*)malloc(bsize);
+        block->size = bsize;
+        block->used = 0;
+        block->next = NULL;
+        total += bsize;
+        // append at the end, so blocks are used in order after a reset
+        if (!first)
+            first = block;
+        else {
+            frame_block_t *last = first;
+            while (last->next) last = last->next;
+            last->next = block;
+        }
+        current = block;
+    }
+    void *ret = current->data+current->used;
+    current->used += size;
+    return ret;
+}
+
+int frame_owns(const void *p) {
+    for (frame_block_t *block = first; block; block = block->next)
+        if ((const char*)p>=block->data && (const char*)p<block->data+block->size)
+            return 1;
+    return 0;
+}
+
+void frame_free(void *p) {
+    // pool memory is only released by frame_reset
+    if (p && !frame_owns(p))
+        free(p);
+}
+
+void frame_ref() {
+    users++;
+}
+
+void frame_unref() {
+    users--;
+}
+
+int frame_reset() {
+    // only possible if nothing use the pool anymore
+    if (users)
+        return 0;
+    for (frame_block_t *block = first; block; block = block->next)
+        block->used = 0;
+    current = first;
+    return 1;
+}
@@ -0,0 +1,16 @@
+#include "gl.h"
+
+#ifndef GL_FRAMEALLOC_H
+#define GL_FRAMEALLOC_H
+
+// Per-frame pool for batch mode renderlists: allocations are just a pointer bump
+// and everything is released at once at the end of the frame (glXSwapBuffers)
+
+void *frame_alloc(size_t size);
+void frame_free(void *p);
+int frame_owns(const void *p);
+void frame_ref();
+void frame_unref();
+int frame_reset();
+
+#endif
@@ -198,6 +198,9 @@ void glshim_glFramebufferTexture2D(GLenum target, GLenum attachment, GLenum text
         } else {
             tex = kh_value(list, k);
             texture = tex->glname;
+            // rendered to, the copy of the texture is not updated anymore
+            texdirty_remove(tex, 1);
+            tex->shadow = false;
             // check if texture is shrinked...
             if (tex->shrink) {
                 printf("LIBGL: unshrinking shrinked texture for FBO\n");
@@ -417,6 +420,7 @@ GLboolean glshim_glIsRenderbuffer(GLuint renderbuffer) {
 void glshim_glGenerateMipmap(GLenum target) {
     //printf("glGenerateMipmap(0x%04X)\n", target);
     LOAD_GLES_OES(glGenerateMipmap);
+    texdirty_sync();
     
     errorGL();
     return gles_glGenerateMipmap(target);
@@ -1,5 +1,7 @@
 #include "gl.h"
 #include "debug.h"
+#include "framealloc.h"
+#include <sys/time.h>
 /*
 glstate_t state = {.color = {1.0f, 1.0f, 1.0f, 1.0f},
 	.secondary = {0.0f, 0.0f, 0.0f, 0.0f},
@@ -29,6 +31,20 @@ GLfloat readhack_depth = 0.0f;
 GLuint readhack_seq = 0;
 GLuint gl_batch = 0;
 GLuint gl_mergelist = 1;
+GLuint gl_listvbo = 1;
+GLuint gl_listopt = 1;
+GLuint gl_flatlists = 0;
+GLuint gl_listmem = 0;
+GLuint gl_texthreads = 0;       // threads for texture conversions (0 = one per CPU)
+GLuint gl_batchalloc = 1;
+GLuint gl_statefilter = 1;
+GLuint gl_batchsort = 0;
+GLuint gl_mergemax = 30000;     // max vertices (and indices) of merged renderlists
+GLuint gl_batchdirect = 0;      // draws of that many vertices skip the batch (0 = never)
+GLuint gl_batchshare = 256;     // compiled lists of that many vertices are not copied in the batch (0 = never)
+GLuint gl_batchadaptive = 0;
+GLuint gl_batchstats = 0;
+batchstats_t batchstats;
 int blendhack = 0;
 int export_blendcolor = 0;
 char glshim_version[50];
@@ -68,6 +84,8 @@ void initialize_glshim() {
         buff->size = 0;
         buff->access = GL_READ_WRITE;
         buff->mapped = 0;
+        buff->nranges = 0;
+        buff->lastrange = 0;
         glstate.defaultvbo = buff;
     }
     // add default VAO
@@ -99,20 +117,86 @@ void initialize_glshim() {
         readhack = 2;
         printf("LIBGL: glReadPixel Depth Hack (for games that read GLDepth always at the same place, same 1x1 size)\n");
     }
+    // LIBGL_BATCH is "mode[,option...]"
     char *env_batch = getenv("LIBGL_BATCH");
-    if (env_batch && strcmp(env_batch, "1") == 0) {
+    char batch_mode[8] = "";
+    if (env_batch && strcspn(env_batch, ",") < sizeof(batch_mode)) {
+        memcpy(batch_mode, env_batch, strcspn(env_batch, ","));
+        batch_mode[strcspn(env_batch, ",")] = '\0';
+    }
+    if (strcmp(batch_mode, "1") == 0) {
         gl_batch = 1;
         printf("LIBGL: Batch mode enabled\n");
     }
-    if (env_batch && strcmp(env_batch, "0") == 0) {
+    if (strcmp(batch_mode, "0") == 0) {
         gl_batch = 0;
         printf("LIBGL: Batch mode disabled\n");
     }
-    if (env_batch && strcmp(env_batch, "2") == 0) {
+    if (strcmp(batch_mode, "2") == 0) {
         gl_batch = 0;
         gl_mergelist = 0;
         printf("LIBGL: Batch mode disabled, merging of list disabled too\n");
     }
+    for (char *opt = (env_batch)?strchr(env_batch, ','):NULL; opt; opt = strchr(opt+1, ',')) {
+        if (sscanf(opt, ",max=%u", &gl_mergemax) == 1) {
+            if (gl_mergemax < 64) gl_mergemax = 64;
+            if (gl_mergemax > 65535) gl_mergemax = 65535;  // indices are 16 bits
+            printf("LIBGL: Merged lists limited to %u vertices\n", gl_mergemax);
+        } else if (sscanf(opt, ",direct=%u", &gl_batchdirect) == 1) {
+            printf("LIBGL: Draws of %u vertices or more are not batched\n", gl_batchdirect);
+        } else if (sscanf(opt, ",share=%u", &gl_batchshare) == 1) {
+            printf("LIBGL: Display lists of %u vertices or more are not copied in the batch\n", gl_batchshare);
+        } else if (strncmp(opt, ",adaptive", 9) == 0) {
+            gl_batchadaptive = 1;
+            printf("LIBGL: Merge limit of batch mode adjusted at runtime\n");
+        } else if (strncmp(opt, ",stats", 6) == 0) {
+            gl_batchstats = 1;
+            printf("LIBGL: Batch mode statistics enabled\n");
+        }
+    }
+    char *env_listvbo = getenv("LIBGL_LISTVBO");
+    if (env_listvbo && strcmp(env_listvbo, "0") == 0) {
+        gl_listvbo = 0;
+        printf("LIBGL: VBO for Display list disabled\n");
+    }
+    char *env_listopt = getenv("LIBGL_LISTOPT");
+    if (env_listopt && strcmp(env_listopt, "0") == 0) {
+        gl_listopt = 0;
+        printf("LIBGL: Display list optimizer disabled\n");
+    }
+    char *env_flatlists = getenv("LIBGL_FLATLISTS");
+    if (env_flatlists && strcmp(env_flatlists, "1") == 0) {
+        gl_flatlists = 1;
+        printf("LIBGL: glCallLists flattening enabled\n");
+    }
+    char *env_listmem = getenv("LIBGL_LISTMEM");
+    if (env_listmem && strcmp(env_listmem, "1") == 0) {
+        gl_listmem = 1;
+        printf("LIBGL: Display lists memory report enabled\n");
+    }
+    char *env_texthreads = getenv("LIBGL_TEXTHREADS");
+    if (env_texthreads && sscanf(env_texthreads, "%u", &gl_texthreads) == 1 && gl_texthreads) {
+        printf("LIBGL: Texture conversions use %u threads\n", gl_texthreads);
+    }
+    char *env_batchalloc = getenv("LIBGL_BATCHALLOC");
+    if (env_batchalloc && strcmp(env_batchalloc, "0") == 0) {
+        gl_batchalloc = 0;
+        printf("LIBGL: Per-frame allocator for batch mode disabled\n");
+    }
+    char *env_batchsort = getenv("LIBGL_BATCHSORT");
+    if (env_batchsort && strcmp(env_batchsort, "1") == 0) {
+        gl_batchsort = 1;
+        printf("LIBGL: Batch mode draws are grouped by texture when possible\n");
+    }
+    char *env_statefilter = getenv("LIBGL_STATEFILTER");
+    if (env_statefilter && strcmp(env_statefilter, "0") == 0) {
+        gl_statefilter = 0;
+        printf("LIBGL: Redundant state filter disabled\n");
+    }
+    if (env_statefilter && strcmp(env_statefilter, "2") == 0) {
+        gl_statefilter = 2;
+        printf("LIBGL: Redundant state filter enabled, with statistics\n");
+    }
     
     if (gl_batch) init_batch();
     glstate.gl_batch = gl_batch;
@@ -642,8 +726,96 @@ GLboolean glshim_glIsEnabled(GLenum cap) {
 #undef clientisenabled
 GLboolean glIsEnabled(GLenum cap) AliasExport("glshim_glIsEnabled");
 
+// glLockArrays keeps the arrays in the arena of glstate.list.lockedlist, indexed from lockedfirst.
+// Each one is converted on its first use, then the draws of the locked range share them
+typedef GLvoid *(*copy_pointer_t)(pointer_state_t *ptr, GLsizei width, GLsizei skip, GLsizei count, glbuffer_t *buff);
+
+#define locked_valid(A, I) \
+    locked_unchanged(&glstate.vao->pointers.A, &glstate.list.lockedpointers.A, I)
+#define locked_array(A, B, C, I, F) \
+    locked_pointer(&glstate.vao->pointers.A, &glstate.list.lockedpointers.A, I, &glstate.list.lockedlist->B, C, F)
+static bool locked_unchanged(pointer_state_t *p, pointer_state_t *lp, int slot) {
+    // the array was enabled at glLockArrays time, and its pointer is the same
+    if (!glstate.list.locked || !glstate.list.lockedslots[slot])
+        return false;
+    return !(p->pointer!=lp->pointer || p->buffer!=lp->buffer || p->type!=lp->type || p->size!=lp->size || p->stride!=lp->stride);
+}
+
+static GLfloat *locked_pointer(pointer_state_t *p, pointer_state_t *lp, int slot, GLfloat **array, int size, copy_pointer_t copy) {
+    // the converted array, or NULL if it changed since glLockArrays
+    if (!locked_unchanged(p, lp, slot))
+        return NULL;
+    if (!*array) {
+        GLsizei first = glstate.list.lockedfirst, count = glstate.list.lockedcount;
+        GLfloat *tmp = (GLfloat*)copy(p, size, first, first+count, p->buffer);
+        memcpy(glstate.list.lockedslots[slot], tmp, count*size*sizeof(GLfloat));
+        free(tmp);
+        *array = glstate.list.lockedslots[slot];
+    }
+    return *array;
+}
+
+static inline bool locked_range(GLsizei skip, GLsizei count) {
+    return (glstate.list.locked && skip>=glstate.list.lockedfirst && count<=glstate.list.lockedfirst+glstate.list.lockedcount);
+}
+
+static GLfloat *locked_finalcolors() {
+    // color + secondary
+    GLfloat *color = locked_array(color, color, 4, 2, copy_gl_pointer_color);
+    GLfloat *secondary = locked_array(secondary, secondary, 4, 3, copy_gl_pointer);
+    if (!color || !secondary)
+        return NULL;
+    if (!glstate.list.lockedcolors) {
+        GLsizei count = glstate.list.lockedcount;
+        glstate.list.lockedcolors = (GLfloat*)malloc(count*4*sizeof(GLfloat));
+        for (int i=0; i<count*4; i++)
+            glstate.list.lockedcolors[i] = color[i] + secondary[i];
+    }
+    return glstate.list.lockedcolors;
+}
+
+static bool locked_share(renderlist_t *list) {
+    // make list use the locked arrays: all its arrays must be there, and its tex_coord
+    // must not be changed by end_renderlist
+    if (glstate.vao->vertex_array && !locked_valid(vertex, 0))
+        return false;
+    if (glstate.vao->normal_array && !locked_valid(normal, 1))
+        return false;
+    if (glstate.vao->color_array && !locked_valid(color, 2))
+        return false;
+    if (glstate.vao->secondary_array && !locked_valid(secondary, 3))
+        return false;
+    for (int i=0; i<MAX_TEX; i++)
+        if (glstate.vao->tex_coord_array[i] && (!locked_valid(tex_coord[i], 4+i) || isadjusted_renderlist(list, i)))
+            return false;
+    if (glstate.vao->vertex_array)
+        list->vert = locked_array(vertex, vert, 4, 0, copy_gl_pointer_tex);
+    if (glstate.vao->normal_array)
+        list->normal = locked_array(normal, normal, 3, 1, copy_gl_pointer_raw);
+    if (glstate.vao->color_array)
+        list->color = locked_array(color, color, 4, 2, copy_gl_pointer_color);
+    if (glstate.vao->secondary_array)
+        list->secondary = locked_array(secondary, secondary, 4, 3, copy_gl_pointer);
+    for (int i=0; i<MAX_TEX; i++)
+        if (glstate.vao->tex_coord_array[i])
+            list->tex[i] = locked_array(tex_coord[i], tex[i], 4, 4+i, copy_gl_pointer_tex);
+    // the last owner frees the arena
+    renderlist_t *locked = glstate.list.lockedlist;
+    if (!locked->shared_arrays) {
+        locked->shared_arrays = (int*)malloc(sizeof(int));
+        *locked->shared_arrays = 0;
+    }
+    ++(*locked->shared_arrays);
+    list->shared_arrays = locked->shared_arrays;
+    list->arena = locked->arena;
+    list->arena_size = locked->arena_size;
+    list->len = list->cap = glstate.list.lockedcount;
+    return true;
+}
+
 static renderlist_t *arrays_to_renderlist(renderlist_t *list, GLenum mode,
-                                        GLsizei skip, GLsizei count) {
+                                        GLsizei skip, GLsizei count, GLushort *indices, GLsizei ilen) {
+    // indices (if not NULL) start at skip, the list takes them
     if (! list)
         list = alloc_renderlist();
 //if (glstate.list.compiling) printf("arrary_to_renderlist while compiling list, skip=%d, count=%d\n", skip, count);
@@ -651,7 +823,24 @@ static renderlist_t *arrays_to_renderlist(renderlist_t *list, GLenum mode,
     list->mode_init = mode;
     list->len = count-skip;
     list->cap = count-skip;
-    
+    list->indices = indices;
+    list->ilen = list->indice_cap = ilen;
+
+    // inside glLockArrays, use the arrays already converted (not in a display list, that keeps its own copy)
+    if (!glstate.list.compiling && locked_range(skip, count) && locked_share(list)) {
+        // the arrays start at lockedfirst now
+        GLsizei base = skip - glstate.list.lockedfirst;
+        if (!indices) {
+            list->indices = (GLushort*)malloc((count-skip)*sizeof(GLushort));
+            list->ilen = list->indice_cap = count-skip;
+            for (int i=0; i<count-skip; i++)
+                list->indices[i] = base + i;
+        } else if (base) {
+            for (int i=0; i<ilen; i++)
+                indices[i] += base;
+        }
+        return list;
+    }
 	if (glstate.vao->vertex_array) {
 		list->vert = copy_gl_pointer_tex(&glstate.vao->pointers.vertex, 4, skip, count, glstate.vao->pointers.vertex.buffer);
 	}
@@ -684,9 +873,113 @@ static inline bool should_intercept_render(GLenum mode) {
     );
 }
 
+static int hardext_elementuint = -1;
+static int has_elementuint() {
+    // GL_OES_element_index_uint allow 32bits indices in GLES
+    if (hardext_elementuint==-1) {
+        LOAD_GLES(glGetString);
+        const char *ext = (const char*)gles_glGetString(GL_EXTENSIONS);
+        hardext_elementuint = (ext && strstr(ext, "GL_OES_element_index_uint"))?1:0;
+    }
+    return hardext_elementuint;
+}
+
+static void shift_pointers(GLint base) {
+    // move all the arrays by base vertex (base can be negative)
+    #define GO(A) { pointer_state_t *p = &glstate.vao->pointers.A; \
+        p->pointer = (const char*)p->pointer + base*((p->stride)?p->stride:(p->size*gl_sizeof(p->type))); }
+    GO(vertex);
+    GO(color);
+    GO(secondary);
+    GO(normal);
+    for (int aa=0; aa<MAX_TEX; aa++)
+        GO(tex_coord[aa]);
+    #undef GO
+}
+
+static void draw_elements_chunk(GLenum mode, const GLuint *uindices, GLsizei count, GLuint hub, bool usehub) {
+    // draw count indices (plus the fan hub if usehub) as ushort indices, rebasing the arrays
+    GLuint min = (usehub)?hub:uindices[0], max = min;
+    for (int i=0; i<count; i++) {
+        if (uindices[i]<min) min = uindices[i];
+        if (uindices[i]>max) max = uindices[i];
+    }
+    GLsizei n = count + ((usehub)?1:0);
+    if (max-min > 65535) {
+        // a single primitive too spread out, send it vertex by vertex
+        glshim_glBegin(mode);
+        if (usehub) glshim_glArrayElement(hub);
+        for (int i=0; i<count; i++)
+            glshim_glArrayElement(uindices[i]);
+        glshim_glEnd();
+        return;
+    }
+    GLushort *sindices = (GLushort*)malloc(n*sizeof(GLushort));
+    GLushort *p = sindices;
+    if (usehub) *(p++) = hub-min;
+    for (int i=0; i<count; i++)
+        *(p++) = uindices[i]-min;
+    shift_pointers(min);
+    glshim_glDrawElements(mode, n, GL_UNSIGNED_SHORT, sindices);
+    shift_pointers(-(GLint)min);
+    free(sindices);
+}
+
+static void draw_elements_split(GLenum mode, GLsizei count, const GLuint *uindices) {
+    // split a draw of 32bits indices in pieces that can use 16bits indices, cutting on primitives boundaries
+    GLsizei n, s, g = 1;      // vertex per primitive, step between primitives, granularity of the cut
+    bool fan = false;
+    switch (mode) {
+        case GL_POINTS: n = 1; s = 1; break;
+        case GL_LINES: n = 2; s = 2; break;
+        case GL_LINE_STRIP: case GL_LINE_LOOP: n = 2; s = 1; break;
+        case GL_TRIANGLES: n = 3; s = 3; break;
+        case GL_TRIANGLE_STRIP: n = 3; s = 1; g = 2; break;     // keep the winding
+        case GL_TRIANGLE_FAN: case GL_POLYGON: n = 2; s = 1; fan = true; break;
+        case GL_QUADS: n = 4; s = 4; break;
+        case GL_QUAD_STRIP: n = 4; s = 2; break;
+        default: return;
+    }
+    GLuint hub = uindices[0];
+    if (fan) {
+        uindices++;
+        count--;
+    }
+    GLenum chunkmode = (mode==GL_LINE_LOOP)?GL_LINE_STRIP:mode;
+    GLsizei nprim = (count<n)?0:(count-n)/s+1;
+    GLsizei p0 = 0;
+    while (p0<nprim) {
+        GLuint min = uindices[p0*s], max = min;
+        if (fan) {
+            if (hub<min) min = hub;
+            if (hub>max) max = hub;
+        }
+        GLsizei p1 = p0;
+        while (p1<nprim) {
+            GLuint nmin = min, nmax = max;
+            for (int i=(p1==p0)?0:n-s; i<n; i++) {
+                GLuint v = uindices[p1*s+i];
+                if (v<nmin) nmin = v;
+                if (v>nmax) nmax = v;
+            }
+            if (nmax-nmin > 65535 && p1>p0)
+                break;
+            min = nmin; max = nmax;
+            p1++;
+        }
+        if (g>1 && p1<nprim && (p1-p0)%g && p1-p0>1)
+            p1--;
+        draw_elements_chunk(chunkmode, uindices+p0*s, (p1-1)*s+n-p0*s, hub, fan);
+        p0 = p1;
+    }
+    if (mode==GL_LINE_LOOP && count>1) {
+        GLuint close[2] = {uindices[count-1], uindices[0]};
+        draw_elements_chunk(GL_LINES, close, 2, 0, false);
+    }
+}
+
 void glshim_glDrawElements(GLenum mode, GLsizei count, GLenum type, const GLvoid *indices) {
     //printf("glDrawElements(0x%04X, %d, 0x%04X, %p), map=%p\n", mode, count, type, indices, (glstate.vao->elements)?glstate.vao->elements->data:NULL);
-    // TODO: split for count > 65535?
     // special check for QUADS and TRIANGLES that need multiple of 4 or 3 vertex...
     if (mode == GL_QUADS) while(count%4) count--;
     else if (mode == GL_TRIANGLES) while(count%3) count--;
@@ -700,15 +993,41 @@ void glshim_glDrawElements(GLenum mode, GLsizei count, GLenum type, const GLvoid
         return;
     }
 
+    if (gl_batchdirect && count>=gl_batchdirect && glstate.gl_batch && !glstate.list.compiling) {
+        // big draws gain nothing from being merged, send them right away
+        GLuint old_batch = glstate.gl_batch;
+        flush();
+        glstate.gl_batch = 0;
+        glshim_glDrawElements(mode, count, type, indices);
+        glstate.gl_batch = old_batch;
+        return;
+    }
 	noerrorShim();
+    bool compiling = (glstate.list.active && (glstate.list.compiling || glstate.gl_batch));
+    // GLES handles ubyte and ushort indices, they can be used as-is if nothing need to read them
+    bool native = (type==GL_UNSIGNED_SHORT) || ((type==GL_UNSIGNED_BYTE || (type==GL_UNSIGNED_INT && has_elementuint()))
+        && !compiling && !should_intercept_render(mode)
+        && glstate.render_mode!=GL_SELECT && !(glstate.polygon_mode==GL_LINE && mode>=GL_TRIANGLES));
+    if (type==GL_UNSIGNED_INT && !native) {
+        // indices above 65535 cannot be narrowed to ushort: the draw has to be rebased, maybe split
+        GLsizei min, max;
+        buffer_minmax_indices(glstate.vao->elements, indices, GL_UNSIGNED_INT, count, &max, &min);
+        if (max > 65535) {
+            const GLuint *uindices = (glstate.vao->elements)?(GLuint*)((char*)glstate.vao->elements->data + (uintptr_t)indices):(GLuint*)indices;
+            glbuffer_t *elements = glstate.vao->elements;
+            glstate.vao->elements = NULL;
+            draw_elements_split(mode, count, uindices);
+            glstate.vao->elements = elements;
+            return;
+        }
+    }
     GLushort *sindices;
-    bool need_free = (type!=GL_UNSIGNED_SHORT);
+    bool need_free = !native;
     if(need_free)
         sindices = copy_gl_array((glstate.vao->elements)?glstate.vao->elements->data + (uintptr_t)indices:indices,
             type, 1, 0, GL_UNSIGNED_SHORT, 1, 0, count);
     else
         sindices = (glstate.vao->elements)?(glstate.vao->elements->data + (uintptr_t)indices):(GLvoid*)indices;
-    bool compiling = (glstate.list.active && (glstate.list.compiling || glstate.gl_batch));
 
     if (compiling) {
         renderlist_t *list = NULL;
@@ -717,11 +1036,11 @@ void glshim_glDrawElements(GLenum mode, GLsizei count, GLenum type, const GLvoid
 		NewStage(glstate.list.active, STAGE_DRAW);
         list = glstate.list.active;
 
+        // work on a copy, the indices can be inside an element buffer
+        if (!need_free)
+            sindices = copy_gl_array(sindices, type, 1, 0, GL_UNSIGNED_SHORT, 1, 0, count);
         normalize_indices(sindices, &max, &min, count);
-        list = arrays_to_renderlist(list, mode, min, max + 1);
-        list->indices = (need_free)?sindices:copy_gl_array(sindices, type, 1, 0, GL_UNSIGNED_SHORT, 1, 0, count);
-        list->ilen = count;
-        list->indice_cap = count;
+        list = arrays_to_renderlist(list, mode, min, max + 1, sindices, count);
         //end_renderlist(list);
         
         glstate.list.active = extend_renderlist(list);
@@ -732,11 +1051,11 @@ void glshim_glDrawElements(GLenum mode, GLsizei count, GLenum type, const GLvoid
         renderlist_t *list = NULL;
         GLsizei min, max;
 
+        // work on a copy, the indices can be inside an element buffer
+        if (!need_free)
+            sindices = copy_gl_array(sindices, type, 1, 0, GL_UNSIGNED_SHORT, 1, 0, count);
         normalize_indices(sindices, &max, &min, count);
-        list = arrays_to_renderlist(list, mode, min, max + 1);
-        list->indices = (need_free)?sindices:copy_gl_array(sindices, type, 1, 0, GL_UNSIGNED_SHORT, 1, 0, count);
-        list->ilen = count;
-        list->indice_cap = count;
+        list = arrays_to_renderlist(list, mode, min, max + 1, sindices, count);
         list = end_renderlist(list);
         draw_renderlist(list);
         free_renderlist(list);
@@ -744,6 +1063,7 @@ void glshim_glDrawElements(GLenum mode, GLsizei count, GLenum type, const GLvoid
         return;
      } else {
 		LOAD_GLES(glDrawElements);
+		texdirty_sync();
 		LOAD_GLES(glNormalPointer);
 		LOAD_GLES(glVertexPointer);
 		LOAD_GLES(glColorPointer);
@@ -752,10 +1072,35 @@ void glshim_glDrawElements(GLenum mode, GLsizei count, GLenum type, const GLvoid
         LOAD_GLES(glDisable);
         LOAD_GLES(glEnableClientState);
         LOAD_GLES(glDisableClientState);
+        GLsizei min, max;
+        bool minmax = false;
+#define elements_minmax() \
+        if (!minmax) { \
+            if (native) \
+                buffer_minmax_indices(glstate.vao->elements, (glstate.vao->elements)?indices:sindices, type, count, &max, &min); \
+            else \
+                getminmax_indices(sindices, &max, &min, count); \
+            minmax = true; \
+        }
+        // the locked colors can only be used if all the indices are in the locked range
+        GLfloat *locked_colors = NULL;
+        if (glstate.vao->color_array && glstate.list.locked && !glstate.list.lockedfirst) {
+            elements_minmax();
+            if (locked_range(min, max+1))
+                locked_colors = (glstate.vao->secondary_array)?locked_finalcolors():locked_array(color, color, 4, 2, copy_gl_pointer_color);
+        }
+        // the len of the arrays is only needed if some of them have to be converted
+        bool need_len = !locked_colors && ((glstate.vao->secondary_array && glstate.vao->color_array) ||
+            (glstate.vao->color_array && (glstate.vao->pointers.color.size != 4)));
+        for (int aa=0; aa<MAX_TEX && !need_len; aa++)
+            if (glstate.vao->tex_coord_array[aa] && tex_setup_needchange(aa))
+                need_len = true;
         GLuint len = 0;
-        for (int i=0; i<count; i++)
-            if (len<sindices[i]) len = sindices[i]; // get the len of the arrays
-        len++;  // lenght is max(indices) + 1 !
+        if (need_len) {
+            elements_minmax();
+            len = max + 1;  // lenght is max(indices) + 1 !
+        }
+#undef elements_minmax
 #define shift_pointer(a, b) \
 		if (glstate.vao->b && glstate.vao->pointers.a.buffer) glstate.vao->pointers.a.pointer += (uintptr_t)glstate.vao->pointers.a.buffer->data;
 	
@@ -794,7 +1139,9 @@ void glshim_glDrawElements(GLenum mode, GLsizei count, GLenum type, const GLvoid
 			GLfloat *final_colors = NULL;
 			pointer_state_t old_color;
             client_state(color_array, GL_COLOR_ARRAY, );
-			if (/*glstate.enable.color_sum && */(glstate.vao->secondary_array) && (glstate.vao->color_array)) {
+			if (locked_colors && ((glstate.vao->secondary_array) || (glstate.vao->pointers.color.size != 4))) {
+				gles_glColorPointer(4, GL_FLOAT, 0, locked_colors);
+			} else if (/*glstate.enable.color_sum && */(glstate.vao->secondary_array) && (glstate.vao->color_array)) {
 				final_colors=copy_gl_pointer_color(&glstate.vao->pointers.color, 4, 0, len, 0);
 				GLfloat* seconds_colors=(GLfloat*)copy_gl_pointer(&glstate.vao->pointers.secondary, 4, 0, len, 0);
 				for (int i=0; i<len*4; i++)
@@ -864,7 +1211,7 @@ void glshim_glDrawElements(GLenum mode, GLsizei count, GLenum type, const GLvoid
 				for (int i=n; i<count; i+=s)
 					gles_glDrawElements(mode, n, GL_UNSIGNED_SHORT, sindices+i-n);
 			} else
-				gles_glDrawElements(mode, count, GL_UNSIGNED_SHORT, sindices);
+				gles_glDrawElements(mode, count, (native)?type:GL_UNSIGNED_SHORT, sindices);
 			
 			// secondary color
 			if (final_colors) {
@@ -920,18 +1267,27 @@ void glshim_glDrawArrays(GLenum mode, GLint first, GLsizei count) {
         return;
     }
 	noerrorShim();
-	LOAD_GLES(glNormalPointer);
-	LOAD_GLES(glVertexPointer);
-	LOAD_GLES(glColorPointer);
-	LOAD_GLES(glTexCoordPointer);
-    LOAD_GLES(glEnable);
-    LOAD_GLES(glDisable);
-    LOAD_GLES(glEnableClientState);
-    LOAD_GLES(glDisableClientState);
-
+	LOAD_GLES_NOSYNC(glNormalPointer);
+	LOAD_GLES_NOSYNC(glVertexPointer);
+	LOAD_GLES_NOSYNC(glColorPointer);
+	LOAD_GLES_NOSYNC(glTexCoordPointer);
+    LOAD_GLES_NOSYNC(glEnable);
+    LOAD_GLES_NOSYNC(glDisable);
+    LOAD_GLES_NOSYNC(glEnableClientState);
+    LOAD_GLES_NOSYNC(glDisableClientState);
+
+    if (gl_batchdirect && count>=gl_batchdirect && glstate.gl_batch && !glstate.list.compiling) {
+        // big draws gain nothing from being merged, send them right away
+        GLuint old_batch = glstate.gl_batch;
+        flush();
+        glstate.gl_batch = 0;
+        glshim_glDrawArrays(mode, first, count);
+        glstate.gl_batch = old_batch;
+        return;
+    }
     if (glstate.list.active && (glstate.list.compiling || glstate.gl_batch)) {
         NewStage(glstate.list.active, STAGE_DRAW);
-        glstate.list.active = arrays_to_renderlist(glstate.list.active, mode, first, count+first);
+        glstate.list.active = arrays_to_renderlist(glstate.list.active, mode, first, count+first, NULL, 0);
         glstate.list.active = extend_renderlist(glstate.list.active);
         return;
     }
@@ -943,7 +1299,7 @@ void glshim_glDrawArrays(GLenum mode, GLint first, GLsizei count) {
 
     if (should_intercept_render(mode)) {
         renderlist_t *list;
-        list = arrays_to_renderlist(NULL, mode, first, count+first);
+        list = arrays_to_renderlist(NULL, mode, first, count+first, NULL, 0);
         list = end_renderlist(list);
         draw_renderlist(list);
         free_renderlist(list);
@@ -951,6 +1307,10 @@ void glshim_glDrawArrays(GLenum mode, GLint first, GLsizei count) {
         // TODO: some draw states require us to use the full pipeline here
         // like texgen, stipple, npot
         LOAD_GLES(glDrawArrays);
+        texdirty_sync();
+        GLfloat *locked_colors = NULL;
+        if (glstate.vao->color_array && !glstate.list.lockedfirst && locked_range(first, first+count))
+            locked_colors = (glstate.vao->secondary_array)?locked_finalcolors():locked_array(color, color, 4, 2, copy_gl_pointer_color);
 
 #define shift_pointer(a, b) \
 	if (glstate.vao->b && glstate.vao->pointers.a.buffer) glstate.vao->pointers.a.pointer = glstate.vao->pointers.a.buffer->data + (uintptr_t)glstate.vao->pointers.a.pointer;
@@ -977,7 +1337,10 @@ void glshim_glDrawArrays(GLenum mode, GLint first, GLsizei count) {
 			// secondary color...
 			GLfloat *final_colors = NULL;
             client_state(color_array, GL_COLOR_ARRAY, );
-			if (/*glstate.enable.color_sum && */(glstate.vao->secondary_array) && (glstate.vao->color_array)) {
+			if (locked_colors && ((glstate.vao->secondary_array) || (glstate.vao->pointers.color.size != 4) || 
+                    ((glstate.vao->pointers.color.stride!=0) && (glstate.vao->pointers.color.type != GL_FLOAT)))) {
+				gles_glColorPointer(4, GL_FLOAT, 0, locked_colors);
+			} else if (/*glstate.enable.color_sum && */(glstate.vao->secondary_array) && (glstate.vao->color_array)) {
 				final_colors=copy_gl_pointer_color(&glstate.vao->pointers.color, 4, 0, count+first, 0);
 				GLfloat* seconds_colors=(GLfloat*)copy_gl_pointer(&glstate.vao->pointers.secondary, 4, first, count+first, 0);
 				for (int i=0; i<(count+first)*4; i++)
@@ -1325,7 +1688,7 @@ void glSecondaryColor3f(GLfloat r, GLfloat g, GLfloat b) AliasExport("glshim_glS
 
 #ifndef USE_ES2
 void glshim_glMaterialfv(GLenum face, GLenum pname, const GLfloat *params) {
-    LOAD_GLES(glMaterialfv);
+    LOAD_GLES_NOSYNC(glMaterialfv);
     if ((glstate.list.compiling || glstate.gl_batch) && glstate.list.active) {
 		//TODO: Materialfv can be done per vertex, how to handle that ?!
 		//NewStage(glstate.list.active, STAGE_MATERIAL);
@@ -1335,13 +1698,14 @@ void glshim_glMaterialfv(GLenum face, GLenum pname, const GLfloat *params) {
 	    if (face!=GL_FRONT_AND_BACK) {
 		    face=GL_FRONT_AND_BACK;
 		}
+        thread_sync();
         gles_glMaterialfv(face, pname, params);
         errorGL();
     }
 }
 void glMaterialfv(GLenum face, GLenum pname, const GLfloat *params) AliasExport("glshim_glMaterialfv");
 void glshim_glMaterialf(GLenum face, GLenum pname, const GLfloat param) {
-    LOAD_GLES(glMaterialf);
+    LOAD_GLES_NOSYNC(glMaterialf);
     if ((glstate.list.compiling || glstate.gl_batch) && glstate.list.active) {
 		GLfloat params[4];
 		memset(params, 0, 4*sizeof(GLfloat));
@@ -1353,6 +1717,7 @@ void glshim_glMaterialf(GLenum face, GLenum pname, const GLfloat param) {
 	    if (face!=GL_FRONT_AND_BACK) {
 		    face=GL_FRONT_AND_BACK;
 		}
+        thread_sync();
         gles_glMaterialf(face, pname, param);
         errorGL();
     }
@@ -1448,21 +1813,79 @@ void glshim_glArrayElement(GLint i) {
 }
 void glArrayElement(GLint i) AliasExport("glshim_glArrayElement");
 
-// TODO: between a lock and unlock, I can assume the array pointers are unchanged
-// so I can build a renderlist_t on the first call and hold onto it
-// maybe I need a way to call a renderlist_t with (first, count)
+// between a lock and unlock, each array is converted once in a renderlist_t, on
+// its first use, and all the draws reuse it, as long as the array pointers are unchanged
 void glshim_glLockArrays(GLint first, GLsizei count) {
+    if (glstate.list.locked)
+        glshim_glUnlockArrays();
+    if (first<0 || count<=0) {
+        errorShim(GL_INVALID_VALUE);
+        return;
+    }
+    // the list can outlive the frame, in the draws that share its arrays
+    GLuint batchalloc = gl_batchalloc;
+    gl_batchalloc = 0;
+    renderlist_t *list = alloc_renderlist();
+    gl_batchalloc = batchalloc;
+    // room for the arrays enabled now
+    GLboolean enabled[4+MAX_TEX] = {glstate.vao->vertex_array, glstate.vao->normal_array,
+        glstate.vao->color_array, glstate.vao->secondary_array};
+    int width = 0;
+    for (int i=0; i<MAX_TEX; i++)
+        enabled[4+i] = glstate.vao->tex_coord_array[i];
+    for (int i=0; i<4+MAX_TEX; i++)
+        if (enabled[i])
+            width += (i==1)?3:4;
+    list->len = list->cap = count;
+    list->arena_size = width*count;
+    list->arena = (GLfloat*)malloc(list->arena_size*sizeof(GLfloat));
+    GLfloat *slot = list->arena;
+    for (int i=0; i<4+MAX_TEX; i++) {
+        glstate.list.lockedslots[i] = (enabled[i])?slot:NULL;
+        if (enabled[i])
+            slot += ((i==1)?3:4)*count;
+    }
+    memcpy(&glstate.list.lockedpointers, &glstate.vao->pointers, sizeof(pointer_states_t));
+    glstate.list.lockedlist = list;
+    glstate.list.lockedfirst = first;
+    glstate.list.lockedcount = count;
     glstate.list.locked = true;
     noerrorShim();
 }
 void glLockArraysEXT(GLint first, GLsizei count) AliasExport("glshim_glLockArrays");
 void glshim_glUnlockArrays() {
     glstate.list.locked = false;
+    if (glstate.list.lockedlist) {
+        free_renderlist(glstate.list.lockedlist);
+        glstate.list.lockedlist = NULL;
+    }
+    if (glstate.list.lockedcolors) {
+        free(glstate.list.lockedcolors);
+        glstate.list.lockedcolors = NULL;
+    }
     noerrorShim();
 }
 void glUnlockArraysEXT() AliasExport("glshim_glUnlockArrays");
 // display lists
 
+static GLboolean lists_changed = 0;
+
+void endframe_lists() {
+    // memory report, when some lists were created or deleted during the frame
+    if (!gl_listmem || !lists_changed)
+        return;
+    lists_changed = 0;
+    unsigned long size = 0, gpu = 0;
+    int count = 0;
+    for (int i = 0; i < glstate.list.count; i++) {
+        if (glstate.lists[i]) {
+            size += memory_renderlist(glstate.lists[i], &gpu);
+            count++;
+        }
+    }
+    printf("LIBGL: %d display lists, %lu KB (%lu KB in GLES buffers and textures)\n", count, size/1024, gpu/1024);
+}
+
 static renderlist_t *glshim_glGetList(GLuint list) {
     if (glIsList(list))
         return glstate.lists[list - 1];
@@ -1523,6 +1946,14 @@ void glshim_glEndList() {
         glstate.list.compiling = false;
         end_renderlist(glstate.list.active);
         glstate.list.active = NULL;
+        flatten_invalidate();
+        // the list will be called many times, spend some time on it now
+        glstate.lists[list - 1] = optimize_renderlist(glstate.lists[list - 1]);
+        compact_renderlist(glstate.lists[list - 1]);
+        lists_changed = 1;
+        // mark the lists as static, their arrays will go in a VBO when first drawn
+        for (renderlist_t *l = glstate.lists[list - 1]; l; l = l->next)
+            l->compiled = true;
         if (gl_batch==1) {
             init_batch();
         } 
@@ -1554,9 +1985,9 @@ void glPushCall(void *call) {
     }
 }
 
-void glshim_glCallLists(GLsizei n, GLenum type, const GLvoid *lists) {
+static GLuint calllists_id(GLenum type, const GLvoid *lists, GLsizei i) {
     #define call(name, type) \
-        case name: glCallList(((type *)lists)[i] + glstate.list.base); break
+        case name: return ((type *)lists)[i] + glstate.list.base
 
     // seriously wtf
     #define call_bytes(name, stride)                             \
@@ -1566,28 +1997,51 @@ void glshim_glCallLists(GLsizei n, GLenum type, const GLvoid *lists) {
             for (j = 0; j < stride; j++) {                       \
                 list += *(l + (i * stride + j)) << (stride - j); \
             }                                                    \
-            glshim_glCallList(list + glstate.list.base);                  \
-            break
+            return list + glstate.list.base
 
-    unsigned int i, j;
+    unsigned int j;
     GLuint list;
     GLubyte *l;
-    for (i = 0; i < n; i++) {
-        switch (type) {
-            call(GL_BYTE, GLbyte);
-            call(GL_UNSIGNED_BYTE, GLubyte);
-            call(GL_SHORT, GLshort);
-            call(GL_UNSIGNED_SHORT, GLushort);
-            call(GL_INT, GLint);
-            call(GL_UNSIGNED_INT, GLuint);
-            call(GL_FLOAT, GLfloat);
-            call_bytes(GL_2_BYTES, 2);
-            call_bytes(GL_3_BYTES, 3);
-            call_bytes(GL_4_BYTES, 4);
-        }
+    switch (type) {
+        call(GL_BYTE, GLbyte);
+        call(GL_UNSIGNED_BYTE, GLubyte);
+        call(GL_SHORT, GLshort);
+        call(GL_UNSIGNED_SHORT, GLushort);
+        call(GL_INT, GLint);
+        call(GL_UNSIGNED_INT, GLuint);
+        call(GL_FLOAT, GLfloat);
+        call_bytes(GL_2_BYTES, 2);
+        call_bytes(GL_3_BYTES, 3);
+        call_bytes(GL_4_BYTES, 4);
     }
     #undef call
     #undef call_bytes
+    return 0;
+}
+
+void glshim_glCallLists(GLsizei n, GLenum type, const GLvoid *lists) {
+    GLsizei i;
+    if (gl_flatlists && n > 1 && !glstate.list.compiling) {
+        // draw the whole sequence as a single list if possible
+        GLuint *ids = (GLuint *)malloc(n * sizeof(GLuint));
+        for (i = 0; i < n; i++)
+            ids[i] = calllists_id(type, lists, i);
+        renderlist_t *l = flatten_calllists(n, ids);
+        free(ids);
+        if (l) {
+            noerrorShim();
+            if (glstate.gl_batch && glstate.list.active)
+                glstate.list.active = append_calllist(glstate.list.active, l);
+            else
+                draw_renderlist(l);
+            return;
+        }
+    }
+    for (i = 0; i < n; i++) {
+        GLuint list = calllists_id(type, lists, i);
+        if (list)
+            glshim_glCallList(list);
+    }
 }
 void glCallLists(GLsizei n, GLenum type, const GLvoid *lists) AliasExport("glshim_glCallLists");
 
@@ -1597,7 +2051,9 @@ void glshim_glDeleteList(GLuint list) {
     }
     renderlist_t *l = glshim_glGetList(list);
     if (l) {
+        flatten_invalidate();
         free_renderlist(l);
+        lists_changed = 1;
         glstate.lists[list-1] = NULL;
     }
 
@@ -1894,16 +2350,47 @@ void init_statebatch() {
     memset(&glstate.statebatch, 0, sizeof(statebatch_t));
 }
 
+unsigned long batch_now() {
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    return tv.tv_sec*1000000UL + tv.tv_usec;
+}
+
+int batch_counted() {
+    return glstate.gl_batch && !glstate.list.compiling;
+}
+
+int batch_timed() {
+    return (gl_batchadaptive || gl_batchstats) && batch_counted();
+}
+
 void flush() {
     // flush internal list
     //printf("flush glstate.list.active=%p, gl_batch=%i(%i)\n", glstate.list.active, glstate.gl_batch, gl_batch);
     renderlist_t *mylist = glstate.list.active;
     if (mylist) {
         GLuint old = glstate.gl_batch;
+        int counted = batch_counted();
+        int timed = batch_timed();
         glstate.list.active = NULL;
         glstate.gl_batch = 0;
         mylist = end_renderlist(mylist);
+        if (old) mylist = sort_renderlist(mylist);
+        unsigned long start = 0;
+        if (counted) {
+            batchstats.flushes++;
+            for (renderlist_t *l = GetFirst(mylist); l; l = l->next)
+                if (l->len) {
+                    batchstats.draws++;
+                    batchstats.vertices += l->len;
+                }
+        }
+        thread_sync();  // outside of draw_time
+        if (timed)
+            start = batch_now();
         draw_renderlist(mylist);
+        if (timed)
+            batchstats.draw_time += batch_now() - start;
         free_renderlist(mylist);
         glstate.gl_batch = old;
     }
@@ -1911,6 +2398,61 @@ void flush() {
     glstate.list.active = (glstate.gl_batch)?alloc_renderlist():NULL;
 }
 
+#define MERGEMAX_MIN 1000
+#define MERGEMAX_MAX 65535
+
+static void adapt_batch() {
+    static batchstats_t last, shown;
+    static float merge_cost = 0.0f, draw_cost = 0.0f;
+    static int frames = 0;
+    batchstats.frames++;
+    if (gl_batchadaptive) {
+        // compare the cost of a merge with the cost of the draw call it saves
+        unsigned long merges = batchstats.merges - last.merges;
+        unsigned long draws = batchstats.draws - last.draws;
+        unsigned long limited = batchstats.limited - last.limited;
+        if (merges)
+            merge_cost = 0.9f*merge_cost + 0.1f*(batchstats.merge_time - last.merge_time)/(float)merges;
+        if (draws)
+            draw_cost = 0.9f*draw_cost + 0.1f*(batchstats.draw_time - last.draw_time)/(float)draws;
+        if (merges && draws) {
+            if (merge_cost > draw_cost && gl_mergemax > MERGEMAX_MIN) {
+                // merging big lists costs more than drawing them
+                gl_mergemax = gl_mergemax*3/4;
+                if (gl_mergemax < MERGEMAX_MIN) gl_mergemax = MERGEMAX_MIN;
+            } else if (limited && merge_cost*2 < draw_cost && gl_mergemax < MERGEMAX_MAX) {
+                // the limit is what stops cheap merges
+                gl_mergemax = gl_mergemax*5/4;
+                if (gl_mergemax > MERGEMAX_MAX) gl_mergemax = MERGEMAX_MAX;
+            }
+        }
+        last = batchstats;
+    }
+    if (gl_batchstats && ++frames >= 100) {
+        float n = (float)frames;
+        printf("LIBGL: batch, per frame: %.1f flushes, %.1f draws, %.0f vertices, %.1f merges (%.1f limited), draw %.0fus, merge %.0fus, merge limit %u\n",
+            (batchstats.flushes-shown.flushes)/n, (batchstats.draws-shown.draws)/n, (batchstats.vertices-shown.vertices)/n,
+            (batchstats.merges-shown.merges)/n, (batchstats.limited-shown.limited)/n,
+            (batchstats.draw_time-shown.draw_time)/n, (batchstats.merge_time-shown.merge_time)/n, gl_mergemax);
+        frames = 0;
+        shown = batchstats;
+    }
+}
+
+void endframe_batch() {
+    // end of frame, all the memory of the batched lists can be reused
+    if (!glstate.gl_batch || glstate.list.compiling)
+        return;
+    if (glstate.list.active && glstate.list.active->framealloc) {
+        free_renderlist(glstate.list.active);
+        glstate.list.active = NULL;
+    }
+    frame_reset();
+    if (!glstate.list.active)
+        glstate.list.active = alloc_renderlist();
+    adapt_batch();
+}
+
 void init_batch() {
     glstate.list.active = alloc_renderlist();
     init_statebatch();
@@ -1947,7 +2489,7 @@ void glshim_glFinish() {
 void glFinish() AliasExport("glshim_glFinish");
 
 void glshim_glLoadMatrixf(const GLfloat * m) {
-    LOAD_GLES(glLoadMatrixf);
+    LOAD_GLES_NOSYNC(glLoadMatrixf);
     
     if ((glstate.list.compiling || glstate.gl_batch) && glstate.list.active) {
         NewStage(glstate.list.active, STAGE_MATRIX);
@@ -1955,12 +2497,13 @@ void glshim_glLoadMatrixf(const GLfloat * m) {
         memcpy(glstate.list.active->matrix_val, m, 16*sizeof(GLfloat));
         return;
     }
+    thread_sync();
     gles_glLoadMatrixf(m);
 }
 void glLoadMatrixf(const GLfloat * m) AliasExport("glshim_glLoadMatrixf");
 
 void glshim_glMultMatrixf(const GLfloat * m) {
-    LOAD_GLES(glMultMatrixf);
+    LOAD_GLES_NOSYNC(glMultMatrixf);
     
     if ((glstate.list.compiling || glstate.gl_batch) && glstate.list.active) {
         NewStage(glstate.list.active, STAGE_MATRIX);
@@ -1968,12 +2511,13 @@ void glshim_glMultMatrixf(const GLfloat * m) {
         memcpy(glstate.list.active->matrix_val, m, 16*sizeof(GLfloat));
         return;
     }
+    thread_sync();
     gles_glMultMatrixf(m);
 }
 void glMultMatrixf(const GLfloat * m) AliasExport("glshim_glMultMatrixf");
 
 void glshim_glFogfv(GLenum pname, const GLfloat* params) {
-    LOAD_GLES(glFogfv);
+    LOAD_GLES_NOSYNC(glFogfv);
 
     if ((glstate.list.compiling || glstate.gl_batch) && glstate.list.active) {
         if (pname == GL_FOG_COLOR) {
@@ -1983,7 +2527,7 @@ void glshim_glFogfv(GLenum pname, const GLfloat* params) {
         }
     }
     PUSH_IF_COMPILING(glFogfv);
-    
+    thread_sync();
     gles_glFogfv(pname, params);
 }
 void glFogfv(GLenum pname, const GLfloat* params) AliasExport("glshim_glFogfv");
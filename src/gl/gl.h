@@ -424,6 +424,26 @@ void glshim_glMultiDrawElements( GLenum mode, GLsizei *count, GLenum type, const
 
 void flush();
 void init_batch();
+void endframe_batch();
+void endframe_lists();
+
+// batch mode counters, kept while batching (times in microseconds, only with LIBGL_BATCH adaptive or stats)
+typedef struct {
+    unsigned long frames;
+    unsigned long flushes;
+    unsigned long draws;        // GLES draw calls issued by the flushes
+    unsigned long vertices;
+    unsigned long merges;       // renderlists appended to the previous one
+    unsigned long limited;      // merges refused because of the size limit
+    unsigned long draw_time;
+    unsigned long merge_time;
+} batchstats_t;
+
+extern batchstats_t batchstats;
+extern GLuint gl_mergemax;
+unsigned long batch_now();
+int batch_counted();
+int batch_timed();
 
 #include "state.h"
 extern glstate_t glstate;
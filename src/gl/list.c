@@ -1,19 +1,85 @@
 #include "gl.h"
 #include "list.h"
 #include "debug.h"
+#include "framealloc.h"
+#include "shadow.h"
+
+// all the arrays of a renderlist live in one "arena" allocation, one after the other, each of "cap" elements
+#define ARENA_ARRAYS (4+MAX_TEX)
+
+static GLfloat **arena_array(renderlist_t *list, int i, int *width) {
+    switch (i) {
+        case 0: *width = 4; return &list->vert;
+        case 1: *width = 3; return &list->normal;
+        case 2: *width = 4; return &list->color;
+        case 3: *width = 4; return &list->secondary;
+    }
+    *width = 4;
+    return &list->tex[i-4];
+}
+
+static inline bool inarena(renderlist_t *list, GLfloat *p) {
+    return (list->arena && p>=list->arena && p<list->arena+list->arena_size);
+}
+
+void layout_renderlist(renderlist_t *list, unsigned long cap, GLfloat **add, bool shared) {
+    // (re)build the arena with a capacity of cap, adding the "add" array if not NULL
+    // if shared, current arrays are still used elsewhere and are not freed
+    int width = 0, w;
+    for (int i=0; i<ARENA_ARRAYS; i++) {
+        GLfloat **p = arena_array(list, i, &w);
+        if (*p || p==add)
+            width += w;
+    }
+    GLfloat *arena = (list->framealloc)?(GLfloat*)frame_alloc(width*cap*sizeof(GLfloat)):NULL;
+    if (!arena)
+        arena = (GLfloat*)malloc(width*cap*sizeof(GLfloat));
+    GLfloat *dst = arena;
+    for (int i=0; i<ARENA_ARRAYS; i++) {
+        GLfloat **p = arena_array(list, i, &w);
+        if (*p) {
+            memcpy(dst, *p, w*list->len*sizeof(GLfloat));
+            if (!shared && !inarena(list, *p))
+                frame_free(*p);   // array not yet in an arena (from arrays_to_renderlist)
+        } else if (p!=add)
+            continue;
+        *p = dst;
+        dst += w*cap;
+    }
+    if (list->arena && !shared)
+        frame_free(list->arena);
+    list->arena = arena;
+    list->arena_size = width*cap;
+    list->cap = cap;
+}
 
-#define alloc_sublist(n, cap) \
-    (GLfloat *)malloc(n * sizeof(GLfloat) * cap)
+static void free_arrays(renderlist_t *list) {
+    int w;
+    for (int i=0; i<ARENA_ARRAYS; i++) {
+        GLfloat **p = arena_array(list, i, &w);
+        if (*p && !inarena(list, *p))
+            frame_free(*p);
+    }
+    if (list->arena)
+        frame_free(list->arena);
+}
 
-#define realloc_sublist(ref, n, cap) \
-    if (ref)                         \
-        ref = (GLfloat *)realloc(ref, n * sizeof(GLfloat) * cap)
+extern GLuint gl_batchalloc;
 
 renderlist_t *alloc_renderlist() {
     int a;
 
-    renderlist_t *list = (renderlist_t *)malloc(sizeof(renderlist_t));
+    // lists of batch mode only live until the end of the frame
+    bool frame = (gl_batchalloc && glstate.gl_batch && !glstate.list.compiling);
+    renderlist_t *list = (frame)?(renderlist_t *)frame_alloc(sizeof(renderlist_t)):NULL;
+    if (!list) {
+        frame = false;
+        list = (renderlist_t *)malloc(sizeof(renderlist_t));
+    }
     memset(list, 0, sizeof(*list));
+    list->framealloc = frame;
+    if (frame)
+        frame_ref();
     list->cap = DEFAULT_RENDER_LIST_CAPACITY;
     list->matrix_val[0] = list->matrix_val[5] = list->matrix_val[10] = 
                           list->matrix_val[15] = 1.0f;
@@ -29,10 +95,8 @@ renderlist_t *alloc_renderlist() {
     return list;
 }
 
-bool ispurerender_renderlist(renderlist_t *list) {
-    // return true if renderlist contains only rendering command, no state changes
-    if (list->calls.len)
-        return false;
+static bool isstateless_renderlist(renderlist_t *list) {
+    // no state change other than the packed calls
     if (list->matrix_op)
         return false;
     if (list->raster_op)
@@ -49,14 +113,21 @@ bool ispurerender_renderlist(renderlist_t *list) {
         return false;
     if (list->texgen)
         return false;
-    if (list->mode_init == 0)
-        return false;
     if (list->set_texture || list->set_tmu)
         return false;
     
     return true;
 }
 
+bool ispurerender_renderlist(renderlist_t *list) {
+    // return true if renderlist contains only rendering command, no state changes
+    if (list->calls.len)
+        return false;
+    if (list->mode_init == 0)
+        return false;
+    return isstateless_renderlist(list);
+}
+
 bool isempty_renderlist(renderlist_t *list) {
     return (list->stage == STAGE_NONE);
 }
@@ -84,24 +155,63 @@ int rendermode_dimensions(GLenum mode) {
 }
 
 extern GLuint gl_mergelist;
+extern GLuint gl_batchshare;
+
+static bool isreference_renderlist(renderlist_t *list) {
+    // in batch mode, big compiled lists are used in place (copy on write) instead of being merged
+    return (gl_batchshare && list->compiled && list->len >= gl_batchshare
+            && glstate.gl_batch && !glstate.list.compiling);
+}
+
+static bool isdegenerate_renderlist(renderlist_t *list) {
+    switch (list->mode) {
+        case GL_TRIANGLE_STRIP:
+        case GL_TRIANGLE_FAN:
+        case GL_QUAD_STRIP:
+        case GL_POLYGON:
+            return ((list->indices)?list->ilen:list->len) < 3;
+    }
+    return false;
+}
+
+// merges done for a list that is kept and drawn later (glEndList, flattened glCallLists)
+static int merging_kept = 0;
+
+static bool ispolygonfilled_renderlist(renderlist_t *list) {
+    // the polygon mode set by the list, else the current one (0 is GL_FILL)
+    GLenum mode = (list->polygon_mode)?list->polygon_mode:glstate.polygon_mode;
+    return !mode || mode == GL_FILL;
+}
 
 bool islistscompatible_renderlist(renderlist_t *a, renderlist_t *b) {
     if (!gl_mergelist || !a)
         return false;
         
     // check if 2 "pure rendering" list are compatible for merge
+    // merged polygons lose their outline, needed when they are not filled.
+    // The polygon mode of a kept list is only known when it is drawn
+    if (a->mode_init == GL_POLYGON || b->mode_init == GL_POLYGON) {
+        if (glstate.list.compiling || merging_kept)
+            return false;
+        if (!ispolygonfilled_renderlist(a) || !ispolygonfilled_renderlist(b))
+            return false;
+    }
     if (a->mode_init != b->mode_init) {
         int a_mode = rendermode_dimensions(a->mode_init);
         int b_mode = rendermode_dimensions(b->mode_init);
-        if ((a_mode == 5) || (b_mode == 5))
-            return false;       // Let's not merge polygons
         if ((a_mode == 0) || (b_mode == 0))
             return false;       // undetermined is not good
-        if (a_mode == 4) a_mode = 3; // quads are handled as triangles
-        if (b_mode == 4) b_mode = 3;
+        if (a_mode >= 4) a_mode = 3; // quads and polygons are handled as triangles
+        if (b_mode >= 4) b_mode = 3;
         if (a_mode != b_mode)
             return false;
     }
+    // strips, fans and polygons are turned into triangles, they need at least one
+    if (isdegenerate_renderlist(a) || isdegenerate_renderlist(b))
+        return false;
+    // merging would copy the arrays of a compiled list, only to save a draw call
+    if (isreference_renderlist(a) || isreference_renderlist(b))
+        return false;
 /*    if ((a->indices==NULL) != (b->indices==NULL))
         return false;*/
     if (a->polygon_mode != b->polygon_mode)
@@ -127,10 +237,10 @@ bool islistscompatible_renderlist(renderlist_t *a, renderlist_t *b) {
         return false;
         
     // Check the size of a list, if it"s too big, don't merge...
-    if ((a->len+b->len)>30000)
-        return false;
-    if ((a->ilen+b->ilen)>30000)
+    if ((a->len+b->len)>gl_mergemax || (a->ilen+b->ilen)>gl_mergemax) {
+        if (batch_counted()) batchstats.limited++;
         return false;
+    }
     
     return true;
 }
@@ -267,50 +377,32 @@ void append_renderlist(renderlist_t *a, renderlist_t *b) {
     int ilen_b = renderlist_getindicesize(b);
     // lets append all the arrays
     unsigned long cap = a->cap;
-    if (a->len + b->len >= cap) cap += b->cap + DEFAULT_RENDER_LIST_CAPACITY;
-    if (a->shared_arrays && ((*a->shared_arrays)--)>0) {
-        // Unshare if shared (shared array are not used for now)
-        a->cap = cap;
-        GLfloat *tmp;
-        tmp = a->vert;
-        if (tmp) {
-            a->vert = alloc_sublist(4, cap);
-            memcpy(a->vert, tmp, 4*a->len*sizeof(GLfloat));
-        }
-        tmp = a->normal;
-        if (tmp) {
-            a->normal = alloc_sublist(3, cap);
-            memcpy(a->normal, tmp, 3*a->len*sizeof(GLfloat));
-        }
-        tmp = a->color;
-        if (tmp) {
-            a->color = alloc_sublist(4, cap);
-            memcpy(a->color, tmp, 4*a->len*sizeof(GLfloat));
-        }
-        tmp = a->secondary;
-        if (tmp) {
-            a->secondary = alloc_sublist(4, cap);
-            memcpy(a->secondary, tmp, 4*a->len*sizeof(GLfloat));
-        }
-        for (int i=0; i<MAX_TEX; i++) {
-            tmp = a->tex[i];
-            if (tmp) {
-                a->tex[i] = alloc_sublist(4, cap);
-                memcpy(a->tex[i], tmp, 4*a->len*sizeof(GLfloat));
-            }
-        }
+    if (a->len + b->len >= cap) {
+        cap *= 2;
+        if (a->len + b->len >= cap) cap = a->len + b->len + DEFAULT_RENDER_LIST_CAPACITY;
+    }
+    LOAD_GLES(glDeleteBuffers);
+    if (a->shared_arrays && *a->shared_arrays>0) {
+        // Unshare if shared, the arrays and the counter stay with the other owners
+        (*a->shared_arrays)--;
+        a->shared_arrays = NULL;
+        a->vbo_array = 0;   // the GLES copy belongs to the other owner
+        layout_renderlist(a, cap, NULL, true);
     } else {
-        if (a->cap < cap) {
-            a->cap = cap;
-            realloc_sublist(a->vert, 4, cap);
-            realloc_sublist(a->normal, 3, cap);
-            realloc_sublist(a->color, 4, cap);
-            realloc_sublist(a->secondary, 4, cap);
-            for (int i=0; i<MAX_TEX; i++)
-               realloc_sublist(a->tex[i], 4, cap);
+        // arrays are going to change, GLES copy is now stale
+        if (a->vbo_array) {
+            gles_glDeleteBuffers(1, &a->vbo_array);
+            a->vbo_array = 0;
         }
+        if (a->cap < cap || !a->arena)
+            layout_renderlist(a, cap, NULL, false);
+    }
+    if(a->shared_arrays) {free(a->shared_arrays); a->shared_arrays=0;}   // last owner
+    if (a->vbo_indices) {
+        if (!a->shared_indices || *a->shared_indices==0)
+            gles_glDeleteBuffers(1, &a->vbo_indices);
+        a->vbo_indices = 0;
     }
-    if(a->shared_arrays && *a->shared_arrays==0) {free(a->shared_arrays); a->shared_arrays=0;}
     if (a->shared_indices && ((*a->shared_indices)--)>0) {
         if (a->indices) {
             GLushort* tmpi = a->indices;
@@ -441,7 +533,14 @@ void adjust_renderlist(renderlist_t *list);
 renderlist_t *extend_renderlist(renderlist_t *list) {
     if ((list->prev!=NULL) && ispurerender_renderlist(list) && islistscompatible_renderlist(list->prev, list)) {
         // append list!
+        int timed = batch_timed();
+        unsigned long start = (timed)?batch_now():0;
         append_renderlist(list->prev, list);
+        if (timed) {
+            batchstats.merge_time += batch_now() - start;
+        }
+        if (batch_counted())
+            batchstats.merges++;
         renderlist_t *new = alloc_renderlist();
         new->prev = list->prev;
         list->prev->next = new;
@@ -475,10 +574,23 @@ renderlist_t* append_calllist(renderlist_t *list, renderlist_t *a)
     while(a) {
         if(ispurerender_renderlist(a) && islistscompatible_renderlist(list, a)) {
             // append list!
+            int timed = batch_timed();
+            unsigned long start = (timed)?batch_now():0;
             append_renderlist(list, a);
+            if (timed) {
+                batchstats.merge_time += batch_now() - start;
+            }
+            if (batch_counted())
+                batchstats.merges++;
         } else {
+            // close it now, so the shared arrays and indices are not changed later by one of the copies
+            if (a->open && end_renderlist(a)!=a)
+                break;  // a was an empty last list, and is gone
             // create a new appended list
             renderlist_t *new = alloc_renderlist();
+            // the copy will use the same GLES buffers, they can only be created while not shared
+            if (a->compiled && !a->vbo_array)
+                upload_renderlist(a);
             // prepared shared stuff...
             if(a->len && !a->shared_arrays) {
                 a->shared_arrays = (int*)malloc(sizeof(int));
@@ -493,7 +605,10 @@ renderlist_t* append_calllist(renderlist_t *list, renderlist_t *a)
                 *a->shared_calls = 0;
             }
             // batch copy first
+            GLboolean framealloc = new->framealloc;
             memcpy(new, a, sizeof(renderlist_t));
+            new->framealloc = framealloc;
+            new->next = NULL;
             list->next = new;
             new->prev = list;
             // ok, now on new list
@@ -520,8 +635,8 @@ renderlist_t* append_calllist(renderlist_t *list, renderlist_t *a)
                 }*/
                 // in case of batch mode, need to update the batchstate...
                 if(glstate.gl_batch) {
-                    for (int i = 0; i < list->calls.len; i++) {
-                        packed_call_t *p = list->calls.calls[i];
+                    packed_call_t *p;
+                    call_list_foreach(&list->calls, p) {
                         if(p->func == &glshim_glEnable) {
                             int wich_cap = Cap2BatchState(((glEnable_PACKED*)p)->args.a1);
                             if(wich_cap!=ENABLED_LAST) glstate.statebatch.enabled[wich_cap] = 1;
@@ -580,6 +695,786 @@ renderlist_t* append_calllist(renderlist_t *list, renderlist_t *a)
     return list;
 }
 
+// batch mode reordering: runs of pure draws that only differ by the bound texture
+// are grouped by texture, when depth testing makes the draw order irrelevant
+extern GLuint gl_batchsort;
+
+typedef struct {
+    int known;
+    GLuint v;
+} sort_state_t;
+
+static void sort_query(sort_state_t *s, GLenum pname) {
+    s->known = shadow_query(pname, &s->v);
+}
+
+static bool sortable_renderlist(renderlist_t *list) {
+    // a draw, optionally with a texture bind, nothing else
+    if (!list->len || !list->mode_init)
+        return false;
+    if (list->calls.len || list->pushattribute || list->popattribute)
+        return false;
+    if (list->matrix_op || list->raster_op || list->raster || list->fog_op)
+        return false;
+    if (list->material || list->light || list->lightmodel || list->texgen)
+        return false;
+    if (list->polygon_mode || list->set_tmu)
+        return false;
+    return true;
+}
+
+static void sort_run(renderlist_t **run, int n, GLenum target, GLuint texture, int known) {
+    // group 0 is what is drawn before the first bind, with the texture bound before the run
+    int *group = (int*)malloc(n*sizeof(int));
+    GLenum *gtarget = (GLenum*)malloc((n+1)*sizeof(GLenum));
+    GLuint *gtexture = (GLuint*)malloc((n+1)*sizeof(GLuint));
+    int ngroups = 1;
+    int g = 0;
+    gtarget[0] = target;
+    gtexture[0] = texture;
+    for (int i=0; i<n; i++) {
+        if (run[i]->set_texture) {
+            g = -1;
+            for (int j=(known)?0:1; j<ngroups; j++)
+                if (gtarget[j]==run[i]->target_texture && gtexture[j]==run[i]->texture) {
+                    g = j;
+                    break;
+                }
+            if (g<0) {
+                g = ngroups++;
+                gtarget[g] = run[i]->target_texture;
+                gtexture[g] = run[i]->texture;
+            }
+        }
+        group[i] = g;
+    }
+    int last = group[n-1];
+    if (ngroups>2 && last) {
+        // groups in order of first use, but the one bound at the end of the run stays last
+        renderlist_t **sorted = (renderlist_t**)malloc(n*sizeof(renderlist_t*));
+        int *sgroup = (int*)malloc(n*sizeof(int));
+        int k = 0;
+        for (int r=0; r<ngroups; r++) {
+            g = (r<last)?r:(r==ngroups-1)?last:r+1;
+            for (int i=0; i<n; i++)
+                if (group[i]==g) {
+                    sgroup[k] = g;
+                    sorted[k++] = run[i];
+                }
+        }
+        // only bind when the texture changes
+        for (int i=0; i<n; i++) {
+            renderlist_t *l = sorted[i];
+            if (sgroup[i] && (!i || sgroup[i-1]!=sgroup[i])) {
+                l->set_texture = true;
+                l->target_texture = gtarget[sgroup[i]];
+                l->texture = gtexture[sgroup[i]];
+                l->tmu = glstate.texture.active;
+            } else
+                l->set_texture = false;
+        }
+        memcpy(run, sorted, n*sizeof(renderlist_t*));
+        free(sorted);
+        free(sgroup);
+    }
+    free(group);
+    free(gtarget);
+    free(gtexture);
+}
+
+renderlist_t *sort_renderlist(renderlist_t *list) {
+    if (!list || !gl_batchsort)
+        return list;
+    while (list->prev) list = list->prev;
+    renderlist_t *first = list;
+    // state at the start of the batch, as the GLES driver has it
+    sort_state_t blend, depth, stencil, func, mask;
+    sort_query(&blend, GL_BLEND);
+    sort_query(&depth, GL_DEPTH_TEST);
+    sort_query(&stencil, GL_STENCIL_TEST);
+    sort_query(&func, GL_DEPTH_FUNC);
+    sort_query(&mask, GL_DEPTH_WRITEMASK);
+    // texture bound before the current run
+    GLenum target = GL_TEXTURE_2D;
+    GLuint texture = 0;
+    int known = 0;
+    int cap = 0;
+    renderlist_t **run = NULL;
+    while (list) {
+        if (list->set_tmu)
+            break;  // bindings would go to another unit, keep things simple
+        if (list->pushattribute || list->popattribute)
+            blend.known = depth.known = stencil.known = func.known = mask.known = 0;
+        packed_call_t *p;
+        call_list_foreach(&list->calls, p) {
+            if (p->func == &glshim_glEnable || p->func == &glshim_glDisable) {
+                GLenum c = ((glEnable_PACKED*)p)->args.a1;
+                sort_state_t *s = (c==GL_BLEND)?&blend:(c==GL_DEPTH_TEST)?&depth:(c==GL_STENCIL_TEST)?&stencil:NULL;
+                if (s) {
+                    s->known = 1;
+                    s->v = (p->func == &glshim_glEnable);
+                }
+            } else if (p->func == &glshim_glDepthFunc) {
+                func.known = 1;
+                func.v = ((glDepthFunc_PACKED*)p)->args.a1;
+            } else if (p->func == &glshim_glDepthMask) {
+                mask.known = 1;
+                mask.v = ((glDepthMask_PACKED*)p)->args.a1;
+            }
+        }
+        // only opaque, depth tested and depth writing geometry can be reordered
+        int opaque = blend.known && !blend.v && stencil.known && !stencil.v
+            && depth.known && depth.v && mask.known && mask.v
+            && func.known && (func.v==GL_LESS || func.v==GL_LEQUAL);
+        if (!opaque || !sortable_renderlist(list)) {
+            if (list->set_texture) {
+                target = list->target_texture;
+                texture = list->texture;
+                known = 1;
+            }
+            list = list->next;
+            continue;
+        }
+        // collect the run
+        int n = 0;
+        renderlist_t *before = list->prev;
+        renderlist_t *l = list;
+        for (; l && sortable_renderlist(l); l = l->next) {
+            if (n==cap) {
+                cap = (cap)?cap*2:64;
+                run = (renderlist_t**)realloc(run, cap*sizeof(renderlist_t*));
+            }
+            run[n++] = l;
+        }
+        renderlist_t *after = l;
+        if (n>2) {
+            sort_run(run, n, target, texture, known);
+            // relink, merging the draws that are now next to each other
+            renderlist_t *prev = before;
+            for (int i=0; i<n; i++) {
+                renderlist_t *cur = run[i];
+                if (prev && prev!=before && ispurerender_renderlist(cur) && islistscompatible_renderlist(prev, cur)) {
+                    append_renderlist(prev, cur);
+                    cur->prev = cur->next = NULL;
+                    free_renderlist(cur);
+                    continue;
+                }
+                cur->prev = prev;
+                if (prev) prev->next = cur; else first = cur;
+                prev = cur;
+            }
+            prev->next = after;
+            if (after) after->prev = prev;
+        }
+        // texture bound after the run, whatever the order
+        for (l = (after)?after->prev:NULL; l && l!=before; l = l->prev)
+            if (l->set_texture) {
+                target = l->target_texture;
+                texture = l->texture;
+                known = 1;
+                break;
+            }
+        list = after;
+    }
+    free(run);
+    return first;
+}
+
+// display list optimizer, run once at glEndList
+extern GLuint gl_listopt;
+
+#define KNOWN_MATERIALS 8
+
+static void drop_redundant_states(renderlist_t *list) {
+    // texture bindings, slot 0 is the unit active when the list is called
+    GLboolean bound[MAX_TEX+1];
+    GLenum btarget[MAX_TEX+1];
+    GLuint btexture[MAX_TEX+1];
+    int slot = 0;
+    // materials, only trusted until the next draw (GL_COLOR_MATERIAL may change them)
+    rendermaterial_t known[KNOWN_MATERIALS];
+    int nknown = 0;
+    memset(bound, 0, sizeof(bound));
+    for (; list; list = list->next) {
+        if (list->pushattribute || list->popattribute) {
+            memset(bound, 0, sizeof(bound));
+            nknown = 0;
+        }
+        if (list->calls.len)
+            nknown = 0;
+        if (list->set_tmu)
+            slot = (list->tmu<MAX_TEX)?list->tmu+1:0;
+        if (list->set_texture) {
+            if (bound[slot] && btarget[slot]==list->target_texture && btexture[slot]==list->texture) {
+                list->set_texture = false;
+            } else {
+                bound[slot] = true;
+                btarget[slot] = list->target_texture;
+                btexture[slot] = list->texture;
+            }
+        }
+        if (list->raster)
+            memset(bound, 0, sizeof(bound));    // raster use its own texture
+        if (list->material) {
+            khash_t(material) *map = list->material;
+            for (khint_t k = kh_begin(map); k != kh_end(map); ++k) {
+                if (!kh_exist(map, k))
+                    continue;
+                rendermaterial_t *m = kh_value(map, k);
+                int n = (m->pname==GL_SHININESS)?1:4;
+                int i;
+                for (i=0; i<nknown; i++)
+                    if (known[i].pname==m->pname)
+                        break;
+                if (i<nknown && memcmp(known[i].color, m->color, n*sizeof(GLfloat))==0) {
+                    free(m);
+                    kh_del(material, map, k);
+                    continue;
+                }
+                // GL_AMBIENT_AND_DIFFUSE and GL_AMBIENT / GL_DIFFUSE overlap
+                for (int j=0; j<nknown; j++)
+                    if ((m->pname==GL_AMBIENT_AND_DIFFUSE && (known[j].pname==GL_AMBIENT || known[j].pname==GL_DIFFUSE))
+                     || (known[j].pname==GL_AMBIENT_AND_DIFFUSE && (m->pname==GL_AMBIENT || m->pname==GL_DIFFUSE)))
+                        known[j].pname = 0;
+                if (i<nknown || nknown<KNOWN_MATERIALS)
+                    memcpy(&known[(i<nknown)?i:nknown++], m, sizeof(rendermaterial_t));
+            }
+            if (kh_size(map)==0) {
+                kh_destroy(material, map);
+                list->material = NULL;
+            }
+        }
+        if (list->len)
+            nknown = 0;
+    }
+}
+
+static bool isstrip_renderlist(renderlist_t *list) {
+    // the glPolygonMode(GL_LINE) outline of draw_renderlist needs the layout of
+    // strips, fans and polygons: they are neither triangulated nor merged here
+    switch (list->mode_init) {
+        case GL_TRIANGLE_STRIP:
+        case GL_TRIANGLE_FAN:
+        case GL_QUAD_STRIP:
+        case GL_POLYGON:
+            return true;
+    }
+    return false;
+}
+
+static void triangulate_renderlist(renderlist_t *list) {
+    // quads become indexed triangles (a single quad is drawn as a fan)
+    if (!list->len || list->shared_indices || isdegenerate_renderlist(list))
+        return;
+    if (list->mode_init != GL_QUADS)
+        return;
+    void (*convert)(renderlist_t *, GLushort *, int) = NULL;
+    switch (list->mode) {
+        case GL_QUADS: convert = renderlist_quads_triangles; break;
+        case GL_TRIANGLE_FAN: convert = renderlist_trianglefan_triangles; break;
+        default: return;
+    }
+    int ilen = renderlist_getindicesize(list);
+    if (ilen<=0)
+        return;
+    GLushort *indices = (GLushort*)malloc(ilen*sizeof(GLushort));
+    convert(list, indices, 0);
+    if (list->indices)
+        free(list->indices);
+    list->indices = indices;
+    list->ilen = list->indice_cap = ilen;
+    list->mode = GL_TRIANGLES;
+}
+
+static void merge_renderlists(renderlist_t *list) {
+    // same as extend_renderlist, now that some states are gone
+    while (list && list->next) {
+        renderlist_t *next = list->next;
+        if (list->open==next->open && !isstrip_renderlist(list) && !isstrip_renderlist(next)
+            && ispurerender_renderlist(next) && islistscompatible_renderlist(list, next)) {
+            append_renderlist(list, next);
+            list->next = next->next;
+            if (list->next)
+                list->next->prev = list;
+            next->prev = next->next = NULL;
+            free_renderlist(next);
+        } else
+            list = next;
+    }
+}
+
+static inline unsigned int hash_vertex(renderlist_t *list, int i) {
+    // FNV-1a over all the attributes of the vertex
+    unsigned int h = 2166136261u;
+    int w;
+    for (int a=0; a<ARENA_ARRAYS; a++) {
+        GLfloat *p = *arena_array(list, a, &w);
+        if (!p)
+            continue;
+        const unsigned char *c = (const unsigned char*)(p+i*w);
+        for (int j=0; j<w*sizeof(GLfloat); j++)
+            h = (h^c[j])*16777619u;
+    }
+    return h;
+}
+
+static inline bool same_vertex(renderlist_t *list, int i, int j) {
+    int w;
+    for (int a=0; a<ARENA_ARRAYS; a++) {
+        GLfloat *p = *arena_array(list, a, &w);
+        if (p && memcmp(p+i*w, p+j*w, w*sizeof(GLfloat)))
+            return false;
+    }
+    return true;
+}
+
+static void weld_renderlist(renderlist_t *list) {
+    // identical vertices are stored once, the draw use indices
+    unsigned long len = list->len;
+    if (len<4 || len>65535 || list->shared_arrays || list->shared_indices || list->vbo_array)
+        return;
+    int hsize = 1;
+    while (hsize < len*2) hsize <<= 1;
+    int *table = (int*)malloc(hsize*sizeof(int));
+    GLushort *remap = (GLushort*)malloc(len*sizeof(GLushort));
+    memset(table, 0xff, hsize*sizeof(int));
+    // unique vertices are packed at the start of the arrays, in order of first use
+    unsigned long n = 0;
+    int w;
+    for (int i=0; i<len; i++) {
+        unsigned int h = hash_vertex(list, i)&(hsize-1);
+        while (table[h]>=0 && !same_vertex(list, table[h], i))
+            h = (h+1)&(hsize-1);
+        if (table[h]<0) {
+            if (n!=i)
+                for (int a=0; a<ARENA_ARRAYS; a++) {
+                    GLfloat *p = *arena_array(list, a, &w);
+                    if (p) memcpy(p+n*w, p+i*w, w*sizeof(GLfloat));
+                }
+            table[h] = n;
+            remap[i] = n++;
+        } else
+            remap[i] = table[h];
+    }
+    free(table);
+    // new indices are only worth it if enough vertices are gone
+    if (n==len || (!list->indices && n*8>len*7)) {
+        if (n!=len) {
+            // put the arrays back as they were
+            for (int i=len-1; i>=0; i--)
+                for (int a=0; a<ARENA_ARRAYS; a++) {
+                    GLfloat *p = *arena_array(list, a, &w);
+                    if (p && remap[i]!=i) memcpy(p+i*w, p+remap[i]*w, w*sizeof(GLfloat));
+                }
+        }
+        free(remap);
+        return;
+    }
+    if (list->indices) {
+        for (int i=0; i<list->ilen; i++)
+            list->indices[i] = remap[list->indices[i]];
+        free(remap);
+    } else {
+        list->indices = remap;
+        list->ilen = list->indice_cap = len;
+    }
+    list->len = n;
+}
+
+// post-transform vertex cache optimization (Tom Forsyth's "Linear-Speed Vertex Cache Optimisation")
+#define VCACHE_SIZE 32
+#define VCACHE_VALENCE 32
+
+static float vcache_pos_score[VCACHE_SIZE];
+static float vcache_valence_score[VCACHE_VALENCE];
+
+static void vcache_init_scores() {
+    static int done = 0;
+    if (done) return;
+    done = 1;
+    for (int i=0; i<VCACHE_SIZE; i++)
+        vcache_pos_score[i] = (i<3)?0.75f:powf(1.0f-(i-3)*(1.0f/(VCACHE_SIZE-3)), 1.5f);
+    for (int i=1; i<VCACHE_VALENCE; i++)
+        vcache_valence_score[i] = 2.0f*powf(i, -0.5f);
+}
+
+static inline float vcache_score(int pos, int valence) {
+    if (!valence)
+        return -1.0f;   // no triangle left
+    float score = (pos>=0)?vcache_pos_score[pos]:0.0f;
+    return score + ((valence<VCACHE_VALENCE)?vcache_valence_score[valence]:2.0f*powf(valence, -0.5f));
+}
+
+static void vcache_renderlist(renderlist_t *list) {
+    // reorder triangles for the post-transform cache, then vertices in order of use
+    // (only real triangles: the glPolygonMode(GL_LINE) outline of quads needs their 2 triangles together)
+    if (list->mode!=GL_TRIANGLES || list->mode_init!=GL_TRIANGLES || !list->indices || list->ilen<3*VCACHE_SIZE
+     || list->shared_arrays || list->shared_indices || list->vbo_array)
+        return;
+    vcache_init_scores();
+    int nverts = list->len;
+    int ntris = list->ilen/3;
+    GLushort *ind = list->indices;
+    int *valence = (int*)calloc(nverts, sizeof(int));
+    int *offset = (int*)malloc((nverts+1)*sizeof(int));
+    int *adj = (int*)malloc(ntris*3*sizeof(int));
+    int *pos = (int*)malloc(nverts*sizeof(int));
+    float *vscore = (float*)malloc(nverts*sizeof(float));
+    float *tscore = (float*)malloc(ntris*sizeof(float));
+    char *emitted = (char*)calloc(ntris, 1);
+    GLushort *out = (GLushort*)malloc(list->ilen*sizeof(GLushort));
+    // triangles using each vertex, the first valence[v] of them are not emitted yet
+    for (int i=0; i<ntris*3; i++)
+        valence[ind[i]]++;
+    offset[0] = 0;
+    for (int v=0; v<nverts; v++) {
+        offset[v+1] = offset[v]+valence[v];
+        valence[v] = 0;
+    }
+    for (int i=0; i<ntris*3; i++) {
+        int v = ind[i];
+        adj[offset[v]+valence[v]++] = i/3;
+    }
+    for (int v=0; v<nverts; v++) {
+        pos[v] = -1;
+        vscore[v] = vcache_score(-1, valence[v]);
+    }
+    for (int t=0; t<ntris; t++)
+        tscore[t] = vscore[ind[t*3]]+vscore[ind[t*3+1]]+vscore[ind[t*3+2]];
+
+    int cache[VCACHE_SIZE+3], newcache[VCACHE_SIZE+3];
+    int ncache = 0;
+    int best = -1;
+    int cursor = 0;
+    for (int n=0; n<ntris; n++) {
+        if (best<0) {
+            // nothing in the cache, take the best remaining triangle
+            float bestscore = -1.0f;
+            while (emitted[cursor]) cursor++;
+            for (int t=cursor; t<ntris; t++)
+                if (!emitted[t] && tscore[t]>bestscore) {
+                    bestscore = tscore[t];
+                    best = t;
+                }
+        }
+        emitted[best] = 1;
+        int nnew = 0;
+        for (int k=0; k<3; k++) {
+            int v = ind[best*3+k];
+            out[n*3+k] = v;
+            // remove the triangle from the vertex
+            int *a = adj+offset[v];
+            for (int j=0; j<valence[v]; j++)
+                if (a[j]==best) {
+                    a[j] = a[--valence[v]];
+                    break;
+                }
+            newcache[nnew++] = v;
+        }
+        for (int i=0; i<ncache; i++) {
+            int v = cache[i];
+            if (v!=newcache[0] && v!=newcache[1] && v!=newcache[2])
+                newcache[nnew++] = v;
+        }
+        // vertices pushed out of the cache
+        for (int i=VCACHE_SIZE; i<nnew; i++) {
+            pos[newcache[i]] = -1;
+            vscore[newcache[i]] = vcache_score(-1, valence[newcache[i]]);
+        }
+        ncache = (nnew<VCACHE_SIZE)?nnew:VCACHE_SIZE;
+        for (int i=0; i<ncache; i++) {
+            int v = cache[i] = newcache[i];
+            pos[v] = i;
+            vscore[v] = vcache_score(i, valence[v]);
+        }
+        // next triangle is the best one using a vertex of the cache
+        best = -1;
+        float bestscore = -1.0f;
+        for (int i=0; i<nnew; i++) {
+            int v = newcache[i];
+            for (int j=0; j<valence[v]; j++) {
+                int t = adj[offset[v]+j];
+                float s = tscore[t] = vscore[ind[t*3]]+vscore[ind[t*3+1]]+vscore[ind[t*3+2]];
+                if (i<ncache && s>bestscore) {
+                    bestscore = s;
+                    best = t;
+                }
+            }
+        }
+    }
+    free(valence);
+    free(offset);
+    free(adj);
+    free(vscore);
+    free(tscore);
+    free(emitted);
+    // vertices in order of first use, for fetch locality
+    int *remap = pos;
+    for (int v=0; v<nverts; v++)
+        remap[v] = -1;
+    int next = 0;
+    for (int i=0; i<ntris*3; i++) {
+        int v = out[i];
+        if (remap[v]<0)
+            remap[v] = next++;
+        out[i] = remap[v];
+    }
+    for (int v=0; v<nverts; v++)
+        if (remap[v]<0)
+            remap[v] = next++;
+    int w;
+    GLfloat *tmp = (GLfloat*)malloc(nverts*4*sizeof(GLfloat));
+    for (int a=0; a<ARENA_ARRAYS; a++) {
+        GLfloat *p = *arena_array(list, a, &w);
+        if (!p)
+            continue;
+        for (int v=0; v<nverts; v++)
+            memcpy(tmp+remap[v]*w, p+v*w, w*sizeof(GLfloat));
+        memcpy(p, tmp, nverts*w*sizeof(GLfloat));
+    }
+    free(tmp);
+    free(pos);
+    memcpy(list->indices, out, ntris*3*sizeof(GLushort));
+    list->ilen = ntris*3;
+    free(out);
+}
+
+renderlist_t *optimize_renderlist(renderlist_t *list) {
+    if (!list || !gl_listopt)
+        return list;
+    while (list->prev) list = list->prev;
+    drop_redundant_states(list);
+    for (renderlist_t *l = list; l; l = l->next)
+        triangulate_renderlist(l);
+    merging_kept++;
+    merge_renderlists(list);
+    merging_kept--;
+    for (renderlist_t *l = list; l; l = l->next) {
+        weld_renderlist(l);
+        vcache_renderlist(l);
+    }
+    return list;
+}
+
+void compact_renderlist(renderlist_t *list) {
+    // shrink the buffers of a finished list to their used size, they only grow by doubling
+    if (!list)
+        return;
+    while (list->prev) list = list->prev;
+    for (; list; list = list->next) {
+        if (list->len && list->cap > list->len && list->arena && !list->shared_arrays && !list->framealloc)
+            layout_renderlist(list, list->len, NULL, false);
+        if (list->indices && list->indice_cap > list->ilen && list->ilen && !list->shared_indices) {
+            list->indices = (GLushort*)realloc(list->indices, list->ilen*sizeof(GLushort));
+            list->indice_cap = list->ilen;
+        }
+        if (list->calls.calls && list->calls.cap > list->calls.size && list->calls.size && !list->shared_calls) {
+            list->calls.calls = realloc(list->calls.calls, list->calls.size);
+            list->calls.cap = list->calls.size;
+        }
+    }
+}
+
+unsigned long memory_renderlist(renderlist_t *list, unsigned long *gpu) {
+    // approximate memory used by a list chain, in bytes (gpu gets the size of its GLES buffers and textures)
+    unsigned long size = 0;
+    if (!list)
+        return 0;
+    while (list->prev) list = list->prev;
+    for (; list; list = list->next) {
+        size += sizeof(renderlist_t);
+        size += list->arena_size*sizeof(GLfloat);
+        int w;
+        for (int i=0; i<ARENA_ARRAYS; i++) {
+            GLfloat **p = arena_array(list, i, &w);
+            if (*p && !inarena(list, *p))
+                size += list->cap*w*sizeof(GLfloat);
+        }
+        if (list->indices)
+            size += list->indice_cap*sizeof(GLushort);
+        size += list->calls.cap;
+        if (list->material)
+            size += kh_size(list->material)*sizeof(rendermaterial_t);
+        if (list->light)
+            size += kh_size(list->light)*sizeof(renderlight_t);
+        if (list->texgen)
+            size += kh_size(list->texgen)*sizeof(rendertexgen_t);
+        if (list->lightmodel)
+            size += 4*sizeof(GLfloat);
+        if (list->raster)
+            size += sizeof(rasterlist_t);
+        if (gpu) {
+            if (list->vbo_array)
+                *gpu += list->vbo_stride*list->len;
+            if (list->vbo_indices)
+                *gpu += list->ilen*sizeof(GLushort);
+            if (list->raster && list->raster->texture)
+                *gpu += list->raster->width*list->raster->height*4;
+        }
+    }
+    return size;
+}
+
+// glCallLists flattening: a sequence of lists made only of draws and glTranslatef (like the glyphs
+// of a text) is turned into a single renderlist, with the translations baked in the vertices
+// and applied once at the end. Results are cached on the sequence of list ids.
+#define FLAT_CACHE 16
+
+typedef struct {
+    GLuint *ids;            // NULL if the slot is free
+    GLsizei n;
+    unsigned int hash;
+    renderlist_t *list;     // NULL if the sequence cannot be flattened
+    GLboolean translated;   // the list ends with a translation, only valid on the modelview
+    unsigned long used;
+} flatlist_t;
+
+static flatlist_t flat_cache[FLAT_CACHE];
+static unsigned long flat_tick = 0;
+
+static bool flatten_translate(renderlist_t *list, GLfloat *t) {
+    // add the glTranslatef of the packed calls to t, false if there is any other call
+    packed_call_t *p;
+    call_list_foreach(&list->calls, p) {
+        if (p->func != &glshim_glTranslatef)
+            return false;
+        glTranslatef_PACKED *c = (glTranslatef_PACKED*)p;
+        t[0] += c->args.a1;
+        t[1] += c->args.a2;
+        t[2] += c->args.a3;
+    }
+    return true;
+}
+
+static renderlist_t *flatten_copy(renderlist_t *src, const GLfloat *t) {
+    // a static copy of the draw of src, moved by t
+    renderlist_t *list = alloc_renderlist();
+    list->mode = src->mode;
+    list->mode_init = src->mode_init;
+    list->polygon_mode = src->polygon_mode;
+    list->tmu = src->tmu;
+    list->len = src->len;
+    int w;
+    for (int i=0; i<ARENA_ARRAYS; i++)
+        *arena_array(list, i, &w) = *arena_array(src, i, &w);
+    layout_renderlist(list, src->len, NULL, true);
+    if (list->vert && (t[0] || t[1] || t[2])) {
+        for (int i=0; i<list->len; i++) {
+            GLfloat *v = list->vert+i*4;
+            v[0] += t[0]*v[3];
+            v[1] += t[1]*v[3];
+            v[2] += t[2]*v[3];
+        }
+    }
+    if (src->indices && src->ilen) {
+        list->indices = (GLushort*)malloc(src->ilen*sizeof(GLushort));
+        memcpy(list->indices, src->indices, src->ilen*sizeof(GLushort));
+        list->ilen = list->indice_cap = src->ilen;
+    }
+    memcpy(list->lastNormal, src->lastNormal, 3*sizeof(GLfloat));
+    memcpy(list->lastSecondaryColors, src->lastSecondaryColors, 3*sizeof(GLfloat));
+    memcpy(list->lastColors, src->lastColors, 4*sizeof(GLfloat));
+    list->stage = STAGE_DRAW;
+    list->open = false;
+    list->compiled = true;
+    return list;
+}
+
+static renderlist_t *flatten_build(GLsizei n, const GLuint *ids, GLboolean *translated) {
+    GLfloat t[3] = {0.0f, 0.0f, 0.0f};
+    renderlist_t *first = NULL, *last = NULL;
+    for (GLsizei i=0; i<n; i++) {
+        if (ids[i]-1 >= glstate.list.count)
+            continue;   // not a list, glCallList ignores it too
+        for (renderlist_t *l = glstate.lists[ids[i]-1]; l; l = l->next) {
+            if (l->open && end_renderlist(l)!=l)
+                break;  // l was an empty last list, and is gone
+            if (!isstateless_renderlist(l) || !flatten_translate(l, t)) {
+                free_renderlist(first);
+                return NULL;
+            }
+            if (!l->len || !l->mode_init)
+                continue;
+            renderlist_t *c = flatten_copy(l, t);
+            if (last && islistscompatible_renderlist(last, c)) {
+                append_renderlist(last, c);
+                free_renderlist(c);
+            } else {
+                if (last) {
+                    last->next = c;
+                    c->prev = last;
+                } else
+                    first = c;
+                last = c;
+            }
+        }
+    }
+    *translated = (t[0] || t[1] || t[2]);
+    if (*translated) {
+        renderlist_t *m = alloc_renderlist();
+        m->matrix_op = 2;
+        m->matrix_val[12] = t[0];
+        m->matrix_val[13] = t[1];
+        m->matrix_val[14] = t[2];
+        m->stage = STAGE_MATRIX;
+        m->open = false;
+        if (last) {
+            last->next = m;
+            m->prev = last;
+        } else
+            first = m;
+    }
+    return first;
+}
+
+renderlist_t *flatten_calllists(GLsizei n, const GLuint *ids) {
+    unsigned int hash = 2166136261u;
+    for (GLsizei i=0; i<n; i++)
+        hash = (hash ^ ids[i]) * 16777619u;
+    flatlist_t *slot = NULL, *old = flat_cache;
+    for (int i=0; i<FLAT_CACHE && !slot; i++) {
+        flatlist_t *f = flat_cache+i;
+        if (f->ids && f->n==n && f->hash==hash && !memcmp(f->ids, ids, n*sizeof(GLuint)))
+            slot = f;
+        else if (old->ids && (!f->ids || f->used<old->used))
+            old = f;
+    }
+    if (!slot) {
+        // least recently used one goes
+        slot = old;
+        free_renderlist(slot->list);
+        free(slot->ids);
+        slot->ids = (GLuint*)malloc(n*sizeof(GLuint));
+        memcpy(slot->ids, ids, n*sizeof(GLuint));
+        slot->n = n;
+        slot->hash = hash;
+        // the copies must outlive the frame
+        GLuint batchalloc = gl_batchalloc;
+        gl_batchalloc = 0;
+        merging_kept++;
+        slot->list = flatten_build(n, ids, &slot->translated);
+        merging_kept--;
+        gl_batchalloc = batchalloc;
+    }
+    slot->used = ++flat_tick;
+    if (slot->list && slot->translated) {
+        GLint mode;
+        glshim_glGetIntegerv(GL_MATRIX_MODE, &mode);
+        if (mode != GL_MODELVIEW)
+            return NULL;
+    }
+    return slot->list;
+}
+
+void flatten_invalidate() {
+    // lists have changed, forget everything
+    for (int i=0; i<FLAT_CACHE; i++) {
+        free_renderlist(flat_cache[i].list);
+        free(flat_cache[i].ids);
+        memset(flat_cache+i, 0, sizeof(flatlist_t));
+    }
+}
+
 void free_renderlist(renderlist_t *list) {
 	// test if list is NULL
 	if (list == NULL)
@@ -588,29 +1483,25 @@ void free_renderlist(renderlist_t *list) {
     while (list->prev)
         list = list->prev;
 
+    LOAD_GLES(glDeleteBuffers);
     renderlist_t *next;
     do {
         if ((list->calls.cap > 0) && (!list->shared_calls || ((*list->shared_calls)--)==0)) {
             if(list->shared_calls) free(list->shared_calls);
-            for (int i = 0; i < list->calls.len; i++) {
-                free(list->calls.calls[i]);
-            }
             free(list->calls.calls);
         }
-        int a;
         if (!list->shared_arrays || ((*list->shared_arrays)--)==0) {
             if (list->shared_arrays) free(list->shared_arrays);
-            if (list->vert) free(list->vert);
-            if (list->normal) free(list->normal);
-            if (list->color) free(list->color);
-            if (list->secondary) free(list->secondary);
-            for (a=0; a<MAX_TEX; a++)
-                if (list->tex[a]) free(list->tex[a]);
+            free_arrays(list);
+            if (list->vbo_array)
+                gles_glDeleteBuffers(1, &list->vbo_array);
         }
         if (!list->shared_indices || ((*list->shared_indices)--)==0) {
             if (list->shared_indices) free(list->shared_indices);
             if (list->indices)
                 free(list->indices);
+            if (list->vbo_indices)
+                gles_glDeleteBuffers(1, &list->vbo_indices);
         }
 
         if (list->material) {
@@ -644,22 +1535,32 @@ void free_renderlist(renderlist_t *list) {
 		}
 
         next = list->next;
-        free(list);
+        if (list->framealloc)
+            frame_unref();
+        frame_free(list);
     } while ((list = next));
 }
 
 void resize_renderlist(renderlist_t *list) {
     if (list->len >= list->cap) {
-        list->cap += DEFAULT_RENDER_LIST_CAPACITY;
-        realloc_sublist(list->vert, 4, list->cap);
-        realloc_sublist(list->normal, 3, list->cap);
-        realloc_sublist(list->color, 4, list->cap);
-        realloc_sublist(list->secondary, 4, list->cap);
-        for (int a=0; a<MAX_TEX; a++)
-           realloc_sublist(list->tex[a], 4, list->cap);
+        layout_renderlist(list, (list->cap)?list->cap*2:DEFAULT_RENDER_LIST_CAPACITY, NULL, false);
     }
 }
 
+static gltexture_t *adjust_bound(renderlist_t *list, int tmu) {
+	gltexture_t *bound = glstate.texture.bound[tmu];
+    // in case of Texture bounding inside a list
+    if (list->set_texture && (list->tmu == tmu))
+        bound = glshim_getTexture(list->target_texture, list->texture);
+    return bound;
+}
+
+bool isadjusted_renderlist(renderlist_t *list, int tmu) {
+    // adjust_renderlist will change the tex_coord of the unit (npot or rectangle texture)
+    gltexture_t *bound = adjust_bound(list, tmu);
+    return bound && ((bound->width != bound->nwidth) || (bound->height != bound->nheight) || glstate.texture.rect_arb[tmu]);
+}
+
 void adjust_renderlist(renderlist_t *list) {
     if (! list->open)
         return;
@@ -667,10 +1568,7 @@ void adjust_renderlist(renderlist_t *list) {
     list->stage = STAGE_LAST;
     list->open = false;
     for (int a=0; a<MAX_TEX; a++) {
-	    gltexture_t *bound = glstate.texture.bound[a];
-        // in case of Texture bounding inside a list
-        if (list->set_texture && (list->tmu == a))
-            bound = glshim_getTexture(list->target_texture, list->texture);
+	    gltexture_t *bound = adjust_bound(list, a);
         // adjust the tex_coord now
 	    if ((list->tex[a]) && (bound) && ((bound->width != bound->nwidth) || (bound->height != bound->nheight))) {
 		    tex_coord_npot(list->tex[a], list->len, bound->width, bound->height, bound->nwidth, bound->nheight);
@@ -714,26 +1612,123 @@ renderlist_t* end_renderlist(renderlist_t *list) {
     return list;
 }
 
+extern GLuint gl_listvbo;
+
+static int real_size(GLfloat *array, int len, int min) {
+    // number of components really used in a 4 components array (w/q at 1, z/r at 0 are default values)
+    int size = min;
+    for (int i=0; i<len && size<4; i++, array+=4) {
+        if (array[3]!=1.0f)
+            size = 4;
+        else if (size<3 && array[2]!=0.0f)
+            size = 3;
+    }
+    return size;
+}
+
+void upload_renderlist(renderlist_t *list) {
+    // put the arrays of a closed, compiled list in GLES buffers, so they are not send again on each draw
+    // the CPU arrays are kept, for texgen, select mode and further merges
+    if (!gl_listvbo || list->open || !list->len)
+        return;
+    LOAD_GLES(glGenBuffers);
+    LOAD_GLES(glBindBuffer);
+    LOAD_GLES(glBufferData);
+    // arrays used by a copy of the list cannot get a buffer, or it will not follow the copy
+    if (!list->vbo_array && (!list->shared_arrays || *list->shared_arrays==0)) {
+        // interleave the arrays, so one vertex is in one contiguous block on the GPU
+        // and keep only the components really used: colors as RGBA8, no w / r / q if they are default
+        GLsizei stride = 0;
+        list->vbo_vert = list->vbo_normal = list->vbo_color = -1;
+        if (list->vert) {
+            list->vbo_vert = stride;
+            list->vbo_vert_size = real_size(list->vert, list->len, 3);
+            stride += list->vbo_vert_size*sizeof(GLfloat);
+        }
+        if (list->normal) {
+            list->vbo_normal = stride;
+            stride += 3*sizeof(GLfloat);
+        }
+        if (list->color) {
+            list->vbo_color = stride;
+            stride += 4*sizeof(GLubyte);
+        }
+        for (int a=0; a<MAX_TEX; a++) {
+            list->vbo_tex[a] = -1;
+            if (list->tex[a]) {
+                list->vbo_tex[a] = stride;
+                list->vbo_tex_size[a] = real_size(list->tex[a], list->len, 2);
+                stride += list->vbo_tex_size[a]*sizeof(GLfloat);
+            }
+        }
+        char *data = (char*)malloc(stride*list->len);
+        char *dst = data;
+        for (int i=0; i<list->len; i++) {
+            #define PROCESS(W, N, R) \
+                if (list->W) { memcpy(dst, list->W+i*N, R*sizeof(GLfloat)); dst += R*sizeof(GLfloat); }
+            PROCESS(vert, 4, list->vbo_vert_size);
+            PROCESS(normal, 3, 3);
+            if (list->color) {
+                for (int j=0; j<4; j++) {
+                    GLfloat c = list->color[i*4+j];
+                    dst[j] = (c<=0.0f)?0:(c>=1.0f)?255:(GLubyte)(c*255.0f+0.5f);
+                }
+                dst += 4;
+            }
+            for (int a=0; a<MAX_TEX; a++)
+                PROCESS(tex[a], 4, list->vbo_tex_size[a]);
+            #undef PROCESS
+        }
+        list->vbo_stride = stride;
+        gles_glGenBuffers(1, &list->vbo_array);
+        gles_glBindBuffer(GL_ARRAY_BUFFER, list->vbo_array);
+        gles_glBufferData(GL_ARRAY_BUFFER, stride*list->len, data, GL_STATIC_DRAW);
+        gles_glBindBuffer(GL_ARRAY_BUFFER, 0);
+        free(data);
+    }
+    if (list->indices && !list->vbo_indices && (!list->shared_indices || *list->shared_indices==0)) {
+        gles_glGenBuffers(1, &list->vbo_indices);
+        gles_glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, list->vbo_indices);
+        gles_glBufferData(GL_ELEMENT_ARRAY_BUFFER, list->ilen*sizeof(GLushort), list->indices, GL_STATIC_DRAW);
+        gles_glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+    }
+}
+
+static const GLvoid *vbo_pointer(renderlist_t *list, const GLvoid *data, GLintptr offset, GLuint *bound, GLsizei *stride) {
+    // bind the list VBO if the array is inside, unbind it for client side arrays
+    LOAD_GLES(glBindBuffer);
+    GLuint wanted = (list->vbo_array && offset!=-1)?list->vbo_array:0;
+    if (*bound != wanted) {
+        gles_glBindBuffer(GL_ARRAY_BUFFER, wanted);
+        *bound = wanted;
+    }
+    *stride = (wanted)?list->vbo_stride:0;
+    return (wanted)?(const GLvoid*)offset:data;
+}
+
 void draw_renderlist(renderlist_t *list) {
     if (!list) return;
     // go to 1st...
     while (list->prev) list = list->prev;
     // ok, go on now, draw everything
 //printf("draw_renderlist %p, gl_batch=%i, size=%i, mode=%s(%s), ilen=%d, next=%p, color=%p, secondarycolor=%p\n", list, glstate.gl_batch, list->len, PrintEnum(list->mode), PrintEnum(list->mode_init), list->ilen, list->next, list->color, list->secondary);
-    LOAD_GLES(glDrawArrays);
-    LOAD_GLES(glDrawElements);
+    LOAD_GLES_NOSYNC(glDrawArrays);
+    LOAD_GLES_NOSYNC(glDrawElements);
 #ifdef USE_ES2
-    LOAD_GLES(glVertexAttribPointer);
+    LOAD_GLES_NOSYNC(glVertexAttribPointer);
 #else
-    LOAD_GLES(glVertexPointer);
-    LOAD_GLES(glNormalPointer);
-    LOAD_GLES(glColorPointer);
-    LOAD_GLES(glTexCoordPointer);
+    LOAD_GLES_NOSYNC(glVertexPointer);
+    LOAD_GLES_NOSYNC(glNormalPointer);
+    LOAD_GLES_NOSYNC(glColorPointer);
+    LOAD_GLES_NOSYNC(glTexCoordPointer);
 #endif
-    LOAD_GLES(glEnable);
-    LOAD_GLES(glDisable);
-    LOAD_GLES(glEnableClientState);
-    LOAD_GLES(glDisableClientState);
+    LOAD_GLES_NOSYNC(glEnable);
+    LOAD_GLES_NOSYNC(glDisable);
+    LOAD_GLES_NOSYNC(glEnableClientState);
+    LOAD_GLES_NOSYNC(glDisableClientState);
+    LOAD_GLES_NOSYNC(glBindBuffer);
+    thread_sync();
+    texdirty_sync();
     glshim_glPushClientAttrib(GL_CLIENT_VERTEX_ARRAY_BIT);
 
 	GLfloat *final_colors;
@@ -743,6 +1738,8 @@ void draw_renderlist(renderlist_t *list) {
         // close if needed!
         if (list->open)
             list = end_renderlist(list);
+        if (list->compiled && !list->vbo_array)
+            upload_renderlist(list);
         // push/pop attributes
         if (list->pushattribute)
             glshim_glPushAttrib(list->pushattribute);
@@ -750,8 +1747,9 @@ void draw_renderlist(renderlist_t *list) {
             glshim_glPopAttrib();
         call_list_t *cl = &list->calls;
         if (cl->len > 0) {
-            for (int i = 0; i < cl->len; i++) {
-                glPackedCall(cl->calls[i]);
+            packed_call_t *p;
+            call_list_foreach(cl, p) {
+                glPackedCall(p);
             }
         }
         if (list->fog_op) {
@@ -844,9 +1842,13 @@ void draw_renderlist(renderlist_t *list) {
         }
         gles_glDrawArrays(list->mode, 0, list->len);
 #else
+        GLuint vbo_bound = 0;
+        GLsizei stride;
+        const GLvoid *ptr;
         if (list->vert) {
             gles_glEnableClientState(GL_VERTEX_ARRAY);
-            gles_glVertexPointer(4, GL_FLOAT, 0, list->vert);
+            ptr = vbo_pointer(list, list->vert, list->vbo_vert, &vbo_bound, &stride);
+            gles_glVertexPointer((vbo_bound)?list->vbo_vert_size:4, GL_FLOAT, stride, ptr);
             glstate.clientstate.vertex_array = 1;
         } else {
             gles_glDisableClientState(GL_VERTEX_ARRAY);
@@ -855,7 +1857,8 @@ void draw_renderlist(renderlist_t *list) {
 
         if (list->normal) {
             gles_glEnableClientState(GL_NORMAL_ARRAY);
-            gles_glNormalPointer(GL_FLOAT, 0, list->normal);
+            ptr = vbo_pointer(list, list->normal, list->vbo_normal, &vbo_bound, &stride);
+            gles_glNormalPointer(GL_FLOAT, stride, ptr);
             glstate.clientstate.normal_array = 1;
         } else {
             gles_glDisableClientState(GL_NORMAL_ARRAY);
@@ -880,10 +1883,12 @@ void draw_renderlist(renderlist_t *list) {
 					for (int i=0; i<list->len*4; i++)
 						final_colors[i]=list->color[i] + list->secondary[i];
 				}
-				gles_glColorPointer(4, GL_FLOAT, 0, final_colors);
+				ptr = vbo_pointer(list, final_colors, -1, &vbo_bound, &stride);
+				gles_glColorPointer(4, GL_FLOAT, stride, ptr);
 			} else {
 //printf("colors=%f, %f, %f, %f / %f, %f, %f, %f\n", list->color[0],list->color[1],list->color[2],list->color[3], list->color[4],list->color[5],list->color[6],list->color[7]);
-				gles_glColorPointer(4, GL_FLOAT, 0, list->color);
+				ptr = vbo_pointer(list, list->color, list->vbo_color, &vbo_bound, &stride);
+				gles_glColorPointer(4, (vbo_bound)?GL_UNSIGNED_BYTE:GL_FLOAT, stride, ptr);
             }
         } else {
             gles_glDisableClientState(GL_COLOR_ARRAY);
@@ -920,7 +1925,8 @@ void draw_renderlist(renderlist_t *list) {
                 glshim_glClientActiveTexture(GL_TEXTURE0+a);
                 gles_glEnableClientState(GL_TEXTURE_COORD_ARRAY);
                 glstate.clientstate.tex_coord_array[a] = 1;
-		        gles_glTexCoordPointer(4, GL_FLOAT, 0, (texgened[a])?texgened[a]:list->tex[a]);
+		        ptr = (texgened[a])?vbo_pointer(list, texgened[a], -1, &vbo_bound, &stride):vbo_pointer(list, list->tex[a], list->vbo_tex[a], &vbo_bound, &stride);
+		        gles_glTexCoordPointer((vbo_bound)?list->vbo_tex_size[a]:4, GL_FLOAT, stride, ptr);
 		    } else {
                 if (glstate.clientstate.tex_coord_array[a]) {
                     glshim_glClientActiveTexture(GL_TEXTURE0+a);
@@ -1034,6 +2040,10 @@ void draw_renderlist(renderlist_t *list) {
                             break;
                     }
                     gles_glDrawElements(mode, k, GL_UNSIGNED_SHORT, ind_line);
+                } else if (list->vbo_indices) {
+                    gles_glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, list->vbo_indices);
+                    gles_glDrawElements(mode, list->ilen, GL_UNSIGNED_SHORT, 0);
+                    gles_glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
                 } else {
                     gles_glDrawElements(mode, list->ilen, GL_UNSIGNED_SHORT, indices);
                 }
@@ -1149,6 +2159,9 @@ void draw_renderlist(renderlist_t *list) {
         }
         if (glstate.texture.client!=old_tex)
             glshim_glClientActiveTexture(old_tex+GL_TEXTURE0);
+        // the rest of glshim use client side arrays
+        if (vbo_bound)
+            gles_glBindBuffer(GL_ARRAY_BUFFER, 0);
 
 		if (final_colors)
 			free(final_colors);
@@ -1164,10 +2177,9 @@ void draw_renderlist(renderlist_t *list) {
 
 void FASTMATH rlVertex4f(renderlist_t *list, GLfloat x, GLfloat y, GLfloat z, GLfloat w) {
     if (list->vert == NULL) {
-        list->vert = alloc_sublist(4, list->cap);
-    } else {
-        resize_renderlist(list);
+        layout_renderlist(list, list->cap, &list->vert, false);
     }
+    resize_renderlist(list);
 
     if (list->normal) {
         GLfloat * const normal = list->normal + (list->len * 3);
@@ -1197,7 +2209,7 @@ void FASTMATH rlVertex4f(renderlist_t *list, GLfloat x, GLfloat y, GLfloat z, GL
 
 void rlNormal3f(renderlist_t *list, GLfloat x, GLfloat y, GLfloat z) {
     if (list->normal == NULL) {
-        list->normal = alloc_sublist(3, list->cap);
+        layout_renderlist(list, list->cap, &list->normal, false);
         // catch up
         int i;
         if (list->len) for (i = 0; i < list->len; i++) {
@@ -1212,7 +2224,7 @@ void rlNormal3f(renderlist_t *list, GLfloat x, GLfloat y, GLfloat z) {
 
 void rlColor4f(renderlist_t *list, GLfloat r, GLfloat g, GLfloat b, GLfloat a) {
     if (list->color == NULL) {
-        list->color = alloc_sublist(4, list->cap);
+        layout_renderlist(list, list->cap, &list->color, false);
         // catch up
         int i;
         if (list->len) for (i = 0; i < list->len; i++) {
@@ -1230,7 +2242,7 @@ void rlColor4f(renderlist_t *list, GLfloat r, GLfloat g, GLfloat b, GLfloat a) {
 
 void rlSecondary3f(renderlist_t *list, GLfloat r, GLfloat g, GLfloat b) {
     if (list->secondary == NULL) {
-        list->secondary = alloc_sublist(4, list->cap);
+        layout_renderlist(list, list->cap, &list->secondary, false);
         // catch up
         int i;
         if (list->len) for (i = 0; i < list->len; i++) {
@@ -1335,7 +2347,7 @@ void rlTexGenfv(renderlist_t *list, GLenum coord, GLenum pname, const GLfloat *
 
 void rlTexCoord4f(renderlist_t *list, GLfloat s, GLfloat t, GLfloat r, GLfloat q) {
     if (list->tex[0] == NULL) {
-        list->tex[0] = alloc_sublist(4, list->cap);
+        layout_renderlist(list, list->cap, &list->tex[0], false);
         // catch up
         GLfloat *tex = list->tex[0];
         if (list->len) for (int i = 0; i < list->len; i++) {
@@ -1351,7 +2363,7 @@ void rlTexCoord4f(renderlist_t *list, GLfloat s, GLfloat t, GLfloat r, GLfloat q
 void rlMultiTexCoord4f(renderlist_t *list, GLenum target, GLfloat s, GLfloat t, GLfloat r, GLfloat q) {
     const int tmu = target - GL_TEXTURE0;
     if (list->tex[tmu] == NULL) {
-        list->tex[tmu] = alloc_sublist(4, list->cap);
+        layout_renderlist(list, list->cap, &list->tex[tmu], false);
         // catch up
         GLfloat *tex = list->tex[tmu];
         if (list->len) for (int i = 0; i < list->len; i++) {
@@ -1391,15 +2403,23 @@ void rlFogOp(renderlist_t *list, int op, const GLfloat* v) {
 }
 
 void rlPushCall(renderlist_t *list, packed_call_t *data) {
+    // copy the call in the list buffer
     call_list_t *cl = &list->calls;
+    unsigned int rsize = glSizeofPackedCall(data);
+    unsigned int size = (CALL_HEADER + rsize + 7) & ~7;
     if (!cl->calls) {
         cl->cap = DEFAULT_CALL_LIST_CAPACITY;
-        cl->calls = malloc(DEFAULT_CALL_LIST_CAPACITY * sizeof(void*));
-    } else if (list->calls.len == list->calls.cap) {
-        cl->cap += DEFAULT_CALL_LIST_CAPACITY;
-        cl->calls = realloc(cl->calls, cl->cap * sizeof(void*));
+        cl->calls = malloc(cl->cap);
+    }
+    if (cl->size + size > cl->cap) {
+        while (cl->size + size > cl->cap)
+            cl->cap *= 2;
+        cl->calls = realloc(cl->calls, cl->cap);
     }
-    cl->calls[cl->len++] = data;
+    *(unsigned int*)(cl->calls + cl->size) = size;
+    memcpy(cl->calls + cl->size + CALL_HEADER, data, rsize);
+    cl->size += size;
+    cl->len++;
 }
 
 renderlist_t* GetFirst(renderlist_t* list) {
@@ -1408,5 +2428,4 @@ renderlist_t* GetFirst(renderlist_t* list) {
     return list;
 }
 
-#undef alloc_sublist
-#undef realloc_sublist
+#undef ARENA_ARRAYS
@@ -81,12 +81,19 @@ KHASH_MAP_INIT_INT(material, rendermaterial_t *)
 KHASH_MAP_INIT_INT(light, renderlight_t *)
 KHASH_MAP_INIT_INT(texgen, rendertexgen_t *)
 
+// packed calls are stored one after the other in a single buffer
+// each one prefixed by its (aligned) record size
 typedef struct _call_list_t {
-    unsigned long len;
-    unsigned long cap;
-    packed_call_t **calls;
+    unsigned long len;      // number of calls
+    unsigned long cap;      // size of the buffer, in bytes
+    unsigned long size;     // used size, in bytes
+    char *calls;
 } call_list_t;
 
+#define CALL_HEADER 8
+#define call_list_foreach(cl, p) \
+    for (char *_c = (cl)->calls; (_c < (cl)->calls+(cl)->size) && ((p = (packed_call_t*)(_c+CALL_HEADER))); _c += *(unsigned int*)_c)
+
 typedef struct _renderlist_t {
     unsigned long len;
     unsigned long ilen;
@@ -101,6 +108,8 @@ typedef struct _renderlist_t {
     call_list_t calls;
     
     int *shared_arrays;
+    GLfloat *arena;         // single allocation holding all the arrays below
+    unsigned long arena_size;   // in GLfloat
     GLfloat *vert;
     GLfloat *normal;
     GLfloat *color;
@@ -140,9 +149,20 @@ typedef struct _renderlist_t {
     struct _renderlist_t *prev;
     struct _renderlist_t *next;
     GLboolean open;
+    GLboolean compiled;     // part of a glNewList / glEndList list
+    GLboolean framealloc;   // allocated in the per-frame pool (batch mode)
+    GLuint vbo_array;       // GLES buffer with the arrays, once uploaded
+    GLuint vbo_indices;     // GLES buffer with the indices, once uploaded
+    GLintptr vbo_vert;      // offsets inside vbo_array (-1 if not inside)
+    GLintptr vbo_normal;
+    GLintptr vbo_color;
+    GLintptr vbo_tex[MAX_TEX];
+    GLsizei vbo_stride;     // arrays are interleaved inside vbo_array
+    GLint vbo_vert_size;    // real number of components in vbo_array (colors are RGBA8)
+    GLint vbo_tex_size[MAX_TEX];
 } renderlist_t;
 
-#define DEFAULT_CALL_LIST_CAPACITY 20
+#define DEFAULT_CALL_LIST_CAPACITY 512    // in bytes
 #define DEFAULT_RENDER_LIST_CAPACITY 64
 
 #define NewStage(l, s) if (l->stage+StageExclusive[l->stage] > s) {l = extend_renderlist(l);} l->stage = s
@@ -153,7 +173,16 @@ renderlist_t *alloc_renderlist();
 renderlist_t *extend_renderlist(renderlist_t *list);
 void free_renderlist(renderlist_t *list);
 void draw_renderlist(renderlist_t *list);
+void layout_renderlist(renderlist_t *list, unsigned long cap, GLfloat **add, bool shared);
+void upload_renderlist(renderlist_t *list);
 renderlist_t* end_renderlist(renderlist_t *list);
+bool isadjusted_renderlist(renderlist_t *list, int tmu);
+renderlist_t *sort_renderlist(renderlist_t *list);
+renderlist_t *optimize_renderlist(renderlist_t *list);
+void compact_renderlist(renderlist_t *list);
+unsigned long memory_renderlist(renderlist_t *list, unsigned long *gpu);
+renderlist_t *flatten_calllists(GLsizei n, const GLuint *ids);
+void flatten_invalidate();
 
 void rlActiveTexture(renderlist_t *list, GLenum texture );
 void rlBindTexture(renderlist_t *list, GLenum target, GLuint texture);
@@ -13,6 +13,15 @@ extern void *gles, *egl, *bcm_host, *vcos;
 
 extern void *open_lib(const char **names, const char *override);
 extern void load_libs();
+extern void *shadow_proc(const char *name, void *proc);
+extern volatile int thread_pending;
+extern void thread_wait();
+
+// GLES is about to be used, get the context back if it was lent to the swap thread
+static inline void thread_sync() {
+    if (thread_pending)
+        thread_wait();
+}
 
 #ifndef WARN_NULL
 #define WARN_NULL(name) if (name == NULL) printf("libGL: warning, " #name " is NULL\n");
@@ -38,18 +47,23 @@ extern void load_libs();
 
 #define LOAD_LIB(lib, name) DEFINE_RAW(lib, name); LOAD_RAW(lib, name, dlsym(lib, #name))
 
+// the _NOSYNC versions leave the thread_sync() to the caller, before its first GLES call
+// (the wrappers only need it once they know the call is not recorded in a list)
 #ifndef LOAD_GLES
+#define LOAD_GLES_NOSYNC(name) \
+    DEFINE_RAW(gles, name); LOAD_RAW(gles, name, shadow_proc(#name, dlsym(gles, #name)))
 #define LOAD_GLES(name) \
-    LOAD_LIB(gles, name)
-    
+    LOAD_GLES_NOSYNC(name); thread_sync()
 #endif
 
 #define LOAD_EGL(name) LOAD_LIB(egl, name)
-#define LOAD_GLES_OES(name) \
+#define LOAD_GLES_OES_NOSYNC(name) \
     DEFINE_RAW(gles, name); \
     { \
         LOAD_EGL(eglGetProcAddress); \
-        LOAD_RAW(gles, name, egl_eglGetProcAddress(#name"OES")); \
+        LOAD_RAW(gles, name, shadow_proc(#name, egl_eglGetProcAddress(#name"OES"))); \
     }
+#define LOAD_GLES_OES(name) \
+    LOAD_GLES_OES_NOSYNC(name); thread_sync()
 
 #endif
@@ -1,5 +1,6 @@
 #include "pixel.h"
 #include "debug.h"
+#include "pool.h"
 
 static const colorlayout_t *get_color_map(GLenum format) {
     #define map(fmt, ...)                               \
@@ -661,15 +662,211 @@ bool quarter_pixel(const GLvoid *src[16],
     #undef write_each
 }
 
-bool pixel_convert(const GLvoid *src, GLvoid **dst,
+// Row kernels for the common conversions: one plain loop per row, no per pixel
+// switch, so they stay memory bound (and the compiler can vectorize them)
+typedef void (*row_kernel_t)(const GLubyte *src, GLubyte *dst, GLuint width);
+
+static void row_swap_rb(const GLubyte *src, GLubyte *dst, GLuint width) {
+    const GLuint *s = (const GLuint *)src;
+    GLuint *d = (GLuint *)dst;
+    for (GLuint i = 0; i < width; i++) {
+        GLuint v = s[i];
+        d[i] = (v & 0xff00ff00) | ((v & 0x00ff0000) >> 16) | ((v & 0x000000ff) << 16);
+    }
+}
+static void row_rgb_rgba(const GLubyte *src, GLubyte *dst, GLuint width) {
+    for (GLuint i = 0; i < width; i++) {
+        dst[i*4+0] = src[i*3+0];
+        dst[i*4+1] = src[i*3+1];
+        dst[i*4+2] = src[i*3+2];
+        dst[i*4+3] = 255;
+    }
+}
+static void row_bgr_rgba(const GLubyte *src, GLubyte *dst, GLuint width) {
+    for (GLuint i = 0; i < width; i++) {
+        dst[i*4+0] = src[i*3+2];
+        dst[i*4+1] = src[i*3+1];
+        dst[i*4+2] = src[i*3+0];
+        dst[i*4+3] = 255;
+    }
+}
+static void row_rgba_rgb(const GLubyte *src, GLubyte *dst, GLuint width) {
+    for (GLuint i = 0; i < width; i++) {
+        dst[i*3+0] = src[i*4+0];
+        dst[i*3+1] = src[i*4+1];
+        dst[i*3+2] = src[i*4+2];
+    }
+}
+static void row_bgra_rgb(const GLubyte *src, GLubyte *dst, GLuint width) {
+    for (GLuint i = 0; i < width; i++) {
+        dst[i*3+0] = src[i*4+2];
+        dst[i*3+1] = src[i*4+1];
+        dst[i*3+2] = src[i*4+0];
+    }
+}
+static void row_bgr_rgb(const GLubyte *src, GLubyte *dst, GLuint width) {
+    for (GLuint i = 0; i < width; i++) {
+        dst[i*3+0] = src[i*3+2];
+        dst[i*3+1] = src[i*3+1];
+        dst[i*3+2] = src[i*3+0];
+    }
+}
+static void row_la_rgba(const GLubyte *src, GLubyte *dst, GLuint width) {
+    for (GLuint i = 0; i < width; i++) {
+        dst[i*4+0] = dst[i*4+1] = dst[i*4+2] = src[i*2+0];
+        dst[i*4+3] = src[i*2+1];
+    }
+}
+static void row_l_rgba(const GLubyte *src, GLubyte *dst, GLuint width) {
+    for (GLuint i = 0; i < width; i++) {
+        dst[i*4+0] = dst[i*4+1] = dst[i*4+2] = src[i];
+        dst[i*4+3] = 255;
+    }
+}
+// r, g, b are the byte offsets of the color channels in the source pixel
+#define row_luminance(name, size, r, g, b, alpha)                                          \
+static void name(const GLubyte *src, GLubyte *dst, GLuint width) {                       \
+    for (GLuint i = 0; i < width; i++) {                                                  \
+        const GLubyte *s = src + i*size;                                                  \
+        if (alpha) {                                                                      \
+            dst[i*2+0] = (s[r]*77 + s[g]*151 + s[b]*28) >> 8;                             \
+            dst[i*2+1] = s[3];                                                            \
+        } else                                                                            \
+            dst[i] = (s[r]*77 + s[g]*151 + s[b]*28) >> 8;                                 \
+    }                                                                                     \
+}
+row_luminance(row_rgba_la, 4, 0, 1, 2, 1)
+row_luminance(row_bgra_la, 4, 2, 1, 0, 1)
+row_luminance(row_rgba_l, 4, 0, 1, 2, 0)
+row_luminance(row_bgra_l, 4, 2, 1, 0, 0)
+row_luminance(row_rgb_l, 3, 0, 1, 2, 0)
+row_luminance(row_bgr_l, 3, 2, 1, 0, 0)
+#undef row_luminance
+// packing of 8 bits channels in a GLES 16 bits type
+#define row_pack(name, size, r, g, b, a, pack)                                            \
+static void name(const GLubyte *src, GLubyte *dst, GLuint width) {                       \
+    GLushort *d = (GLushort *)dst;                                                        \
+    for (GLuint i = 0; i < width; i++) {                                                  \
+        const GLubyte *s = src + i*size;                                                  \
+        d[i] = pack(r, g, b, a);                                                          \
+    }                                                                                     \
+}
+#define pack_565(r, g, b, a)  ((s[r] & 0xf8) << 8) | ((s[g] & 0xfc) << 3) | (s[b] >> 3)
+#define pack_5551(r, g, b, a) ((s[r] & 0xf8) << 8) | ((s[g] & 0xf8) << 3) | ((s[b] & 0xf8) >> 2) | (s[a] >> 7)
+#define pack_4444(r, g, b, a) ((s[r] & 0xf0) << 8) | ((s[g] & 0xf0) << 4) | (s[b] & 0xf0) | (s[a] >> 4)
+row_pack(row_rgb_565, 3, 0, 1, 2, 0, pack_565)
+row_pack(row_bgr_565, 3, 2, 1, 0, 0, pack_565)
+row_pack(row_rgba_565, 4, 0, 1, 2, 3, pack_565)
+row_pack(row_bgra_565, 4, 2, 1, 0, 3, pack_565)
+row_pack(row_rgba_5551, 4, 0, 1, 2, 3, pack_5551)
+row_pack(row_bgra_5551, 4, 2, 1, 0, 3, pack_5551)
+row_pack(row_rgba_4444, 4, 0, 1, 2, 3, pack_4444)
+row_pack(row_bgra_4444, 4, 2, 1, 0, 3, pack_4444)
+#undef pack_565
+#undef pack_5551
+#undef pack_4444
+#undef row_pack
+// desktop 16 bits types to the GLES ones
+#define row_short(name, conv)                                                             \
+static void name(const GLubyte *src, GLubyte *dst, GLuint width) {                       \
+    const GLushort *s = (const GLushort *)src;                                            \
+    GLushort *d = (GLushort *)dst;                                                        \
+    for (GLuint i = 0; i < width; i++) {                                                  \
+        GLushort v = s[i];                                                                \
+        d[i] = conv;                                                                      \
+    }                                                                                     \
+}
+row_short(row_bgra4444rev_4444, ((v & 0x0fff) << 4) | (v >> 12))
+row_short(row_rgba4444rev_4444, ((v & 0x000f) << 12) | ((v & 0x00f0) << 4) | ((v & 0x0f00) >> 4) | (v >> 12))
+row_short(row_bgra1555rev_5551, ((v & 0x7fff) << 1) | (v >> 15))
+row_short(row_rgba1555rev_5551, ((v & 0x001f) << 11) | ((v & 0x03e0) << 1) | ((v & 0x7c00) >> 9) | (v >> 15))
+row_short(row_rgb565rev_565, ((v & 0x001f) << 11) | (v & 0x07e0) | (v >> 11))
+#undef row_short
+static void row_float_ubyte(const GLubyte *src, GLubyte *dst, GLuint width) {
+    const GLfloat *s = (const GLfloat *)src;
+    for (GLuint i = 0; i < width; i++) {
+        GLfloat v = s[i];
+        dst[i] = (v <= 0.0f) ? 0 : (v >= 1.0f) ? 255 : (GLubyte)(v * 255.0f + 0.5f);
+    }
+}
+static void row_ubyte_float(const GLubyte *src, GLubyte *dst, GLuint width) {
+    GLfloat *d = (GLfloat *)dst;
+    for (GLuint i = 0; i < width; i++)
+        d[i] = src[i] / 255.0f;
+}
+
+typedef struct {
+    GLenum src_format, src_type;
+    GLenum dst_format, dst_type;
+    GLuint channels;    // width is multiplied by this (for the per channel kernels)
+    row_kernel_t kernel;
+} row_kernel_entry_t;
+
+static const row_kernel_entry_t row_kernels[] = {
+    // texture uploads
+    {GL_BGRA, GL_UNSIGNED_BYTE, GL_RGBA, GL_UNSIGNED_BYTE, 1, row_swap_rb},
+    {GL_RGB, GL_UNSIGNED_BYTE, GL_RGBA, GL_UNSIGNED_BYTE, 1, row_rgb_rgba},
+    {GL_BGR, GL_UNSIGNED_BYTE, GL_RGBA, GL_UNSIGNED_BYTE, 1, row_bgr_rgba},
+    {GL_BGR, GL_UNSIGNED_BYTE, GL_RGB, GL_UNSIGNED_BYTE, 1, row_bgr_rgb},
+    {GL_BGRA, GL_UNSIGNED_BYTE, GL_RGB, GL_UNSIGNED_BYTE, 1, row_bgra_rgb},
+    {GL_LUMINANCE_ALPHA, GL_UNSIGNED_BYTE, GL_RGBA, GL_UNSIGNED_BYTE, 1, row_la_rgba},
+    {GL_LUMINANCE, GL_UNSIGNED_BYTE, GL_RGBA, GL_UNSIGNED_BYTE, 1, row_l_rgba},
+    {GL_RGBA, GL_UNSIGNED_BYTE, GL_LUMINANCE_ALPHA, GL_UNSIGNED_BYTE, 1, row_rgba_la},
+    {GL_BGRA, GL_UNSIGNED_BYTE, GL_LUMINANCE_ALPHA, GL_UNSIGNED_BYTE, 1, row_bgra_la},
+    {GL_RGB, GL_UNSIGNED_BYTE, GL_LUMINANCE, GL_UNSIGNED_BYTE, 1, row_rgb_l},
+    {GL_BGR, GL_UNSIGNED_BYTE, GL_LUMINANCE, GL_UNSIGNED_BYTE, 1, row_bgr_l},
+    {GL_BGRA, GL_UNSIGNED_BYTE, GL_LUMINANCE, GL_UNSIGNED_BYTE, 1, row_bgra_l},
+    {GL_RGB, GL_UNSIGNED_BYTE, GL_RGB, GL_UNSIGNED_SHORT_5_6_5, 1, row_rgb_565},
+    {GL_BGR, GL_UNSIGNED_BYTE, GL_RGB, GL_UNSIGNED_SHORT_5_6_5, 1, row_bgr_565},
+    {GL_RGBA, GL_UNSIGNED_BYTE, GL_RGB, GL_UNSIGNED_SHORT_5_6_5, 1, row_rgba_565},
+    {GL_BGRA, GL_UNSIGNED_BYTE, GL_RGB, GL_UNSIGNED_SHORT_5_6_5, 1, row_bgra_565},
+    {GL_RGBA, GL_UNSIGNED_BYTE, GL_RGBA, GL_UNSIGNED_SHORT_5_5_5_1, 1, row_rgba_5551},
+    {GL_BGRA, GL_UNSIGNED_BYTE, GL_RGBA, GL_UNSIGNED_SHORT_5_5_5_1, 1, row_bgra_5551},
+    {GL_RGBA, GL_UNSIGNED_BYTE, GL_RGBA, GL_UNSIGNED_SHORT_4_4_4_4, 1, row_rgba_4444},
+    {GL_BGRA, GL_UNSIGNED_BYTE, GL_RGBA, GL_UNSIGNED_SHORT_4_4_4_4, 1, row_bgra_4444},
+    {GL_BGRA, GL_UNSIGNED_SHORT_4_4_4_4_REV, GL_RGBA, GL_UNSIGNED_SHORT_4_4_4_4, 1, row_bgra4444rev_4444},
+    {GL_RGBA, GL_UNSIGNED_SHORT_4_4_4_4_REV, GL_RGBA, GL_UNSIGNED_SHORT_4_4_4_4, 1, row_rgba4444rev_4444},
+    {GL_BGRA, GL_UNSIGNED_SHORT_1_5_5_5_REV, GL_RGBA, GL_UNSIGNED_SHORT_5_5_5_1, 1, row_bgra1555rev_5551},
+    {GL_RGBA, GL_UNSIGNED_SHORT_1_5_5_5_REV, GL_RGBA, GL_UNSIGNED_SHORT_5_5_5_1, 1, row_rgba1555rev_5551},
+    {GL_RGB, GL_UNSIGNED_SHORT_5_6_5_REV, GL_RGB, GL_UNSIGNED_SHORT_5_6_5, 1, row_rgb565rev_565},
+    {GL_RGBA, GL_FLOAT, GL_RGBA, GL_UNSIGNED_BYTE, 4, row_float_ubyte},
+    {GL_RGB, GL_FLOAT, GL_RGB, GL_UNSIGNED_BYTE, 3, row_float_ubyte},
+    // glReadPixels (always read as RGBA / GL_UNSIGNED_BYTE)
+    {GL_RGBA, GL_UNSIGNED_BYTE, GL_BGRA, GL_UNSIGNED_BYTE, 1, row_swap_rb},
+    {GL_RGBA, GL_UNSIGNED_BYTE, GL_RGB, GL_UNSIGNED_BYTE, 1, row_rgba_rgb},
+    {GL_RGBA, GL_UNSIGNED_BYTE, GL_BGR, GL_UNSIGNED_BYTE, 1, row_bgra_rgb},
+    {GL_RGBA, GL_UNSIGNED_BYTE, GL_LUMINANCE, GL_UNSIGNED_BYTE, 1, row_rgba_l},
+    {GL_RGBA, GL_UNSIGNED_BYTE, GL_RGBA, GL_FLOAT, 4, row_ubyte_float},
+};
+
+// GL_UNSIGNED_INT_8_8_8_8_REV is just bytes on a little endian cpu
+static inline GLenum kernel_type(GLenum type) {
+    return (type == GL_UNSIGNED_INT_8_8_8_8_REV) ? GL_UNSIGNED_BYTE : type;
+}
+
+static const row_kernel_entry_t *find_row_kernel(GLenum src_format, GLenum src_type,
+                                                 GLenum dst_format, GLenum dst_type) {
+    src_type = kernel_type(src_type);
+    dst_type = kernel_type(dst_type);
+    for (int i = 0; i < sizeof(row_kernels) / sizeof(row_kernels[0]); i++) {
+        const row_kernel_entry_t *k = &row_kernels[i];
+        if (k->src_format == src_format && k->src_type == src_type
+            && k->dst_format == dst_format && k->dst_type == dst_type)
+            return k;
+    }
+    return NULL;
+}
+
+static bool convert_rows(const GLvoid *src, GLvoid **dst,
                    GLuint width, GLuint height,
-                   GLenum src_format, GLenum src_type,
+                   GLenum src_format, GLenum src_type, GLuint row_length,
                    GLenum dst_format, GLenum dst_type, GLuint stride) {
     const colorlayout_t *src_color, *dst_color;
     GLuint pixels = width * height;
     GLuint dst_size = pixels * pixel_sizeof(dst_format, dst_type);
     GLuint dst_width = ((stride?stride:width) - width) * pixel_sizeof(dst_format, dst_type);
     GLuint src_width = width * pixel_sizeof(src_format, src_type);
+    GLuint src_line = (row_length?row_length:width) * pixel_sizeof(src_format, src_type);
 
     //printf("pixel conversion: %ix%i - %s, %s (%d) ==> %s, %s (%d), transform=%i\n", width, height, PrintEnum(src_format), PrintEnum(src_type),pixel_sizeof(src_format, src_type), PrintEnum(dst_format), PrintEnum(dst_type), pixel_sizeof(dst_format, dst_type), raster_need_transform());
     src_color = get_color_map(src_format);
@@ -681,13 +878,13 @@ bool pixel_convert(const GLvoid *src, GLvoid **dst,
     }
 
     if ((src_type == dst_type) && (src_color->type == dst_color->type)) {
-        if (*dst == src)
+        if (*dst == src && !row_length)
             return true;
-        if (*dst == NULL)        // alloc dst only if dst==NULL
+        if (*dst == NULL || *dst == src)        // alloc dst only if dst==NULL (or to pack the rows)
             *dst = malloc(dst_size);
-        if (stride)	// for in-place conversion
+        if (stride || row_length)	// for in-place conversion
 			for (int yy=0; yy<height; yy++)
-				memcpy((*dst)+yy*(dst_width+src_width), src+yy*src_width, src_width);
+				memcpy((*dst)+yy*(dst_width+src_width), src+yy*src_line, src_width);
         else
 			memcpy(*dst, src, dst_size);
         return true;
@@ -698,198 +895,15 @@ bool pixel_convert(const GLvoid *src, GLvoid **dst,
         *dst = malloc(dst_size);
     uintptr_t src_pos = (uintptr_t)src;
     uintptr_t dst_pos = (uintptr_t)*dst;
-    // fast optimized loop for common conversion cases first...
-    if ((src_format == GL_BGRA) && (dst_format == GL_RGBA) && (dst_type == GL_UNSIGNED_BYTE) && ((src_type == GL_UNSIGNED_BYTE)||(src_type == GL_UNSIGNED_INT_8_8_8_8_REV))) {
-        GLuint tmp;
-        for (int i = 0; i < height; i++) {
-			for (int j = 0; j < width; j++) {
-				tmp = *(const GLuint*)src_pos;
-				*(GLuint*)dst_pos = (tmp&0xff00ff00) | ((tmp&0x00ff0000)>>16) | ((tmp&0x000000ff)<<16);
-				src_pos += src_stride;
-				dst_pos += dst_stride;
-			}
-			if (stride)
-				dst_pos += dst_width;
-        }
-        return true;
-    }
-    if ((src_format == GL_BGRA) && (dst_format == GL_RGBA) && (dst_type == GL_UNSIGNED_SHORT_5_5_5_1) && (src_type == GL_UNSIGNED_SHORT_1_5_5_5_REV)) {
-      GLuint tmp;
-      unsigned short *wtexmemp = NULL, wtexmem;
-      for (int i = 0; i < height; i++) {
-        for (int j = 0; j < width; j++) {
-          // invert 1555/BGRA to 5551/RGBA (0x1f / 0x3e0 / 7c00)
-          wtexmemp=(unsigned short*)src_pos-1;
-          wtexmem=*(wtexmemp);
-          *(GLushort*)dst_pos = ((wtexmem&0x8000)>>15) | ((wtexmem&0x7fff)<<1);
-          src_pos += src_stride;
-          dst_pos += dst_stride;
-        }
-        if (stride)
-         dst_pos += dst_width;
-      }
-      return true;
-    }
-    if ((src_format == GL_RGBA) && (dst_format == GL_LUMINANCE_ALPHA) && (dst_type == GL_UNSIGNED_BYTE) && ((src_type == GL_UNSIGNED_BYTE)||(src_type == GL_UNSIGNED_INT_8_8_8_8_REV))) {
-        GLuint tmp;
-        for (int i = 0; i < height; i++) {
-			for (int j = 0; j < width; j++) {
-				//tmp = *(const GLuint*)src_pos;
-                unsigned char* byte_src = (unsigned char*)src_pos;
-                *(GLushort*)dst_pos = ((((int)byte_src[0])*77 + ((int)byte_src[1])*151 + ((int)byte_src[2])*28)&0xff00)>>8 | (byte_src[3]<<8);
-				src_pos += src_stride;
-				dst_pos += dst_stride;
-			}
-			if (stride)
-				dst_pos += dst_width;
-        }
-        return true;
-    }
-    if ((src_format == GL_BGRA) && (dst_format == GL_LUMINANCE_ALPHA) && (dst_type == GL_UNSIGNED_BYTE) && ((src_type == GL_UNSIGNED_BYTE)||(src_type == GL_UNSIGNED_INT_8_8_8_8_REV))) {
-        GLuint tmp;
-        for (int i = 0; i < height; i++) {
-			for (int j = 0; j < width; j++) {
-				//tmp = *(const GLuint*)src_pos;
-                unsigned char* byte_src = (unsigned char*)src_pos;
-                *(GLushort*)dst_pos = ((((int)byte_src[2])*77 + ((int)byte_src[1])*151 + ((int)byte_src[0])*28)&0xff00)>>8 | (byte_src[3]<<8);
-				src_pos += src_stride;
-				dst_pos += dst_stride;
-			}
-			if (stride)
-				dst_pos += dst_width;
-        }
-        return true;
-    }
-    if (((src_format == GL_RGBA)||(src_format == GL_RGB)) && (dst_format == GL_LUMINANCE) && (dst_type == GL_UNSIGNED_BYTE) && ((src_type == GL_UNSIGNED_BYTE)||(src_type == GL_UNSIGNED_INT_8_8_8_8_REV))) {
-        GLuint tmp;
-        for (int i = 0; i < height; i++) {
-			for (int j = 0; j < width; j++) {
-				//tmp = *(const GLuint*)src_pos;
-                unsigned char* byte_src = (unsigned char*)src_pos;
-                *(unsigned char*)dst_pos = (((int)byte_src[0])*77 + ((int)byte_src[1])*151 + ((int)byte_src[2])*28)>>8;
-				src_pos += src_stride;
-				dst_pos += dst_stride;
-			}
-			if (stride)
-				dst_pos += dst_width;
-        }
-        return true;
-    }
-    if (((src_format == GL_BGRA)||(src_format == GL_BGR)) && (dst_format == GL_LUMINANCE) && (dst_type == GL_UNSIGNED_BYTE) && ((src_type == GL_UNSIGNED_BYTE)||(src_type == GL_UNSIGNED_INT_8_8_8_8_REV))) {
-        GLuint tmp;
-        for (int i = 0; i < height; i++) {
-			for (int j = 0; j < width; j++) {
-				//tmp = *(const GLuint*)src_pos;
-                unsigned char* byte_src = (unsigned char*)src_pos;
-                *(unsigned char*)dst_pos = (((int)byte_src[2])*77 + ((int)byte_src[1])*151 + ((int)byte_src[0])*28)>>8;
-				src_pos += src_stride;
-				dst_pos += dst_stride;
-			}
-			if (stride)
-				dst_pos += dst_width;
-        }
-        return true;
-    }
-    if (((src_format == GL_BGR)||(src_format == GL_BGRA)) && (dst_format == GL_RGB) && (dst_type == GL_UNSIGNED_BYTE) && ((src_type == GL_UNSIGNED_BYTE)||(src_type == GL_UNSIGNED_INT_8_8_8_8_REV))) {
-        for (int i = 0; i < height; i++) {
-			for (int j = 0; j < width; j++) {
-				((char*)dst_pos)[0] = ((char*)src_pos)[2];
-				((char*)dst_pos)[1] = ((char*)src_pos)[1];
-				((char*)dst_pos)[2] = ((char*)src_pos)[0];
-				src_pos += src_stride;
-				dst_pos += dst_stride;
-			}
-			if (stride)
-				dst_pos += dst_width;
-        }
-        return true;
-    }
-    if ((src_format == GL_RGBA) && (dst_format == GL_RGB) && (dst_type == GL_UNSIGNED_BYTE) && ((src_type == GL_UNSIGNED_BYTE)||(src_type == GL_UNSIGNED_INT_8_8_8_8_REV))) {
-        for (int i = 0; i < height; i++) {
-			for (int j = 0; j < width; j++) {
-				((char*)dst_pos)[0] = ((char*)src_pos)[0];
-				((char*)dst_pos)[1] = ((char*)src_pos)[1];
-				((char*)dst_pos)[2] = ((char*)src_pos)[2];
-				src_pos += src_stride;
-				dst_pos += dst_stride;
-			}
-			if (stride)
-				dst_pos += dst_width;
-        }
-        return true;
-    }
-    if (((src_format == GL_RGB)||(src_format == GL_RGBA)) && (dst_format == GL_RGB) && (dst_type == GL_UNSIGNED_SHORT_5_6_5) && ((src_type == GL_UNSIGNED_BYTE)||(src_type == GL_UNSIGNED_INT_8_8_8_8_REV))) {
-        for (int i = 0; i < height; i++) {
-			for (int j = 0; j < width; j++) {
-				*(GLushort*)dst_pos = ((GLushort)(((char*)src_pos)[2]&0xf8)>>(3)) | ((GLushort)(((char*)src_pos)[1]&0xfc)<<(5-2)) | ((GLushort)(((char*)src_pos)[0]&0xf8)<<(11-3));
-				src_pos += src_stride;
-				dst_pos += dst_stride;
-			}
-			if (stride)
-				dst_pos += dst_width;
-        }
-        return true;
-    }
-    if (((src_format == GL_BGR) || (src_format == GL_BGRA)) && (dst_format == GL_RGB) && (dst_type == GL_UNSIGNED_SHORT_5_6_5) && ((src_type == GL_UNSIGNED_BYTE)||(src_type == GL_UNSIGNED_INT_8_8_8_8_REV))) {
-        for (int i = 0; i < height; i++) {
-			for (int j = 0; j < width; j++) {
-				*(GLushort*)dst_pos = ((GLushort)(((char*)src_pos)[0]&0xf8)>>(3)) | ((GLushort)(((char*)src_pos)[1]&0xfc)<<(5-2)) | ((GLushort)(((char*)src_pos)[2]&0xf8)<<(11-3));
-				src_pos += src_stride;
-				dst_pos += dst_stride;
-			}
-			if (stride)
-				dst_pos += dst_width;
-        }
-        return true;
-    }
-    if ((src_format == GL_RGBA) && (dst_format == GL_RGBA) && (dst_type == GL_UNSIGNED_SHORT_5_5_5_1) && ((src_type == GL_UNSIGNED_BYTE)||(src_type == GL_UNSIGNED_INT_8_8_8_8_REV))) {
-        for (int i = 0; i < height; i++) {
-			for (int j = 0; j < width; j++) {
-				*(GLushort*)dst_pos = ((GLushort)(((char*)src_pos)[2]&0xf8)>>(3-1)) | ((GLushort)(((char*)src_pos)[1]&0xf8)<<(5-2)) | ((GLushort)(((char*)src_pos)[0]&0xf8)<<(10-2)) | ((GLushort)(((char*)src_pos)[3])>>15);
-				src_pos += src_stride;
-				dst_pos += dst_stride;
-			}
-			if (stride)
-				dst_pos += dst_width;
-        }
-        return true;
-    }
-    if ((src_format == GL_BGRA) && (dst_format == GL_RGBA) && (dst_type == GL_UNSIGNED_SHORT_5_5_5_1) && ((src_type == GL_UNSIGNED_BYTE)||(src_type == GL_UNSIGNED_INT_8_8_8_8_REV))) {
-        for (int i = 0; i < height; i++) {
-			for (int j = 0; j < width; j++) {
-				*(GLushort*)dst_pos = ((GLushort)(((char*)src_pos)[0]&0xf8)>>(3-1)) | ((GLushort)(((char*)src_pos)[1]&0xf8)<<(5-2)) | ((GLushort)(((char*)src_pos)[2]&0xf8)<<(10-2)) | ((GLushort)(((char*)src_pos)[3])>>15);
-				src_pos += src_stride;
-				dst_pos += dst_stride;
-			}
-			if (stride)
-				dst_pos += dst_width;
-        }
-        return true;
-    }
-    if ((src_format == GL_RGBA) && (dst_format == GL_RGBA) && (dst_type == GL_UNSIGNED_SHORT_4_4_4_4) && ((src_type == GL_UNSIGNED_BYTE)||(src_type == GL_UNSIGNED_INT_8_8_8_8_REV))) {
-        for (int i = 0; i < height; i++) {
-			for (int j = 0; j < width; j++) {
-				*(GLushort*)dst_pos = ((GLushort)(((char*)src_pos)[3]&0xf0))>>(4) | ((GLushort)(((char*)src_pos)[2]&0xf0)) | ((GLushort)(((char*)src_pos)[1]&0xf0))<<(4) | ((GLushort)(((char*)src_pos)[0]&0xf0))<<(8);
-				src_pos += src_stride;
-				dst_pos += dst_stride;
-			}
-			if (stride)
-				dst_pos += dst_width;
-        }
-        return true;
-    }
-    if ((src_format == GL_BGRA) && (dst_format == GL_RGBA) && (dst_type == GL_UNSIGNED_SHORT_4_4_4_4) && ((src_type == GL_UNSIGNED_BYTE)||(src_type == GL_UNSIGNED_INT_8_8_8_8_REV))) {
-        for (int i = 0; i < height; i++) {
-			for (int j = 0; j < width; j++) {
-				*(GLushort*)dst_pos = ((GLushort)(((char*)src_pos)[3]&0xf0)>>(4)) | ((GLushort)(((char*)src_pos)[0]&0xf0)) | ((GLushort)(((char*)src_pos)[1]&0xf0)<<(4)) | ((GLushort)(((char*)src_pos)[2]&0xf0)<<(8));
-				src_pos += src_stride;
-				dst_pos += dst_stride;
-			}
-			if (stride)
-				dst_pos += dst_width;
-        }
+    // specialized row kernel for the common conversions
+    const row_kernel_entry_t *k = find_row_kernel(src_format, src_type, dst_format, dst_type);
+    if (k) {
+        GLuint dst_line = width * dst_stride + dst_width;
+        for (int i = 0; i < height; i++)
+            k->kernel((const GLubyte *)src + i * src_line, (GLubyte *)*dst + i * dst_line, width * k->channels);
         return true;
     }
+    // generic (slow) path, through a float pixel
 	if (! remap_pixel((const GLvoid *)src_pos, (GLvoid *)dst_pos,
 					  src_color, src_type, dst_color, dst_type)) {
 		// fake convert, to get if it's ok or not
@@ -902,12 +916,69 @@ bool pixel_convert(const GLvoid *src, GLvoid **dst,
 			src_pos += src_stride;
 			dst_pos += dst_stride;
 		}
+		src_pos += src_line - src_width;
 		if (stride)
 			dst_pos += dst_width;
 	}
 	return true;
 }
 
+// images are converted and shrunk in bands of rows, on the worker pool
+#define BAND_PIXELS 16384
+
+static inline int band_rows(GLuint width) {
+    return (width < BAND_PIXELS) ? BAND_PIXELS / width : 1;
+}
+
+typedef struct {
+    const GLvoid *src;
+    GLvoid *dst;
+    GLuint width;
+    GLenum src_format, src_type;
+    GLuint row_length;
+    GLenum dst_format, dst_type;
+    GLuint stride;
+    GLsizei src_line, dst_line;
+    int ok;
+} convert_band_t;
+
+static void convert_band(void *data, int start, int end) {
+    convert_band_t *b = (convert_band_t *)data;
+    GLvoid *dst = b->dst + start * b->dst_line;
+    if (!convert_rows(b->src + start * b->src_line, &dst, b->width, end - start,
+                      b->src_format, b->src_type, b->row_length, b->dst_format, b->dst_type, b->stride))
+        b->ok = 0;
+}
+
+bool pixel_convert(const GLvoid *src, GLvoid **dst,
+                   GLuint width, GLuint height,
+                   GLenum src_format, GLenum src_type,
+                   GLenum dst_format, GLenum dst_type, GLuint stride) {
+    return pixel_convert_stride(src, dst, width, height, src_format, src_type, 0,
+                                dst_format, dst_type, stride);
+}
+
+bool pixel_convert_stride(const GLvoid *src, GLvoid **dst,
+                   GLuint width, GLuint height,
+                   GLenum src_format, GLenum src_type, GLuint row_length,
+                   GLenum dst_format, GLenum dst_type, GLuint stride) {
+    const colorlayout_t *src_color = get_color_map(src_format);
+    const colorlayout_t *dst_color = get_color_map(dst_format);
+    GLuint dst_size = width * height * pixel_sizeof(dst_format, dst_type);
+    // small images, plain copies and errors are handled in one go
+    if (width * height < 2 * BAND_PIXELS || !dst_size || !pixel_sizeof(src_format, src_type)
+        || !src_color->type || !dst_color->type
+        || ((src_type == dst_type) && (src_color->type == dst_color->type)))
+        return convert_rows(src, dst, width, height, src_format, src_type, row_length, dst_format, dst_type, stride);
+    if (*dst == src || *dst == NULL)
+        *dst = malloc(dst_size);
+    convert_band_t band = {src, *dst, width, src_format, src_type, row_length, dst_format, dst_type, stride,
+        (row_length ? row_length : width) * pixel_sizeof(src_format, src_type),
+        (stride ? stride : width) * pixel_sizeof(dst_format, dst_type), 1};
+    pool_run(height, band_rows(width), convert_band, &band);
+    return band.ok;
+}
+
 bool pixel_transform(const GLvoid *src, GLvoid **dst,
                    GLuint width, GLuint height,
                    GLenum src_format, GLenum src_type,
@@ -966,6 +1037,17 @@ bool pixel_scale(const GLvoid *old, GLvoid **new,
     return true;
 }
 
+typedef struct {
+    const GLvoid *src;
+    GLvoid *dst;
+    GLuint width, new_width, pixel_size;
+    const colorlayout_t *color;
+    GLenum type;
+} scale_band_t;
+
+static void halfscale_band(void *data, int start, int end);
+static void quarterscale_band(void *data, int start, int end);
+
 bool pixel_halfscale(const GLvoid *old, GLvoid **new,
                  GLuint width, GLuint height,
                  GLenum format, GLenum type) {
@@ -980,13 +1062,22 @@ bool pixel_halfscale(const GLvoid *old, GLvoid **new,
     const colorlayout_t *src_color;
     src_color = get_color_map(format);
     GLvoid *dst;
-    uintptr_t src, pos, pix0, pix1, pix2, pix3;
 
     pixel_size = pixel_sizeof(format, type);
     dst = malloc(pixel_size * new_width * new_height);
-    src = (uintptr_t)old;
-    pos = (uintptr_t)dst;
-    for (int y = 0; y < new_height; y++) {
+    scale_band_t band = {old, dst, width, new_width, pixel_size, src_color, type};
+    pool_run(new_height, band_rows(width), halfscale_band, &band);
+    *new = dst;
+    return true;
+}
+
+static void halfscale_band(void *data, int start, int end) {
+    scale_band_t *b = (scale_band_t *)data;
+    GLuint width = b->width, new_width = b->new_width, pixel_size = b->pixel_size;
+    uintptr_t src, pos, pix0, pix1, pix2, pix3;
+    src = (uintptr_t)b->src;
+    pos = (uintptr_t)b->dst + start * new_width * pixel_size;
+    for (int y = start; y < end; y++) {
         for (int x = 0; x < new_width; x++) {
             pix0 = src + ((x * 2) +
                           (y * 2) * width) * pixel_size;
@@ -996,12 +1087,10 @@ bool pixel_halfscale(const GLvoid *old, GLvoid **new,
                           (y * 2 + 1) * width) * pixel_size;
             pix3 = src + ((x * 2 + 1) +
                           (y * 2 + 1) * width) * pixel_size;
-            half_pixel((GLvoid *)pix0, (GLvoid *)pix1, (GLvoid *)pix2, (GLvoid *)pix3, (GLvoid *)pos, src_color, type);
+            half_pixel((GLvoid *)pix0, (GLvoid *)pix1, (GLvoid *)pix2, (GLvoid *)pix3, (GLvoid *)pos, b->color, b->type);
             pos += pixel_size;
         }
     }
-    *new = dst;
-    return true;
 }
 
 bool pixel_thirdscale(const GLvoid *old, GLvoid **new,
@@ -1059,13 +1148,22 @@ bool pixel_quarterscale(const GLvoid *old, GLvoid **new,
     const colorlayout_t *src_color;
     src_color = get_color_map(format);
     GLvoid *dst;
-    uintptr_t src, pos, pix[16];
 
     pixel_size = pixel_sizeof(format, type);
     dst = malloc(pixel_size * new_width * new_height);
-    src = (uintptr_t)old;
-    pos = (uintptr_t)dst;
-    for (int y = 0; y < new_height; y++) {
+    scale_band_t band = {old, dst, width, new_width, pixel_size, src_color, type};
+    pool_run(new_height, band_rows(width), quarterscale_band, &band);
+    *new = dst;
+    return true;
+}
+
+static void quarterscale_band(void *data, int start, int end) {
+    scale_band_t *b = (scale_band_t *)data;
+    GLuint width = b->width, new_width = b->new_width, pixel_size = b->pixel_size;
+    uintptr_t src, pos, pix[16];
+    src = (uintptr_t)b->src;
+    pos = (uintptr_t)b->dst + start * new_width * pixel_size;
+    for (int y = start; y < end; y++) {
         for (int x = 0; x < new_width; x++) {
             for (int dx=0; dx<4; dx++) {
                 for (int dy=0; dy<4; dy++) {
@@ -1073,12 +1171,10 @@ bool pixel_quarterscale(const GLvoid *old, GLvoid **new,
                                           (y * 4 + dy) * width) * pixel_size;
                 }
             }
-            quarter_pixel((const GLvoid **)pix, (GLvoid *)pos, src_color, type);
+            quarter_pixel((const GLvoid **)pix, (GLvoid *)pos, b->color, b->type);
             pos += pixel_size;
         }
     }
-    *new = dst;
-    return true;
 }
 
 bool pixel_to_ppm(const GLvoid *pixels, GLuint width, GLuint height,
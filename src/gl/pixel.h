@@ -17,6 +17,12 @@ bool pixel_convert(const GLvoid *src, GLvoid **dst,
                    GLenum src_format, GLenum src_type,
                    GLenum dst_format, GLenum dst_type, GLuint stride);
 
+// same, reading source rows of row_length pixels (0 for packed rows)
+bool pixel_convert_stride(const GLvoid *src, GLvoid **dst,
+                   GLuint width, GLuint height,
+                   GLenum src_format, GLenum src_type, GLuint row_length,
+                   GLenum dst_format, GLenum dst_type, GLuint stride);
+
 bool pixel_transform(const GLvoid *src, GLvoid **dst,
                    GLuint width, GLuint height,
                    GLenum src_format, GLenum src_type,
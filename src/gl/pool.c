@@ -0,0 +1,92 @@
+#include <pthread.h>
+#include <unistd.h>
+
+#include "pool.h"
+
+#define POOL_MAX 8
+
+extern GLuint gl_texthreads;
+
+static pthread_t threads[POOL_MAX];
+static int nthreads = -1;       // started workers, -1 before the first use
+static pthread_mutex_t run_mutex = PTHREAD_MUTEX_INITIALIZER;    // one job at a time
+static pthread_mutex_t mutex = PTHREAD_MUTEX_INITIALIZER;        // protects the job
+static pthread_cond_t work = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t done = PTHREAD_COND_INITIALIZER;
+static pool_func_t job_func;
+static void *job_data;
+static int job_count, job_band, job_next, job_active;
+static unsigned int job_gen = 0;
+
+static void pool_bands() {
+    // take bands of the current job until there is none left, mutex held
+    while (job_next < job_count) {
+        int start = job_next;
+        int end = start + job_band;
+        if (end > job_count)
+            end = job_count;
+        job_next = end;
+        pool_func_t func = job_func;
+        void *data = job_data;
+        pthread_mutex_unlock(&mutex);
+        func(data, start, end);
+        pthread_mutex_lock(&mutex);
+    }
+}
+
+static void *pool_main(void *arg) {
+    unsigned int seen = 0;
+    pthread_mutex_lock(&mutex);
+    while (1) {
+        while (job_gen == seen)
+            pthread_cond_wait(&work, &mutex);
+        seen = job_gen;
+        job_active++;
+        pool_bands();
+        if (--job_active == 0)
+            pthread_cond_broadcast(&done);
+    }
+    return NULL;
+}
+
+int pool_threads() {
+    if (nthreads < 0) {
+        int wanted = gl_texthreads;
+        if (!wanted) {
+            long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+            wanted = (cpus > 0) ? cpus : 1;
+        }
+        if (wanted > POOL_MAX)
+            wanted = POOL_MAX;
+        nthreads = 0;
+        while (nthreads < wanted - 1 && pthread_create(&threads[nthreads], NULL, pool_main, NULL) == 0)
+            nthreads++;
+    }
+    return nthreads + 1;
+}
+
+void pool_run(int count, int band, pool_func_t func, void *data) {
+    if (band < 1)
+        band = 1;
+    if (count <= band || pool_threads() < 2) {
+        func(data, 0, count);
+        return;
+    }
+    pthread_mutex_lock(&run_mutex);
+    pthread_mutex_lock(&mutex);
+    job_func = func;
+    job_data = data;
+    job_count = count;
+    job_next = 0;
+    // no more bands than threads if they are small
+    job_band = (count + nthreads) / (nthreads + 1);
+    if (job_band < band)
+        job_band = band;
+    job_gen++;
+    pthread_cond_broadcast(&work);
+    pool_bands();
+    while (job_active)
+        pthread_cond_wait(&done, &mutex);
+    pthread_mutex_unlock(&mutex);
+    pthread_mutex_unlock(&run_mutex);
+}
@@ -0,0 +1,16 @@
+#include "gl.h"
+
+#ifndef GL_POOL_H
+#define GL_POOL_H
+
+// Worker threads for the CPU heavy texture work (conversions, shrinking, decompression)
+
+typedef void (*pool_func_t)(void *data, int start, int end);
+
+// call func(data, start, end) on bands of [start, end) covering [0, count), at least "band" long,
+// spread on the worker threads and the calling one; returns when all bands are done
+void pool_run(int count, int band, pool_func_t func, void *data);
+// number of threads pool_run can use, the calling one included
+int pool_threads();
+
+#endif
@@ -0,0 +1,440 @@
+#include "shadow.h"
+
+// global enable caps that are tracked (everything else goes straight through)
+static const GLenum shadow_caps[] = {
+    GL_ALPHA_TEST, GL_BLEND, GL_COLOR_LOGIC_OP, GL_COLOR_MATERIAL, GL_CULL_FACE,
+    GL_DEPTH_TEST, GL_DITHER, GL_FOG, GL_LIGHTING, GL_LINE_SMOOTH, GL_MULTISAMPLE,
+    GL_NORMALIZE, GL_POINT_SMOOTH, GL_POINT_SPRITE_OES, GL_POLYGON_OFFSET_FILL,
+    GL_RESCALE_NORMAL, GL_SAMPLE_ALPHA_TO_COVERAGE, GL_SAMPLE_ALPHA_TO_ONE,
+    GL_SAMPLE_COVERAGE, GL_SCISSOR_TEST, GL_STENCIL_TEST,
+    GL_LIGHT0, GL_LIGHT1, GL_LIGHT2, GL_LIGHT3, GL_LIGHT4, GL_LIGHT5, GL_LIGHT6, GL_LIGHT7,
+    GL_CLIP_PLANE0, GL_CLIP_PLANE1, GL_CLIP_PLANE2, GL_CLIP_PLANE3, GL_CLIP_PLANE4, GL_CLIP_PLANE5
+};
+#define SHADOW_CAPS (sizeof(shadow_caps)/sizeof(shadow_caps[0]))
+// enable caps that are per texture unit
+static const GLenum shadow_texcaps[] = {
+    GL_TEXTURE_2D, GL_TEXTURE_CUBE_MAP_OES, GL_TEXTURE_GEN_STR_OES
+};
+#define SHADOW_TEXCAPS (sizeof(shadow_texcaps)/sizeof(shadow_texcaps[0]))
+// scalar GL_TEXTURE_ENV parameters
+static const GLenum shadow_envs[] = {
+    GL_TEXTURE_ENV_MODE, GL_COMBINE_RGB, GL_COMBINE_ALPHA,
+    GL_SRC0_RGB, GL_SRC1_RGB, GL_SRC2_RGB, GL_SRC0_ALPHA, GL_SRC1_ALPHA, GL_SRC2_ALPHA,
+    GL_OPERAND0_RGB, GL_OPERAND1_RGB, GL_OPERAND2_RGB,
+    GL_OPERAND0_ALPHA, GL_OPERAND1_ALPHA, GL_OPERAND2_ALPHA,
+    GL_RGB_SCALE, GL_ALPHA_SCALE
+};
+#define SHADOW_ENVS (sizeof(shadow_envs)/sizeof(shadow_envs[0]))
+#define SHADOW_LIGHTS 8
+
+// a value is only trusted once it has been set through the filter
+typedef struct {
+    GLboolean known;
+    GLfloat v[4];
+} shadow_value_t;
+
+typedef struct {
+    GLboolean known;
+    GLuint v;
+} shadow_enum_t;
+
+typedef struct {
+    shadow_value_t ambient, diffuse, specular;
+    shadow_value_t spot_exponent, spot_cutoff;
+    shadow_value_t constant, linear, quadratic;
+} shadow_light_t;
+
+typedef struct {
+    shadow_enum_t caps[SHADOW_CAPS];
+    shadow_enum_t texcaps[MAX_TEX][SHADOW_TEXCAPS];
+    shadow_enum_t blend_src, blend_dst;
+    shadow_enum_t alpha_func;
+    shadow_value_t alpha_ref;
+    shadow_enum_t depth_func, depth_mask;
+    shadow_enum_t active;
+    shadow_enum_t bound2d[MAX_TEX], boundcube[MAX_TEX];
+    shadow_value_t env[MAX_TEX][SHADOW_ENVS];
+    shadow_value_t envcolor[MAX_TEX];
+    shadow_value_t ambient, diffuse, specular, emission, shininess;
+    shadow_light_t light[SHADOW_LIGHTS];
+} shadow_state_t;
+
+// counters of calls seen / elided, per family
+typedef enum {
+    SHADOW_ENABLE = 0,
+    SHADOW_BLEND,
+    SHADOW_ALPHA,
+    SHADOW_DEPTH,
+    SHADOW_TEXENV,
+    SHADOW_TEXTURE,
+    SHADOW_MATERIAL,
+    SHADOW_LIGHT,
+    SHADOW_COUNT
+} shadow_family_t;
+
+static const char *shadow_names[SHADOW_COUNT] = {
+    "enable", "blend", "alpha", "depth", "texenv", "texture", "material", "light"
+};
+
+static shadow_state_t shadow;
+static unsigned long shadow_seen[SHADOW_COUNT];
+static unsigned long shadow_elided[SHADOW_COUNT];
+
+extern GLuint gl_statefilter;
+
+// the real entry points
+static glEnable_PTR real_glEnable = NULL;
+static glDisable_PTR real_glDisable = NULL;
+static glBlendFunc_PTR real_glBlendFunc = NULL;
+static glBlendFuncSeparate_PTR real_glBlendFuncSeparate = NULL;
+static glAlphaFunc_PTR real_glAlphaFunc = NULL;
+static glDepthFunc_PTR real_glDepthFunc = NULL;
+static glDepthMask_PTR real_glDepthMask = NULL;
+static glTexEnvf_PTR real_glTexEnvf = NULL;
+static glTexEnvi_PTR real_glTexEnvi = NULL;
+static glTexEnvfv_PTR real_glTexEnvfv = NULL;
+static glTexEnviv_PTR real_glTexEnviv = NULL;
+static glActiveTexture_PTR real_glActiveTexture = NULL;
+static glBindTexture_PTR real_glBindTexture = NULL;
+static glDeleteTextures_PTR real_glDeleteTextures = NULL;
+static glMaterialf_PTR real_glMaterialf = NULL;
+static glMaterialfv_PTR real_glMaterialfv = NULL;
+static glLightf_PTR real_glLightf = NULL;
+static glLightfv_PTR real_glLightfv = NULL;
+
+void shadow_invalidate() {
+    memset(&shadow, 0, sizeof(shadow));
+}
+
+// return true if the call is a no-op and can be dropped
+static inline int shadow_enum(shadow_enum_t *s, GLuint v) {
+    if (!gl_statefilter) {
+        s->known = GL_FALSE;
+        return 0;
+    }
+    if (s->known && s->v == v)
+        return 1;
+    s->known = GL_TRUE;
+    s->v = v;
+    return 0;
+}
+
+static inline int shadow_value(shadow_value_t *s, const GLfloat *v, int n) {
+    if (!gl_statefilter) {
+        s->known = GL_FALSE;
+        return 0;
+    }
+    if (s->known && memcmp(s->v, v, n*sizeof(GLfloat)) == 0)
+        return 1;
+    s->known = GL_TRUE;
+    memcpy(s->v, v, n*sizeof(GLfloat));
+    return 0;
+}
+
+static inline int shadow_count(shadow_family_t family, int same) {
+    shadow_seen[family]++;
+    if (same)
+        shadow_elided[family]++;
+    return same;
+}
+
+static shadow_enum_t *shadow_cap(GLenum cap) {
+    for (int i = 0; i < SHADOW_TEXCAPS; i++)
+        if (shadow_texcaps[i] == cap) {
+            if (!shadow.active.known || shadow.active.v >= MAX_TEX)
+                return NULL;
+            return &shadow.texcaps[shadow.active.v][i];
+        }
+    for (int i = 0; i < SHADOW_CAPS; i++)
+        if (shadow_caps[i] == cap)
+            return &shadow.caps[i];
+    return NULL;
+}
+
+// with GL_COLOR_MATERIAL, ambient and diffuse follow the current color
+static inline int shadow_colormaterial() {
+    shadow_enum_t *s = shadow_cap(GL_COLOR_MATERIAL);
+    return !(s->known && !s->v);
+}
+
+static void shadow_glEnable(GLenum cap) {
+    shadow_enum_t *s = shadow_cap(cap);
+    if (s && shadow_count(SHADOW_ENABLE, shadow_enum(s, 1)))
+        return;
+    if (cap == GL_COLOR_MATERIAL)
+        shadow.ambient.known = shadow.diffuse.known = GL_FALSE;
+    real_glEnable(cap);
+}
+
+static void shadow_glDisable(GLenum cap) {
+    shadow_enum_t *s = shadow_cap(cap);
+    if (s && shadow_count(SHADOW_ENABLE, shadow_enum(s, 0)))
+        return;
+    if (cap == GL_COLOR_MATERIAL)
+        shadow.ambient.known = shadow.diffuse.known = GL_FALSE;
+    real_glDisable(cap);
+}
+
+static void shadow_glBlendFunc(GLenum sfactor, GLenum dfactor) {
+    // both must be updated, so don't shortcut the second test
+    int same = shadow_enum(&shadow.blend_src, sfactor);
+    same &= shadow_enum(&shadow.blend_dst, dfactor);
+    if (shadow_count(SHADOW_BLEND, same))
+        return;
+    real_glBlendFunc(sfactor, dfactor);
+}
+
+static void shadow_glBlendFuncSeparate(GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha) {
+    shadow.blend_src.known = shadow.blend_dst.known = GL_FALSE;
+    real_glBlendFuncSeparate(sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);
+}
+
+static void shadow_glAlphaFunc(GLenum func, GLclampf ref) {
+    int same = shadow_enum(&shadow.alpha_func, func);
+    same &= shadow_value(&shadow.alpha_ref, &ref, 1);
+    if (shadow_count(SHADOW_ALPHA, same))
+        return;
+    real_glAlphaFunc(func, ref);
+}
+
+static void shadow_glDepthFunc(GLenum func) {
+    if (shadow_count(SHADOW_DEPTH, shadow_enum(&shadow.depth_func, func)))
+        return;
+    real_glDepthFunc(func);
+}
+
+static void shadow_glDepthMask(GLboolean flag) {
+    if (shadow_count(SHADOW_DEPTH, shadow_enum(&shadow.depth_mask, flag)))
+        return;
+    real_glDepthMask(flag);
+}
+
+static shadow_value_t *shadow_env(GLenum target, GLenum pname) {
+    if (target != GL_TEXTURE_ENV || !shadow.active.known || shadow.active.v >= MAX_TEX)
+        return NULL;
+    for (int i = 0; i < SHADOW_ENVS; i++)
+        if (shadow_envs[i] == pname)
+            return &shadow.env[shadow.active.v][i];
+    return NULL;
+}
+
+static void shadow_glTexEnvf(GLenum target, GLenum pname, GLfloat param) {
+    shadow_value_t *s = shadow_env(target, pname);
+    if (s && shadow_count(SHADOW_TEXENV, shadow_value(s, &param, 1)))
+        return;
+    real_glTexEnvf(target, pname, param);
+}
+
+static void shadow_glTexEnvi(GLenum target, GLenum pname, GLint param) {
+    shadow_value_t *s = shadow_env(target, pname);
+    GLfloat f = param;
+    if (s && shadow_count(SHADOW_TEXENV, shadow_value(s, &f, 1)))
+        return;
+    real_glTexEnvi(target, pname, param);
+}
+
+static void shadow_glTexEnvfv(GLenum target, GLenum pname, const GLfloat *params) {
+    shadow_value_t *s = NULL;
+    if (pname == GL_TEXTURE_ENV_COLOR) {
+        if (target == GL_TEXTURE_ENV && shadow.active.known && shadow.active.v < MAX_TEX)
+            s = &shadow.envcolor[shadow.active.v];
+        if (s && shadow_count(SHADOW_TEXENV, shadow_value(s, params, 4)))
+            return;
+    } else {
+        s = shadow_env(target, pname);
+        if (s && shadow_count(SHADOW_TEXENV, shadow_value(s, params, 1)))
+            return;
+    }
+    real_glTexEnvfv(target, pname, params);
+}
+
+static void shadow_glTexEnviv(GLenum target, GLenum pname, const GLint *params) {
+    // integer colors are scaled, just forget the color
+    shadow_value_t *s = NULL;
+    if (pname == GL_TEXTURE_ENV_COLOR) {
+        if (shadow.active.known && shadow.active.v < MAX_TEX)
+            shadow.envcolor[shadow.active.v].known = GL_FALSE;
+    } else {
+        s = shadow_env(target, pname);
+        GLfloat f = params[0];
+        if (s && shadow_count(SHADOW_TEXENV, shadow_value(s, &f, 1)))
+            return;
+    }
+    real_glTexEnviv(target, pname, params);
+}
+
+static void shadow_glActiveTexture(GLenum texture) {
+    if (shadow_count(SHADOW_TEXTURE, shadow_enum(&shadow.active, texture - GL_TEXTURE0)))
+        return;
+    real_glActiveTexture(texture);
+}
+
+static void shadow_glBindTexture(GLenum target, GLuint texture) {
+    shadow_enum_t *s = NULL;
+    if (shadow.active.known && shadow.active.v < MAX_TEX) {
+        if (target == GL_TEXTURE_2D)
+            s = &shadow.bound2d[shadow.active.v];
+        else if (target == GL_TEXTURE_CUBE_MAP_OES)
+            s = &shadow.boundcube[shadow.active.v];
+    }
+    if (s && shadow_count(SHADOW_TEXTURE, shadow_enum(s, texture)))
+        return;
+    real_glBindTexture(target, texture);
+}
+
+static void shadow_glDeleteTextures(GLsizei n, const GLuint *textures) {
+    // deleting a bound texture reverts the binding to 0
+    for (int i = 0; i < n; i++)
+        for (int j = 0; j < MAX_TEX; j++) {
+            if (shadow.bound2d[j].known && shadow.bound2d[j].v == textures[i])
+                shadow.bound2d[j].v = 0;
+            if (shadow.boundcube[j].known && shadow.boundcube[j].v == textures[i])
+                shadow.boundcube[j].v = 0;
+        }
+    real_glDeleteTextures(n, textures);
+}
+
+static void shadow_glMaterialfv(GLenum face, GLenum pname, const GLfloat *params) {
+    shadow_value_t *s = NULL, *s2 = NULL;
+    int n = 4;
+    switch (pname) {
+        case GL_AMBIENT: s = &shadow.ambient; break;
+        case GL_DIFFUSE: s = &shadow.diffuse; break;
+        case GL_AMBIENT_AND_DIFFUSE: s = &shadow.ambient; s2 = &shadow.diffuse; break;
+        case GL_SPECULAR: s = &shadow.specular; break;
+        case GL_EMISSION: s = &shadow.emission; break;
+        case GL_SHININESS: s = &shadow.shininess; n = 1; break;
+    }
+    if (s && (face != GL_FRONT_AND_BACK
+        || ((s == &shadow.ambient || s == &shadow.diffuse) && shadow_colormaterial()))) {
+        s->known = GL_FALSE;
+        if (s2) s2->known = GL_FALSE;
+        s = NULL;
+    }
+    if (s) {
+        int same = shadow_value(s, params, n);
+        if (s2)
+            same &= shadow_value(s2, params, n);
+        if (shadow_count(SHADOW_MATERIAL, same))
+            return;
+    }
+    real_glMaterialfv(face, pname, params);
+}
+
+static void shadow_glMaterialf(GLenum face, GLenum pname, GLfloat param) {
+    if (pname == GL_SHININESS) {
+        if (face == GL_FRONT_AND_BACK) {
+            if (shadow_count(SHADOW_MATERIAL, shadow_value(&shadow.shininess, &param, 1)))
+                return;
+        } else
+            shadow.shininess.known = GL_FALSE;
+    }
+    real_glMaterialf(face, pname, param);
+}
+
+// position and spot direction depend on the modelview, they are never filtered
+static shadow_value_t *shadow_lightparam(GLenum light, GLenum pname, int *n) {
+    if (light < GL_LIGHT0 || light >= GL_LIGHT0 + SHADOW_LIGHTS)
+        return NULL;
+    shadow_light_t *l = &shadow.light[light - GL_LIGHT0];
+    *n = 1;
+    switch (pname) {
+        case GL_AMBIENT: *n = 4; return &l->ambient;
+        case GL_DIFFUSE: *n = 4; return &l->diffuse;
+        case GL_SPECULAR: *n = 4; return &l->specular;
+        case GL_SPOT_EXPONENT: return &l->spot_exponent;
+        case GL_SPOT_CUTOFF: return &l->spot_cutoff;
+        case GL_CONSTANT_ATTENUATION: return &l->constant;
+        case GL_LINEAR_ATTENUATION: return &l->linear;
+        case GL_QUADRATIC_ATTENUATION: return &l->quadratic;
+    }
+    return NULL;
+}
+
+static void shadow_glLightfv(GLenum light, GLenum pname, const GLfloat *params) {
+    int n;
+    shadow_value_t *s = shadow_lightparam(light, pname, &n);
+    if (s && shadow_count(SHADOW_LIGHT, shadow_value(s, params, n)))
+        return;
+    real_glLightfv(light, pname, params);
+}
+
+static void shadow_glLightf(GLenum light, GLenum pname, GLfloat param) {
+    int n;
+    shadow_value_t *s = shadow_lightparam(light, pname, &n);
+    if (s && n == 1 && shadow_count(SHADOW_LIGHT, shadow_value(s, &param, 1)))
+        return;
+    real_glLightf(light, pname, param);
+}
+
+int shadow_query(GLenum pname, GLuint *value) {
+    shadow_enum_t *s;
+    switch (pname) {
+        case GL_DEPTH_FUNC: s = &shadow.depth_func; break;
+        case GL_DEPTH_WRITEMASK: s = &shadow.depth_mask; break;
+        default: s = shadow_cap(pname);
+    }
+    if (!gl_statefilter || !s || !s->known)
+        return 0;
+    *value = s->v;
+    return 1;
+}
+
+#define SHADOW_PROC(func) \
+    if (strcmp(name, #func) == 0) { \
+        real_##func = (func##_PTR)proc; \
+        return (void*)shadow_##func; \
+    }
+
+void *shadow_proc(const char *name, void *proc) {
+    if (!proc || !gl_statefilter)
+        return proc;
+    SHADOW_PROC(glEnable);
+    SHADOW_PROC(glDisable);
+    SHADOW_PROC(glBlendFunc);
+    SHADOW_PROC(glBlendFuncSeparate);
+    SHADOW_PROC(glAlphaFunc);
+    SHADOW_PROC(glDepthFunc);
+    SHADOW_PROC(glDepthMask);
+    SHADOW_PROC(glTexEnvf);
+    SHADOW_PROC(glTexEnvi);
+    SHADOW_PROC(glTexEnvfv);
+    SHADOW_PROC(glTexEnviv);
+    SHADOW_PROC(glActiveTexture);
+    SHADOW_PROC(glBindTexture);
+    SHADOW_PROC(glDeleteTextures);
+    SHADOW_PROC(glMaterialf);
+    SHADOW_PROC(glMaterialfv);
+    SHADOW_PROC(glLightf);
+    SHADOW_PROC(glLightfv);
+    return proc;
+}
+
+#undef SHADOW_PROC
+
+void shadow_report() {
+    unsigned long seen = 0, elided = 0;
+    char details[400];
+    int len = 0;
+    details[0] = '\0';
+    for (int i = 0; i < SHADOW_COUNT; i++) {
+        seen += shadow_seen[i];
+        elided += shadow_elided[i];
+        if (shadow_seen[i])
+            len += snprintf(details+len, sizeof(details)-len, " %s %lu/%lu", shadow_names[i], shadow_elided[i], shadow_seen[i]);
+        shadow_seen[i] = shadow_elided[i] = 0;
+        if (len >= sizeof(details))
+            len = sizeof(details)-1;
+    }
+    printf("LIBGL: state filter elided %lu/%lu calls:%s\n", elided, seen, details);
+}
+
+void shadow_endframe() {
+    static int frames = 0;
+    if (gl_statefilter != 2)
+        return;
+    if (++frames >= 100) {
+        shadow_report();
+        frames = 0;
+    }
+}
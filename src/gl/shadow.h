@@ -0,0 +1,19 @@
+#include "gl.h"
+
+#ifndef GL_SHADOW_H
+#define GL_SHADOW_H
+
+// Shadow copy of the GLES state, used to drop redundant state changes
+// (same blend func, same texture bound...) before they reach the driver
+
+// returns a filtering entry point for the GLES function "name", or proc itself
+void *shadow_proc(const char *name, void *proc);
+// current value of an enable cap, GL_DEPTH_FUNC or GL_DEPTH_WRITEMASK, 0 if unknown
+int shadow_query(GLenum pname, GLuint *value);
+// forget everything (new context, or state changed behind our back)
+void shadow_invalidate();
+// print (and reset) the elided calls counters
+void shadow_report();
+void shadow_endframe();
+
+#endif
@@ -58,6 +58,13 @@ typedef struct {
     renderlist_t *active;
     GLboolean compiling;
     GLboolean locked;
+    // arrays converted by glLockArrays, on their first use
+    renderlist_t *lockedlist;
+    GLfloat *lockedslots[4+MAX_TEX];    // place of vertex, normal, color, secondary, tex_coord in its arena
+    pointer_states_t lockedpointers;
+    GLfloat *lockedcolors;  // color + secondary
+    GLint lockedfirst;
+    GLsizei lockedcount;
     GLuint base;
     GLuint name;
     GLenum mode;
@@ -0,0 +1,200 @@
+#include <dirent.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "texcache.h"
+#include "pixel.h"
+
+char *texcache_dir = NULL;
+int texcache_max = 256;         // size of the cache, in MB
+
+static long long texcache_total = -1;   // bytes in the cache directory, -1 before it is scanned
+
+#define TEXCACHE_MAGIC 0x31435447   // "GTC1"
+
+typedef struct {
+    GLuint magic;
+    GLuint width, height;
+    GLenum format, type;
+    GLint shrink;
+    GLuint size;
+    uint64_t key[2];    // against a file renamed or truncated by someone else
+} texcache_header_t;
+
+static void hash_bytes(texcache_key_t *key, const GLubyte *p, size_t size) {
+    uint64_t a = key->h[0], b = key->h[1];
+    size_t i = 0;
+    for (; i + 8 <= size; i += 8) {
+        uint64_t w;
+        memcpy(&w, p + i, 8);
+        a = (a ^ w) * 0x100000001b3ULL;
+        b = (b + w) * 0x9e3779b97f4a7c15ULL;
+        b ^= b >> 31;
+    }
+    for (; i < size; i++) {
+        a = (a ^ p[i]) * 0x100000001b3ULL;
+        b = (b + p[i]) * 0x9e3779b97f4a7c15ULL;
+    }
+    key->h[0] = a;
+    key->h[1] = b;
+}
+
+void texcache_hash(texcache_key_t *key, const GLvoid *data, GLsizei width, GLsizei height,
+                   GLuint pixel_size, GLuint row_length) {
+    key->h[0] = 0xcbf29ce484222325ULL;
+    key->h[1] = 0x2545f4914f6cdd1dULL;
+    GLuint line = (row_length ? row_length : width) * pixel_size;
+    for (int y = 0; y < height; y++)
+        hash_bytes(key, (const GLubyte *)data + y * line, width * pixel_size);
+}
+
+void texcache_mix(texcache_key_t *key, GLuint value) {
+    hash_bytes(key, (const GLubyte *)&value, sizeof(value));
+}
+
+static void texcache_path(char *path, size_t size, const texcache_key_t *key) {
+    snprintf(path, size, "%s/%016llx%016llx.tex", texcache_dir,
+             (unsigned long long)key->h[0], (unsigned long long)key->h[1]);
+}
+
+int texcache_load(const texcache_key_t *key, texcache_entry_t *entry) {
+    char path[1024];
+    struct stat st;
+    entry->pixels = NULL;
+    texcache_path(path, sizeof(path), key);
+    int fd = open(path, O_RDONLY);
+    if (fd < 0)
+        return 0;
+    if (fstat(fd, &st) || st.st_size < sizeof(texcache_header_t)) {
+        close(fd);
+        return 0;
+    }
+    void *map = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    futimens(fd, NULL);     // the modification time is the last use, for the eviction
+    close(fd);
+    if (map == MAP_FAILED)
+        return 0;
+    const texcache_header_t *header = (const texcache_header_t *)map;
+    if (header->magic != TEXCACHE_MAGIC || header->key[0] != key->h[0] || header->key[1] != key->h[1]
+        || header->size != st.st_size - sizeof(texcache_header_t)
+        || header->size != header->width * header->height * pixel_sizeof(header->format, header->type)) {
+        munmap(map, st.st_size);
+        return 0;
+    }
+    entry->width = header->width;
+    entry->height = header->height;
+    entry->format = header->format;
+    entry->type = header->type;
+    entry->shrink = header->shrink;
+    entry->pixels = (GLubyte *)map + sizeof(texcache_header_t);
+    entry->map = map;
+    entry->map_size = st.st_size;
+    return 1;
+}
+
+void texcache_release(texcache_entry_t *entry) {
+    if (entry->pixels)
+        munmap(entry->map, entry->map_size);
+    entry->pixels = NULL;
+}
+
+typedef struct {
+    char name[64];
+    off_t size;
+    time_t used;
+} texcache_file_t;
+
+static int is_entry(const char *name) {
+    size_t len = strlen(name);
+    return (len == 36) && !strcmp(name + 32, ".tex");
+}
+
+static int older_first(const void *a, const void *b) {
+    time_t ua = ((const texcache_file_t *)a)->used, ub = ((const texcache_file_t *)b)->used;
+    return (ua < ub) ? -1 : (ua > ub);
+}
+
+// the entries of the directory (NULL if there is none), and their total size
+static texcache_file_t *texcache_scan(int *count, long long *total) {
+    char path[1024];
+    struct stat st;
+    struct dirent *e;
+    texcache_file_t *files = NULL;
+    int cap = 0;
+    *count = 0;
+    *total = 0;
+    DIR *dir = opendir(texcache_dir);
+    if (!dir)
+        return NULL;
+    while ((e = readdir(dir))) {
+        if (!is_entry(e->d_name))
+            continue;
+        snprintf(path, sizeof(path), "%s/%s", texcache_dir, e->d_name);
+        if (stat(path, &st))
+            continue;
+        if (*count == cap) {
+            cap = cap ? cap * 2 : 64;
+            files = (texcache_file_t *)realloc(files, cap * sizeof(texcache_file_t));
+        }
+        strcpy(files[*count].name, e->d_name);
+        files[*count].size = st.st_size;
+        files[*count].used = st.st_mtime;
+        (*count)++;
+        *total += st.st_size;
+    }
+    closedir(dir);
+    return files;
+}
+
+// remove the least recently used entries, down to 3/4 of the cache size
+static void texcache_evict() {
+    char path[1024];
+    int count;
+    long long limit = (long long)texcache_max * (1024 * 1024) / 4 * 3;
+    texcache_file_t *files = texcache_scan(&count, &texcache_total);
+    qsort(files, count, sizeof(texcache_file_t), older_first);
+    for (int i = 0; i < count && texcache_total > limit; i++) {
+        snprintf(path, sizeof(path), "%s/%s", texcache_dir, files[i].name);
+        if (!unlink(path))
+            texcache_total -= files[i].size;
+    }
+    free(files);
+}
+
+void texcache_store(const texcache_key_t *key, const GLvoid *pixels, GLsizei width, GLsizei height,
+                    GLenum format, GLenum type, int shrink) {
+    char path[1024], tmp[1040];
+    texcache_header_t header = {TEXCACHE_MAGIC, width, height, format, type, shrink,
+        width * height * pixel_sizeof(format, type), {key->h[0], key->h[1]}};
+    long long size = sizeof(header) + header.size;
+    if (size > (long long)texcache_max * (1024 * 1024))
+        return;
+    if (texcache_total < 0) {
+        int count;
+        free(texcache_scan(&count, &texcache_total));
+    }
+    texcache_path(path, sizeof(path), key);
+    // written aside, then renamed: a reader never sees a partial entry
+    snprintf(tmp, sizeof(tmp), "%s.%d", path, (int)getpid());
+    int fd = open(tmp, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0 && errno == ENOENT) {
+        // first entry, or the directory was removed
+        mkdir(texcache_dir, 0755);
+        fd = open(tmp, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    }
+    if (fd < 0)
+        return;
+    int ok = (write(fd, &header, sizeof(header)) == sizeof(header))
+          && (write(fd, pixels, header.size) == header.size);
+    close(fd);
+    if (!ok || rename(tmp, path)) {
+        unlink(tmp);
+        return;
+    }
+    texcache_total += size;
+    if (texcache_total > (long long)texcache_max * (1024 * 1024))
+        texcache_evict();
+}
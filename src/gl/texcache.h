@@ -0,0 +1,39 @@
+#include "gl.h"
+
+#ifndef GL_TEXCACHE_H
+#define GL_TEXCACHE_H
+
+#include <stdint.h>
+
+// Optional on disk cache of the converted (and shrunk) textures, ready for GLES.
+// An entry is found by a hash of the source data, and of everything that changes the result.
+// The entries are mapped in memory, and uploaded from there
+
+extern char *texcache_dir;      // NULL if the cache is disabled
+extern int texcache_max;        // size of the cache in MB, the least recently used entries are removed beyond
+
+typedef struct {
+    uint64_t h[2];
+} texcache_key_t;
+
+typedef struct {
+    GLsizei width, height;
+    GLenum format, type;
+    int shrink;
+    GLvoid *pixels;     // NULL if nothing was loaded
+    void *map;
+    size_t map_size;
+} texcache_entry_t;
+
+// start a key with height rows of width pixels of pixel_size bytes (rows of row_length pixels, 0 if packed)
+void texcache_hash(texcache_key_t *key, const GLvoid *data, GLsizei width, GLsizei height,
+                   GLuint pixel_size, GLuint row_length);
+// add a parameter to the key
+void texcache_mix(texcache_key_t *key, GLuint value);
+// map the entry of key, returns 0 if there is none
+int texcache_load(const texcache_key_t *key, texcache_entry_t *entry);
+void texcache_release(texcache_entry_t *entry);
+void texcache_store(const texcache_key_t *key, const GLvoid *pixels, GLsizei width, GLsizei height,
+                    GLenum format, GLenum type, int shrink);
+
+#endif
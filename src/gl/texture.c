@@ -2,6 +2,8 @@
 #include "raster.h"
 #include "decompress.h"
 #include "debug.h"
+#include "texcache.h"
+#include "pool.h"
 #include "stb_dxt_104.h"
 #include <EGL/egl.h>
 #include <EGL/eglext.h>
@@ -60,6 +62,14 @@ void tex_coord_npot(GLfloat *tex, GLsizei len,
  * Or some NPOT texture used
  * Or SHRINKED texure used
  */
+int tex_setup_needchange(GLuint texunit) {
+    // does the tex_coord array need to be converted before use
+    gltexture_t *bound = glstate.texture.bound[texunit];
+    return ((glstate.texture.rect_arb[texunit]) || 
+        (bound && ((bound->width!=bound->nwidth)||(bound->height!=bound->nheight)||
+        (bound->shrink && (glstate.vao->pointers.tex_coord[texunit].type!=GL_FLOAT) && (glstate.vao->pointers.tex_coord[texunit].type!=GL_DOUBLE)))));
+}
+
 void tex_setup_texcoord(GLuint texunit, GLuint len) {
     LOAD_GLES(glTexCoordPointer);
     GLuint old = glstate.texture.client;
@@ -74,11 +84,7 @@ void tex_setup_texcoord(GLuint texunit, GLuint len) {
     gltexture_t *bound = glstate.texture.bound[texunit];
     
     // check if some changes are needed
-    int changes = 0;
-    if ((glstate.texture.rect_arb[texunit]) || 
-        (bound && ((bound->width!=bound->nwidth)||(bound->height!=bound->nheight)||
-        (bound->shrink && (glstate.vao->pointers.tex_coord[texunit].type!=GL_FLOAT) && (glstate.vao->pointers.tex_coord[texunit].type!=GL_DOUBLE)))))
-        changes = 1;
+    int changes = tex_setup_needchange(texunit);
 	if (old!=texunit) glshim_glClientActiveTexture(texunit+GL_TEXTURE0);
     if (changes) {
         // first convert to GLfloat, without normalization
@@ -162,10 +168,24 @@ void internal2format_type(GLenum internalformat, GLenum *format, GLenum *type)
     }
 }
 
-static void *swizzle_texture(GLsizei width, GLsizei height,
-                             GLenum *format, GLenum *type,
-                             GLenum intermediaryformat, GLenum internalformat,
-                             const GLvoid *data) {
+// GL_UNPACK_ROW_LENGTH / SKIP_PIXELS / SKIP_ROWS: returns the first pixel to read, and
+// in row_length the length of the source rows (0 when the rows are contiguous)
+static const GLvoid *unpack_rows(const GLvoid *data, GLsizei width,
+                                 GLenum format, GLenum type, GLuint *row_length) {
+    GLuint length = glstate.texture.unpack_row_length;
+    *row_length = (length && length != width) ? length : 0;
+    if (!data)
+        return data;
+    GLuint pixelSize = pixel_sizeof(format, type);
+    return (const GLubyte *)data + glstate.texture.unpack_skip_pixels * pixelSize
+        + glstate.texture.unpack_skip_rows * (length ? length : width) * pixelSize;
+}
+
+// the format and type GLES gets for pixels of format / type (that can be adjusted),
+// returns true if the pixels have to be converted to dest_format / dest_type
+static bool swizzle_format(GLenum *format, GLenum *type,
+                           GLenum intermediaryformat, GLenum *internalformat,
+                           GLenum *dest_format_out, GLenum *dest_type_out) {
     bool convert = false;
     GLenum dest_format = GL_RGBA;
     GLenum dest_type = GL_UNSIGNED_BYTE;
@@ -263,18 +283,37 @@ static void *swizzle_texture(GLsizei width, GLsizei height,
     // compressed format are not handled here, so mask them....
     if (is_fake_compressed_rgb(intermediaryformat)) intermediaryformat=GL_RGB;
     if (is_fake_compressed_rgba(intermediaryformat)) intermediaryformat=GL_RGBA;
-    if (is_fake_compressed_rgb(internalformat)) internalformat=GL_RGB;
-    if (is_fake_compressed_rgba(internalformat)) internalformat=GL_RGBA;
+    if (is_fake_compressed_rgb(*internalformat)) *internalformat=GL_RGB;
+    if (is_fake_compressed_rgba(*internalformat)) *internalformat=GL_RGBA;
     
-    if(*format != intermediaryformat || intermediaryformat!=internalformat) {
+    if(*format != intermediaryformat || intermediaryformat!=*internalformat) {
         internal2format_type(intermediaryformat, &dest_format, &dest_type);
         convert = true;
     }
+    *dest_format_out = dest_format;
+    *dest_type_out = dest_type;
+    return convert;
+}
+
+static void *swizzle_texture(GLsizei width, GLsizei height,
+                             GLenum *format, GLenum *type,
+                             GLenum intermediaryformat, GLenum internalformat,
+                             const GLvoid *data, GLuint row_length) {
+    GLenum dest_format, dest_type;
+    bool convert = swizzle_format(format, type, intermediaryformat, &internalformat, &dest_format, &dest_type);
 	if (data) {
+		if (!convert && row_length) {
+			// nothing to convert, only pack the rows
+			GLvoid *pixels = NULL;
+			pixel_convert_stride(data, &pixels, width, height,
+								*format, *type, row_length, *format, *type, 0);
+			return pixels;
+		}
 		if (convert) {
 			GLvoid *pixels = (GLvoid *)data;
-			if (! pixel_convert(data, &pixels, width, height,
-								*format, *type, dest_format, dest_type, 0)) {
+			// strided source rows are read directly by the conversion
+			if (! pixel_convert_stride(data, &pixels, width, height,
+								*format, *type, row_length, dest_format, dest_type, 0)) {
 				printf("libGL swizzle error: (%s, %s -> %s, %s)\n",
 					PrintEnum(*format), PrintEnum(*type), PrintEnum(dest_format), PrintEnum(dest_type));
 				return NULL;
@@ -298,17 +337,20 @@ static void *swizzle_texture(GLsizei width, GLsizei height,
                 *type = dest_type;
                 *format = dest_format;
             }
-			GLvoid *pix2 = pixels;
-			if (raster_need_transform())
-				if (!pixel_transform(data, &pixels, width, height,
+			if (raster_need_transform()) {
+				GLvoid *pix2 = NULL;
+				if (!pixel_transform(pixels, &pix2, width, height,
 								*format, *type, raster_scale, raster_bias)) {
 					printf("libGL swizzle/convert error: (%s, %s -> %s, %s)\n",
 						PrintEnum(*format), PrintEnum(*type), PrintEnum(dest_format), PrintEnum(dest_type));
-					pix2 = pixels;
+					free(pix2);
+				} else {
+					if (pixels!=data)
+						free(pixels);
+					pixels = pix2;
 				}
-			if (pix2!=pixels && pixels!=data)
-				free(pixels);
-			return pix2;
+			}
+			return pixels;
 		} 
     } else {
 		if (convert) {
@@ -427,6 +469,7 @@ GLenum swizzle_internalformat(GLenum *internalformat) {
 
 int automipmap = 0;
 int texcopydata = 0;
+int texcoalesce = 0;
 int tested_env = 0;
 int texshrink = 0;
 int texdump = 0;
@@ -439,6 +482,61 @@ static int proxy_width = 0;
 static int proxy_height = 0;
 static GLint proxy_intformat = 0;
 
+// on disk texture cache (LIBGL_TEXCACHE), for the textures worth it: not the small ones,
+// and not those re-specified again and again (videos, dynamic atlases)
+#define TEXCACHE_MIN_PIXELS 4096
+#define TEXCACHE_MAX_UPLOADS 2
+static inline int use_texcache(gltexture_t *tex, GLint level, GLsizei width, GLsizei height) {
+    return texcache_dir && !texstream && !raster_need_transform() && (width * height >= TEXCACHE_MIN_PIXELS)
+        && (level != 0 || tex->uploads < TEXCACHE_MAX_UPLOADS);
+}
+
+// true if LIBGL_SHRINK shrinks a texture of that size (the tests of glTexImage2D)
+static bool texshrink_applies(GLsizei width, GLsizei height) {
+    switch (texshrink) {
+        case 1:
+            return (width > 1) && (height > 1);
+        case 2:
+        case 7:
+            return (((width%2==0) && (height%2==0)) &&
+                ((width > 512) && (height > 8))) || ((height > 512) && (width > 8));
+        case 3:
+            return (((width%2==0) && (height%2==0)) &&
+                ((width > 256) && (height > 8))) || ((height > 256) && (width > 8));
+        case 4:
+        case 5:
+            return (((width%4==0) && (height%4==0)) &&
+                ((width > 256) && (height > 8))) || ((height > 256) && (width > 8));
+        case 6:
+            return (((width%2==0) && (height%2==0)) &&
+                ((width > 128) && (height > 8))) || ((height > 128) && (width > 8));
+        case 8:
+            return (width>2048) || (height>2048);
+        case 9:
+        case 10:
+            return (width>512) || (height>512);
+    }
+    return false;
+}
+
+// everything, beside the source data, that changes the converted texture
+static void texcache_params(texcache_key_t *key, GLsizei width, GLsizei height,
+                            GLenum format, GLenum type, GLint internalformat, GLenum new_format) {
+    texcache_mix(key, width);
+    texcache_mix(key, height);
+    texcache_mix(key, format);
+    texcache_mix(key, type);
+    texcache_mix(key, internalformat);
+    texcache_mix(key, new_format);
+    texcache_mix(key, texshrink);
+    texcache_mix(key, nolumalpha);
+}
+
+// set by glCompressedTexImage2D around glTexImage2D: the key of the compressed data,
+// or the entry already loaded from it
+static texcache_key_t *texcache_source = NULL;
+static texcache_entry_t *texcache_loaded = NULL;
+
 void glshim_glTexImage2D(GLenum target, GLint level, GLint internalformat,
                   GLsizei width, GLsizei height, GLint border,
                   GLenum format, GLenum type, const GLvoid *data) {
@@ -469,6 +567,8 @@ void glshim_glTexImage2D(GLenum target, GLint level, GLint internalformat,
 
     gltexture_t *bound = glstate.texture.bound[glstate.texture.active];
     if (bound) bound->alpha = pixel_hasalpha(format);
+    // level 0 is replaced, its pending updates can go
+    if (bound && bound->ndirty) texdirty_remove(bound, level != 0);
     if (automipmap) {
         if (bound && (level>0))
             if ((automipmap==1) || (automipmap==3) || bound->mipmap_need) {
@@ -483,37 +583,57 @@ void glshim_glTexImage2D(GLenum target, GLint level, GLint internalformat,
          bound->orig_internal = internalformat;
          bound->internalformat = new_format;
      }
+     texcache_key_t key;
+     texcache_entry_t cached = {0};
      if (datab) {
 
-        // implements GL_UNPACK_ROW_LENGTH
-        if ((glstate.texture.unpack_row_length && glstate.texture.unpack_row_length != width) || glstate.texture.unpack_skip_pixels || glstate.texture.unpack_skip_rows) {
-            int imgWidth, pixelSize;
-            pixelSize = pixel_sizeof(format, type);
-            imgWidth = ((glstate.texture.unpack_row_length)? glstate.texture.unpack_row_length:width) * pixelSize;
-            GLubyte *dst = (GLubyte *)malloc(width * height * pixelSize);
-            pixels = (GLvoid *)dst;
-            const GLubyte *src = (GLubyte *)datab;
-            src += glstate.texture.unpack_skip_pixels * pixelSize + glstate.texture.unpack_skip_rows * imgWidth;
-            for (int y = 0; y < height; y += 1) {
-                memcpy(dst, src, width * pixelSize);
-                src += imgWidth;
-                dst += width;
+        // implements GL_UNPACK_ROW_LENGTH (the strided rows are packed by the conversion)
+        GLuint row_length;
+        datab = (GLvoid *)unpack_rows(datab, width, format, type, &row_length);
+
+        // the final texture may be in the disk cache
+        int store = 0;
+        if (texcache_loaded) {
+            cached = *texcache_loaded;
+        } else if (bound && use_texcache(bound, level, width, height)) {
+            // only what is decompressed, converted or shrunk is in the cache
+            GLenum swizzled_format = format, swizzled_type = type, gles_format = new_format, dest_format, dest_type;
+            if (texcache_source || texshrink_applies(width, height)
+                || swizzle_format(&swizzled_format, &swizzled_type, internalformat, &gles_format, &dest_format, &dest_type)) {
+                if (texcache_source)
+                    key = *texcache_source;
+                else
+                    texcache_hash(&key, datab, width, height, pixel_sizeof(format, type), row_length);
+                texcache_params(&key, width, height, format, type, internalformat, new_format);
+                store = !texcache_load(&key, &cached);
             }
         }
+        if (bound && level == 0)
+            bound->uploads++;
+        if (cached.pixels) {
+            pixels = cached.pixels;
+            width = cached.width;
+            height = cached.height;
+            format = cached.format;
+            type = cached.type;
+        }
 
-        GLvoid *old = pixels;
-        pixels = (GLvoid *)swizzle_texture(width, height, &format, &type, internalformat, new_format, old);
+        GLvoid *old = datab;
+        if (!cached.pixels)
+            pixels = (GLvoid *)swizzle_texture(width, height, &format, &type, internalformat, new_format, old, row_length);
         if (old != pixels && old != datab) {
             free(old);
         }
 
-        if (bound) {
+        if (bound && cached.pixels) {
+            bound->shrink = cached.shrink;
+        } else if (bound) {
         bound->shrink = 0;
         switch(texshrink) {
             case 0: // nothing
                 break;
             case 1: //everything / 2
-                if ((width > 1) && (height > 1)) {
+                if (texshrink_applies(width, height)) {
                     GLvoid *out = pixels;
                     GLfloat ratio = 0.5;
                     pixel_scale(pixels, &out, width, height, ratio, format, type);
@@ -527,8 +647,7 @@ void glshim_glTexImage2D(GLenum target, GLint level, GLint internalformat,
                 break;
             case 2: //only > 512 /2
             case 7: //only > 512 /2 , but not for empty texture
-                if (((width%2==0) && (height%2==0)) && 
-                    ((width > 512) && (height > 8)) || ((height > 512) && (width > 8))) {
+                if (texshrink_applies(width, height)) {
                     GLvoid *out = pixels;
                     pixel_halfscale(pixels, &out, width, height, format, type);
                     if (out != pixels && pixels!=datab)
@@ -540,8 +659,7 @@ void glshim_glTexImage2D(GLenum target, GLint level, GLint internalformat,
                 }
                 break;
             case 3: //only > 256 /2
-                if (((width%2==0) && (height%2==0)) && 
-                    ((width > 256) && (height > 8)) || ((height > 256) && (width > 8))) {
+                if (texshrink_applies(width, height)) {
                     GLvoid *out = pixels;
                     pixel_halfscale(pixels, &out, width, height, format, type);
                     if (out != pixels && pixels!=datab)
@@ -554,8 +672,7 @@ void glshim_glTexImage2D(GLenum target, GLint level, GLint internalformat,
                 break;
             case 4: //only > 256 /2, >=1024 /4
             case 5: //every > 256 is downscaled to 256, but not for empty texture   (as there is no downscale stronger than 4, there are the same)
-                if (((width%4==0) && (height%4==0)) && 
-                    ((width > 256) && (height > 8)) || ((height > 256) && (width > 8))) {
+                if (texshrink_applies(width, height)) {
                     if ((width>=1024) || (height>=1024)) {
                         GLvoid *out = pixels;
                         pixel_quarterscale(pixels, &out, width, height, format, type);
@@ -591,8 +708,7 @@ void glshim_glTexImage2D(GLenum target, GLint level, GLint internalformat,
                 }
                 break;*/
             case 6: //only > 128 /2, >=512 is downscaled to 256, but not for empty texture
-                if (((width%2==0) && (height%2==0)) && 
-                    ((width > 128) && (height > 8)) || ((height > 128) && (width > 8))) {
+                if (texshrink_applies(width, height)) {
                     if (((width%2==0) && (height%2==0)) && (width>=512) || (height>=512)) {
                         while (((width > 256) && (height > 8)) || ((height > 256) && (width > 8))) {
                             GLvoid *out = pixels;
@@ -627,7 +743,7 @@ void glshim_glTexImage2D(GLenum target, GLint level, GLint internalformat,
                     height /= 4;
                     bound->shrink=2;
                 } else
-                if ((width>2048) || (height>2048)) {
+                if (texshrink_applies(width, height)) {
                     GLvoid *out = pixels;
                     pixel_halfscale(pixels, &out, width, height, format, type);
                     if (out != pixels && pixels!=datab)
@@ -649,7 +765,7 @@ void glshim_glTexImage2D(GLenum target, GLint level, GLint internalformat,
                     height /= 4;
                     bound->shrink=2;
                 } else
-                if ((width>512) || (height>512)) {
+                if (texshrink_applies(width, height)) {
                     GLvoid *out = pixels;
                     pixel_halfscale(pixels, &out, width, height, format, type);
                     if (out != pixels && pixels!=datab)
@@ -671,7 +787,7 @@ void glshim_glTexImage2D(GLenum target, GLint level, GLint internalformat,
                     height /= 4;
                     bound->shrink=2;
                 } else
-                if ((width>512) || (height>512)) {
+                if (texshrink_applies(width, height)) {
                     GLvoid *out = pixels;
                     pixel_halfscale(pixels, &out, width, height, format, type);
                     if (out != pixels && pixels!=datab)
@@ -684,6 +800,9 @@ void glshim_glTexImage2D(GLenum target, GLint level, GLint internalformat,
                 break;
             }
         }
+        // only what was converted, shrunk or decompressed is worth keeping
+        if (store && (pixels != datab || texcache_source))
+            texcache_store(&key, pixels, width, height, format, type, bound->shrink);
         
         if (texdump) {
             if (bound) {
@@ -714,7 +833,7 @@ void glshim_glTexImage2D(GLenum target, GLint level, GLint internalformat,
 	    if (bound) {
             bound->shrink = 0;
             if (!bound->streamed)
-                swizzle_texture(width, height, &format, &type, internalformat, new_format, NULL);	// convert format even if data is NULL
+                swizzle_texture(width, height, &format, &type, internalformat, new_format, NULL, 0);	// convert format even if data is NULL
             if ((texshrink>0) && !bound->streamed) {
                 switch(texshrink) {
                     case 1: //everything / 2
@@ -838,24 +957,178 @@ void glshim_glTexImage2D(GLenum target, GLint level, GLint internalformat,
                 }
         }
     }
-    if ((target==GL_TEXTURE_2D) && texcopydata && bound && ((texstream && !bound->streamed) || !texstream)) {
+    if (bound) bound->shadow = false;
+    if ((target==GL_TEXTURE_2D) && (texcopydata || texcoalesce) && bound && ((texstream && !bound->streamed) || !texstream)) {
 	    if (bound->data) 
 			bound->data=realloc(bound->data, width*height*4);
 	    else 
 			bound->data = malloc(width*height*4);
+	    bound->shadow = (level == 0) && !bound->shrink;
 	    if (datab) {
-		    if (!pixel_convert(pixels, &bound->data, width, height, format, type, GL_RGBA, GL_UNSIGNED_BYTE, 0))
+		    if (!pixel_convert(pixels, &bound->data, width, height, format, type, GL_RGBA, GL_UNSIGNED_BYTE, 0)) {
 			    printf("LIBGL: Error on pixel_convert when TEXCOPY in glTexImage2D\n");
+			    bound->shadow = false;
+		    }
+	    } else if (texcoalesce) {
+		    // undefined content, but the dirty rects may upload some of it
+		    memset(bound->data, 0, width*height*4);
 	    } else {
 		//memset(bound->data, 0, width*height*4);
 	    }
 	}
-    if (pixels != datab) {
+    if (cached.pixels) {
+        if (!texcache_loaded)
+            texcache_release(&cached);
+    } else if (pixels != datab) {
         free(pixels);
     }
     glstate.gl_batch = old_glbatch;
 }
 
+// Coalescing of glTexSubImage2D (LIBGL_TEXCOALESCE): small updates of level 0 only go in
+// the RGBA copy of the texture (bound->data) and are recorded as dirty rects. Overlapping or
+// touching rects are merged, and the textures are uploaded rect by rect before the next draw
+#define TEXDIRTY_TEXTURES 16
+int texdirty_count = 0;
+static gltexture_t *texdirty_list[TEXDIRTY_TEXTURES];
+
+static void texdirty_upload(gltexture_t *tex) {
+    LOAD_GLES(glBindTexture);
+    LOAD_GLES(glTexSubImage2D);
+    LOAD_GLES(glTexParameteri);
+    gles_glBindTexture(GL_TEXTURE_2D, tex->glname);
+    GLboolean mipmap = tex->mipmap_need && !tex->mipmap_auto && (automipmap!=3);
+    for (int i = 0; i < tex->ndirty; i++) {
+        texrect_t *r = &tex->dirty[i];
+        GLsizei width = r->x2 - r->x1, height = r->y2 - r->y1;
+        GLvoid *pixels = NULL;
+        if (!pixel_convert_stride(tex->data + (r->y1 * tex->width + r->x1) * 4, &pixels, width, height,
+                                  GL_RGBA, GL_UNSIGNED_BYTE, tex->width, tex->format, tex->type, 0)) {
+            printf("LIBGL: Error in pixel_convert while uploading dirty rects\n");
+            continue;
+        }
+        if (mipmap && (i == tex->ndirty - 1))
+            gles_glTexParameteri(GL_TEXTURE_2D, GL_GENERATE_MIPMAP, GL_TRUE);
+        gles_glTexSubImage2D(GL_TEXTURE_2D, 0, r->x1, r->y1, width, height, tex->format, tex->type, pixels);
+        free(pixels);
+    }
+    if (mipmap)
+        gles_glTexParameteri(GL_TEXTURE_2D, GL_GENERATE_MIPMAP, GL_FALSE);
+    tex->ndirty = 0;
+}
+
+static void texdirty_rebind() {
+    LOAD_GLES(glBindTexture);
+    gltexture_t *bound = glstate.texture.bound[glstate.texture.active];
+    gles_glBindTexture(GL_TEXTURE_2D, (bound) ? bound->glname : 0);
+}
+
+void texdirty_flush() {
+    for (int i = 0; i < texdirty_count; i++)
+        texdirty_upload(texdirty_list[i]);
+    texdirty_count = 0;
+    texdirty_rebind();
+}
+
+void texdirty_remove(gltexture_t *tex, int upload) {
+    if (!tex->ndirty)
+        return;
+    if (upload) {
+        texdirty_upload(tex);
+        texdirty_rebind();
+    }
+    tex->ndirty = 0;
+    for (int i = 0; i < texdirty_count; i++)
+        if (texdirty_list[i] == tex) {
+            texdirty_list[i] = texdirty_list[--texdirty_count];
+            break;
+        }
+}
+
+static void texdirty_add(gltexture_t *tex, GLint x, GLint y, GLsizei width, GLsizei height) {
+    texrect_t r = {x, y, x + width, y + height};
+    int listed = (tex->ndirty > 0);
+    #define merge(d) \
+        if (d.x1 < r.x1) r.x1 = d.x1; \
+        if (d.y1 < r.y1) r.y1 = d.y1; \
+        if (d.x2 > r.x2) r.x2 = d.x2; \
+        if (d.y2 > r.y2) r.y2 = d.y2;
+    #define area(a) ((a).x2 - (a).x1) * ((a).y2 - (a).y1)
+    while (1) {
+        // merge with the rects it overlaps or touches (the result may touch others)
+        int i = 0;
+        while (i < tex->ndirty) {
+            texrect_t d = tex->dirty[i];
+            if (d.x1 <= r.x2 && r.x1 <= d.x2 && d.y1 <= r.y2 && r.y1 <= d.y2) {
+                merge(d);
+                tex->dirty[i] = tex->dirty[--tex->ndirty];
+                i = 0;
+            } else
+                i++;
+        }
+        if (tex->ndirty < TEXDIRTY_RECTS)
+            break;
+        // too many rects, merge with the one that grows the least
+        int best = 0;
+        GLint best_cost = 0;
+        for (i = 0; i < tex->ndirty; i++) {
+            texrect_t d = tex->dirty[i];
+            texrect_t u = {(d.x1 < r.x1) ? d.x1 : r.x1, (d.y1 < r.y1) ? d.y1 : r.y1,
+                           (d.x2 > r.x2) ? d.x2 : r.x2, (d.y2 > r.y2) ? d.y2 : r.y2};
+            GLint cost = area(u) - area(d);
+            if (!i || cost < best_cost) {
+                best = i;
+                best_cost = cost;
+            }
+        }
+        merge(tex->dirty[best]);
+        tex->dirty[best] = tex->dirty[--tex->ndirty];
+    }
+    #undef area
+    #undef merge
+    if (!listed) {
+        if (texdirty_count == TEXDIRTY_TEXTURES)
+            texdirty_flush();
+        texdirty_list[texdirty_count++] = tex;
+    }
+    tex->dirty[tex->ndirty++] = r;
+}
+
+// Upload of a big sub image without a converted copy of the whole image: the source rows
+// are converted (or just packed) in a band buffer, and sent band by band.
+// GL_GENERATE_MIPMAP is only set for the last band
+#define UPLOAD_BAND_PIXELS 65536
+static GLboolean texsubimage_bands(GLenum target, GLint level, GLint xoffset, GLint yoffset,
+                                   GLsizei width, GLsizei height, GLenum format, GLenum type,
+                                   const GLvoid *data, GLuint row_length,
+                                   GLenum dest_format, GLenum dest_type, GLboolean mipmap) {
+    LOAD_GLES(glTexSubImage2D);
+    LOAD_GLES(glTexParameteri);
+    GLsizei rows = UPLOAD_BAND_PIXELS / width;
+    if (rows < 1)
+        rows = 1;
+    GLuint src_line = (row_length ? row_length : width) * pixel_sizeof(format, type);
+    GLvoid *band = malloc(rows * width * pixel_sizeof(dest_format, dest_type));
+    for (GLsizei y = 0; y < height; y += rows) {
+        GLsizei n = (height - y < rows) ? height - y : rows;
+        GLvoid *dst = band;
+        if (!pixel_convert_stride((const GLubyte *)data + y * src_line, &dst, width, n,
+                                  format, type, row_length, dest_format, dest_type, 0)) {
+            // unsupported conversion (only the first band can fail), let the usual path report it
+            free(band);
+            return GL_FALSE;
+        }
+        if (mipmap && (y + n == height))
+            gles_glTexParameteri(target, GL_GENERATE_MIPMAP, GL_TRUE);
+        gles_glTexSubImage2D(target, level, xoffset, yoffset + y, width, n, dest_format, dest_type, band);
+        errorGL();
+    }
+    if (mipmap)
+        gles_glTexParameteri(target, GL_GENERATE_MIPMAP, GL_FALSE);
+    free(band);
+    return GL_TRUE;
+}
+
 void glshim_glTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset,
                      GLsizei width, GLsizei height, GLenum format, GLenum type,
                      const GLvoid *data) {
@@ -893,20 +1166,10 @@ void glshim_glTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yof
                 bound->mipmap_need = 1;
     }
 
-    if ((glstate.texture.unpack_row_length && glstate.texture.unpack_row_length != width) || glstate.texture.unpack_skip_pixels || glstate.texture.unpack_skip_rows) {
-	    int imgWidth, pixelSize;
-	    pixelSize = pixel_sizeof(format, type);
-	    imgWidth = ((glstate.texture.unpack_row_length)? glstate.texture.unpack_row_length:width) * pixelSize;
-	    GLubyte *dst = (GLubyte *)malloc(width * height * pixelSize);
-	    pixels = (GLvoid *)dst;
-	    const GLubyte *src = (GLubyte *)datab;
-	    src += glstate.texture.unpack_skip_pixels * pixelSize + glstate.texture.unpack_skip_rows * imgWidth;
-	    for (int y = 0; y < height; y ++) {
-		    memcpy(dst, src, width * pixelSize);
-		    src += imgWidth;
-		    dst += width * pixelSize;
-	    }
-    }
+    // implements GL_UNPACK_ROW_LENGTH (the strided rows are packed by the conversion)
+    GLuint row_length;
+    datab = (GLvoid *)unpack_rows(datab, width, format, type, &row_length);
+    pixels = datab;
     
     // compressed format are not handled here, so mask them....
     GLenum orig_internal = bound->orig_internal;
@@ -916,6 +1179,32 @@ void glshim_glTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yof
     if (internalformat==GL_COMPRESSED_RGB) internalformat=GL_RGB;
     if (internalformat==GL_COMPRESSED_RGBA) internalformat=GL_RGBA;
 
+    // small updates of a texture with a full copy are only recorded, see texdirty_add
+    if (texcoalesce && bound->shadow && (target==GL_TEXTURE_2D) && (level==0) && !bound->shrink
+        && !texdump && !(texstream && bound->streamed) && (width * height < UPLOAD_BAND_PIXELS)
+        && (xoffset >= 0) && (yoffset >= 0) && (xoffset + width <= bound->width) && (yoffset + height <= bound->height)) {
+        GLvoid *tmp = bound->data + (yoffset * bound->width + xoffset) * 4;
+        if (pixel_convert_stride(datab, &tmp, width, height, format, type, row_length,
+                                 GL_RGBA, GL_UNSIGNED_BYTE, bound->width)) {
+            texdirty_add(bound, xoffset, yoffset, width, height);
+            glstate.gl_batch = old_glbatch;
+            return;
+        }
+    }
+
+    // big updates that need a copy are converted and uploaded by bands of rows
+    if (!bound->shrink && !texdump && !((target==GL_TEXTURE_2D) && (texcopydata || texcoalesce)) && !(texstream && bound->streamed)
+        && (orig_internal == internalformat) && (width * height >= 2 * UPLOAD_BAND_PIXELS)) {
+        GLenum dest_format, dest_type;
+        internal2format_type(orig_internal, &dest_format, &dest_type);
+        GLboolean mipmap = bound->mipmap_need && !bound->mipmap_auto && (automipmap!=3);
+        if ((row_length || format != dest_format || type != dest_type)
+            && texsubimage_bands(target, level, xoffset, yoffset, width, height, format, type,
+                                 datab, row_length, dest_format, dest_type, mipmap)) {
+            glstate.gl_batch = old_glbatch;
+            return;
+        }
+    }
 
     GLvoid *old = pixels;
 #ifdef TEXSTREAM
@@ -923,8 +1212,8 @@ void glshim_glTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yof
 		// Optimisation, let's do convert directly to the right place...
 		GLvoid *tmp = GetStreamingBuffer(bound->streamingID);
 		tmp += (yoffset*bound->width+xoffset)*2;
-		if (! pixel_convert(old, &tmp, width, height,
-						format, type, GL_RGB, GL_UNSIGNED_SHORT_5_6_5, bound->width)) {
+		if (! pixel_convert_stride(old, &tmp, width, height,
+						format, type, row_length, GL_RGB, GL_UNSIGNED_SHORT_5_6_5, bound->width)) {
 			printf("libGL swizzle error: (%#4x, %#4x -> GL_RGB, UNSIGNED_SHORT_5_6_5)\n",
 						format, type);
 		}
@@ -936,7 +1225,7 @@ void glshim_glTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yof
         //pixels = (GLvoid *)swizzle_texture(width, height, &format, &type, old);
         GLenum dest_format, dest_type;
         internal2format_type(orig_internal, &dest_format, &dest_type);
-        if (!pixel_convert(old, &pixels, width, height, format, type, dest_format, dest_type, 0)) {
+        if (!pixel_convert_stride(old, &pixels, width, height, format, type, row_length, dest_format, dest_type, 0)) {
             printf("LIBGL: Error in pixel_convert while glTexSubImage2D\n");
         } else {
             format = dest_format;
@@ -980,7 +1269,7 @@ void glshim_glTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yof
             pixel_halfscale(pixels, &old, width, height, format, type);
         else
             pixel_quarterscale(pixels, &old, width, height, format, type);
-        if (old != pixels && pixels!=data)
+        if (old != pixels && pixels!=datab)
             free(pixels);
         pixels = old;
         width /= 2*bound->shrink;
@@ -1011,7 +1300,7 @@ void glshim_glTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yof
     if (bound && bound->mipmap_need && !bound->mipmap_auto && (automipmap!=3) && (!texstream || (texstream && !bound->streamed)))
         gles_glTexParameteri( target, GL_GENERATE_MIPMAP, GL_FALSE );
 
-    if ((target==GL_TEXTURE_2D) && texcopydata && bound && ((texstream && !bound->streamed) || !texstream)) {
+    if ((target==GL_TEXTURE_2D) && (texcopydata || texcoalesce) && bound && ((texstream && !bound->streamed) || !texstream)) {
     //printf("*texcopy* glTexSubImage2D, xy=%i,%i, size=%i,%i=>%i,%i, format=%s, type=%s, tex=%u\n", xoffset, yoffset, width, height, bound->width, bound->height, PrintEnum(format), PrintEnum(type), bound->glname);
         GLvoid * tmp = bound->data;
         tmp += (yoffset*bound->width + xoffset)*4;
@@ -1179,11 +1468,15 @@ gltexture_t* glshim_getTexture(GLenum target, GLuint texture) {
         tex->orig_internal = GL_RGBA;
         tex->internalformat = GL_RGBA;
         tex->data = NULL;
+        tex->shadow = false;
+        tex->ndirty = 0;
+        tex->uploads = 0;
     } else {
         tex = kh_value(list, k);
     }
     return tex;
 }
+extern GLuint gl_batchsort;
 #define batch_activetex (glstate.statebatch.active_tex_changed?(glstate.statebatch.active_tex-GL_TEXTURE0):glstate.texture.active)
 void glshim_glBindTexture(GLenum target, GLuint texture) {
 	noerrorShim();
@@ -1191,7 +1484,8 @@ void glshim_glBindTexture(GLenum target, GLuint texture) {
         //printf("=> glBindTexture(0x%04X, %u), active=%i, client=%i, batch_active=%i, batch_bound=0x%04X, batch_tex=%u\n", target, texture, glstate.texture.active, glstate.texture.client, batch_activetex, glstate.statebatch.bound_targ[batch_activetex], glstate.statebatch.bound_tex[batch_activetex]);
         if ((glstate.statebatch.bound_targ[batch_activetex] == target) && (glstate.statebatch.bound_tex[batch_activetex] == texture))
             return; // nothing to do...
-        if (glstate.statebatch.bound_targ[batch_activetex]) {
+        // with LIBGL_BATCHSORT, texture changes are kept in the batch, to be reordered at flush
+        if (glstate.statebatch.bound_targ[batch_activetex] && !gl_batchsort) {
             flush();
         }
         glstate.statebatch.bound_targ[batch_activetex] = target;
@@ -1341,6 +1635,7 @@ void glshim_glDeleteTextures(GLsizei n, const GLuint *textures) {
             k = kh_get(tex, list, t);
             if (k != kh_end(list)) {
                 tex = kh_value(list, k);
+                texdirty_remove(tex, 0);
                 int a;
                 for (a=0; a<MAX_TEX; a++) {
                     if (tex == glstate.texture.bound[a])
@@ -1407,6 +1702,9 @@ void glshim_glGenTextures(GLsizei n, GLuint * textures) {
             tex->format = GL_RGBA;
             tex->type = GL_UNSIGNED_BYTE;
 			tex->data = NULL;
+			tex->shadow = false;
+			tex->ndirty = 0;
+			tex->uploads = 0;
 		} else {
 			tex = kh_value(list, k);
 			// in case of no delete here...
@@ -1523,6 +1821,7 @@ extern GLuint current_fb;   // from framebuffers.c
 
 void glshim_glGetTexImage(GLenum target, GLint level, GLenum format, GLenum type, GLvoid * img) {
     if (glstate.gl_batch) flush();
+    texdirty_sync();
 	if (glstate.texture.bound[glstate.texture.active]==NULL)
 		return;		// no texture bounded...
 	gltexture_t* bound = glstate.texture.bound[glstate.texture.active];
@@ -1643,7 +1942,7 @@ void glshim_glReadPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum
 		dst += (uintptr_t)glstate.vao->pack->data;
 		
 	readfboBegin();
-    if (format == GL_RGBA && format == GL_UNSIGNED_BYTE) {
+    if (format == GL_RGBA && type == GL_UNSIGNED_BYTE) {
         // easy passthru
         gles_glReadPixels(x, y, width, height, GL_RGBA, GL_UNSIGNED_BYTE, dst);
         readfboEnd();
@@ -1706,6 +2005,9 @@ void glshim_glCopyTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint
 #endif
     {
         if (copytex) {
+            // the copy of the texture is not updated
+            texdirty_remove(bound, 1);
+            bound->shadow = false;
             gles_glCopyTexSubImage2D(target, level, xoffset, yoffset, x, y, width, height);
         } else {
             void* tmp = malloc(width*height*4);
@@ -1743,6 +2045,12 @@ void glshim_glCopyTexImage2D(GLenum target,  GLint level,  GLenum internalformat
     
     if (copytex) {
         LOAD_GLES(glCopyTexImage2D);
+        gltexture_t *bound = glstate.texture.bound[glstate.texture.active];
+        if (bound) {
+            // the copy of the texture is not updated
+            texdirty_remove(bound, level != 0);
+            bound->shadow = false;
+        }
         gles_glCopyTexImage2D(target, level, GL_RGB, x, y, width, height, border);
     } else {
         void* tmp = malloc(width*height*4);
@@ -1783,49 +2091,39 @@ GLboolean isNotCompressed(GLenum format) {
     return false;
 }
 
-GLvoid *uncompressDXTc(GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const GLvoid *data) {
-	// uncompress a DXTc image
-	// get pixel size of uncompressed image => fixed RGBA
-	int pixelsize = 4;
-/*	if (format==COMPRESSED_RGB_S3TC_DXT1_EXT)
-		pixelsize = 3;*/
-	// check with the size of the input data stream if the stream is in fact uncompressed
-	if (imageSize == width*height*pixelsize || data==NULL) {
-		// uncompressed stream
-		return (GLvoid*)data;
-	}
-	// alloc memory
-	GLvoid *pixels = malloc(((width+3)&~3)*((height+3)&~3)*pixelsize);
-	// uncompress loop
-	int blocksize;
-	switch (format) {
-		case GL_COMPRESSED_RGB_S3TC_DXT1_EXT:
-		case GL_COMPRESSED_RGBA_S3TC_DXT1_EXT:
-			blocksize = 8;
-			break;
-		case GL_COMPRESSED_RGBA_S3TC_DXT3_EXT:
-		case GL_COMPRESSED_RGBA_S3TC_DXT5_EXT:
-			blocksize = 16;
-			break;
-	}
-	uintptr_t src = (uintptr_t) data;
-	for (int y=0; y<height; y+=4) {
-		for (int x=0; x<width; x+=4) {
-			switch(format) {
-				case GL_COMPRESSED_RGB_S3TC_DXT1_EXT:
-				case GL_COMPRESSED_RGBA_S3TC_DXT1_EXT:
-					DecompressBlockDXT1(x, y, width, (uint8_t*)src, pixels);
-					break;
-				case GL_COMPRESSED_RGBA_S3TC_DXT3_EXT:
-					DecompressBlockDXT3(x, y, width, (uint8_t*)src, pixels);
-					break;
-				case GL_COMPRESSED_RGBA_S3TC_DXT5_EXT:
-					DecompressBlockDXT5(x, y, width, (uint8_t*)src, pixels);
-					break;
-			}
-			src+=blocksize;
-		}
+// DXT images are decoded in bands of block rows, on the worker pool
+#define DXT_BAND_PIXELS 16384
+
+typedef struct {
+    GLenum format, type;
+    const GLvoid *data;
+    GLsizei width, height;
+    GLvoid *pixels;
+} dxt_band_t;
+
+static void dxt_band(void *data, int start, int end) {
+    dxt_band_t *b = (dxt_band_t *)data;
+    DecompressDXT(b->format, b->data, b->width, b->height, start, end, b->type, b->pixels);
+}
+
+// uncompress a DXTc image, to RGBA (type GL_UNSIGNED_BYTE), or directly to RGB565 / RGBA4444
+GLvoid *uncompressDXTc(GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const GLvoid *data, GLenum type) {
+	if (data==NULL)
+		return NULL;
+	// check with the size of the input data stream if the stream is in fact uncompressed (RGBA),
+	// against the size padded to whole blocks, or small mip levels would match by accident
+	GLsizei padded = (width+3)&~3;
+	if (imageSize == padded*((height+3)&~3)*4) {
+		// uncompressed stream, cropped and converted like the decoded ones
+		GLvoid *pixels = (GLvoid*)data;
+		pixel_convert_stride(data, &pixels, width, height, GL_RGBA, GL_UNSIGNED_BYTE, (padded!=width)?padded:0,
+		                     (type==GL_UNSIGNED_SHORT_5_6_5)?GL_RGB:GL_RGBA, type, 0);
+		return pixels;
 	}
+	GLvoid *pixels = malloc(width*height*((type==GL_UNSIGNED_BYTE)?4:2));
+	dxt_band_t band = {format, type, data, width, height, pixels};
+	int rows = DXT_BAND_PIXELS / (width*4);
+	pool_run((height+3)/4, (rows>0)?rows:1, dxt_band, &band);
 	return pixels;
 }
 
@@ -1878,36 +2176,33 @@ void glshim_glCompressedTexImage2D(GLenum target, GLint level, GLenum internalfo
     if (isDXTc(internalformat)) {
 		GLvoid *pixels, *half;
         int fact = 0;
-        if (datab) {
-            if (width<4 || height<4) {	// can happens :(
-                GLvoid *tmp;
-                GLsizei nw=width;
-                GLsizei nh=height;
-                if (nw<4) nw = 4;
-                if (nh<4) nh = 4;
-                tmp = uncompressDXTc(nw, nh, internalformat, imageSize, datab);
-                pixels = malloc(4*width*height);
-                // crop
-                for (int y=0; y<height; y++)
-                    memcpy(pixels+y*width*4, tmp+y*nw*4, width*4);
-                free(tmp);
-            } else {
-                pixels = uncompressDXTc(width, height, internalformat, imageSize, datab);
-            }
-            // automaticaly reduce the pixel size
-            half=pixels;
+        texcache_key_t key;
+        texcache_entry_t cached = {0};
+        if (datab && use_texcache(glstate.texture.bound[glstate.texture.active], level, width, height)) {
+            // the cache entry is found from the compressed data, without decompressing it
+            texcache_hash(&key, datab, imageSize, 1, 1, 0);
+            texcache_mix(&key, internalformat);
+            texcache_source = &key;
+            texcache_key_t full = key;
+            format = (internalformat==GL_COMPRESSED_RGB_S3TC_DXT1_EXT)?GL_RGB:GL_RGBA;
+            type = (internalformat==GL_COMPRESSED_RGB_S3TC_DXT1_EXT)?GL_UNSIGNED_SHORT_5_6_5:GL_UNSIGNED_SHORT_4_4_4_4;
+            texcache_params(&full, width, height, format, type, GL_RGBA, GL_RGBA);
+            texcache_load(&full, &cached);
+        }
+        if (cached.pixels) {
+            glstate.texture.bound[glstate.texture.active]->alpha = (internalformat==GL_COMPRESSED_RGB_S3TC_DXT1_EXT)?false:true;
+            texcache_loaded = &cached;
+            pixels = half = datab;
+        } else if (datab) {
+            // automaticaly reduce the pixel size, decoding directly to 16 bits pixels
             glstate.texture.bound[glstate.texture.active]->alpha = (internalformat==GL_COMPRESSED_RGB_S3TC_DXT1_EXT)?false:true;
             format = (internalformat==GL_COMPRESSED_RGB_S3TC_DXT1_EXT)?GL_RGB:GL_RGBA;
             glstate.texture.bound[glstate.texture.active]->format = format; //internalformat;
             type = (internalformat==GL_COMPRESSED_RGB_S3TC_DXT1_EXT)?GL_UNSIGNED_SHORT_5_6_5:GL_UNSIGNED_SHORT_4_4_4_4;
             glstate.texture.bound[glstate.texture.active]->type = type;
             glstate.texture.bound[glstate.texture.active]->compressed = true;
-            if (pixel_convert(pixels, &half, width, height, GL_RGBA, GL_UNSIGNED_BYTE, format, type, 0))
-                fact = 0;
-//            if (pixel_thirdscale(pixels, &half, width, height, GL_RGBA, GL_UNSIGNED_BYTE)) 
-//                fact = 1;
-            else
-                glstate.texture.bound[glstate.texture.active]->type = GL_UNSIGNED_BYTE;
+            pixels = uncompressDXTc(width, height, internalformat, imageSize, datab, type);
+            half=pixels;
         } else {
             half = NULL;
             fact = 1;
@@ -1919,6 +2214,9 @@ void glshim_glCompressedTexImage2D(GLenum target, GLint level, GLenum internalfo
 		glshim_glTexImage2D(target, level, GL_RGBA, width>>fact, height>>fact, border, format, type, half);
 		if (oldalign!=1) 
             glshim_glPixelStorei(GL_UNPACK_ALIGNMENT, oldalign);
+		texcache_source = NULL;
+		texcache_loaded = NULL;
+		texcache_release(&cached);
 		if (half!=pixels)
 			free(half);
 		if (pixels!=datab)
@@ -1965,22 +2263,7 @@ void glshim_glCompressedTexSubImage2D(GLenum target, GLint level, GLint xoffset,
     LOAD_GLES(glCompressedTexSubImage2D);
     errorGL();
     if (isDXTc(format)) {
-		GLvoid *pixels;
-		if (width<4 || height<4) {	// can happens :(
-			GLvoid *tmp;
-			GLsizei nw=width;
-			GLsizei nh=height;
-			if (nw<4) nw = 4;
-			if (nh<4) nh = 4;
-			tmp = uncompressDXTc(nw, nh, format, imageSize, datab);
-			pixels = malloc(4*width*height);
-			// crop
-			for (int y=0; y<height; y++)
-				memcpy(pixels+y*width*4, tmp+y*nw*4, width*4);
-			free(tmp);
-		} else {
-			pixels = uncompressDXTc(width, height, format, imageSize, datab);
-		}
+		GLvoid *pixels = uncompressDXTc(width, height, format, imageSize, datab, GL_UNSIGNED_BYTE);
 		GLvoid *half=pixels;
 		#if 1
 		pixel_thirdscale(pixels, &half, width, height, GL_RGBA, GL_UNSIGNED_BYTE);
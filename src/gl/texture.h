@@ -83,6 +83,13 @@ void tex_coord_npot(GLfloat *tex, GLsizei len,
                     GLsizei nwidth, GLsizei nheight);
 int npot(int n);
 
+// a rectangle of texels (x2, y2 excluded)
+typedef struct {
+    GLint x1, y1, x2, y2;
+} texrect_t;
+
+#define TEXDIRTY_RECTS 8
+
 typedef struct {
     GLuint texture;
     GLuint glname;
@@ -106,6 +113,10 @@ typedef struct {
 	GLboolean streamed;
 	int	streamingID;
     GLvoid *data;	// in case we want to keep a copy of it (it that case, always RGBA/GL_UNSIGNED_BYTE
+    GLboolean shadow;   // data is a full copy of level 0, dirty rects can be uploaded from it
+    int ndirty;         // updates of level 0 not uploaded yet (LIBGL_TEXCOALESCE)
+    texrect_t dirty[TEXDIRTY_RECTS];
+    int uploads;        // level 0 specified with data, textures often re-specified skip the disk cache
 } gltexture_t;
 
 KHASH_MAP_INIT_INT(tex, gltexture_t *)
@@ -126,11 +137,19 @@ static inline GLenum map_tex_target(GLenum target) {
 }
 gltexture_t* glshim_getTexture(GLenum target, GLuint texture);
 
+// coalesced glTexSubImage2D: upload the dirty rects of all textures (before a draw)
+extern int texdirty_count;
+void texdirty_flush();
+#define texdirty_sync() if (texdirty_count) texdirty_flush()
+// upload (or forget) the dirty rects of one texture
+void texdirty_remove(gltexture_t *tex, int upload);
+
 void glshim_glActiveTexture( GLenum texture );
 void glshim_glClientActiveTexture( GLenum texture );
 void glshim_glMultiTexCoord2f( GLenum target, GLfloat s, GLfloat t );
 GLboolean glshim_glIsTexture( GLuint texture );
 
+int tex_setup_needchange(GLuint texunit);
 void tex_setup_texcoord(GLuint texunit, GLuint len);
 
 #endif
@@ -0,0 +1,68 @@
+#include <pthread.h>
+
+#include "thread.h"
+
+volatile int thread_pending = 0;   // a job was submitted, the context is not on the application thread
+
+static pthread_t thread;
+static int started = 0;
+static pthread_mutex_t mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t cond = PTHREAD_COND_INITIALIZER;
+static void (*job_func)(void *) = NULL;     // job queued or running
+static void *job_data = NULL;
+static thread_bind_t job_bind = NULL;
+
+static void *thread_main(void *arg) {
+    pthread_mutex_lock(&mutex);
+    while (1) {
+        while (!job_func)
+            pthread_cond_wait(&cond, &mutex);
+        void (*func)(void *) = job_func;
+        void *data = job_data;
+        pthread_mutex_unlock(&mutex);
+        job_bind(1);
+        func(data);
+        job_bind(0);
+        pthread_mutex_lock(&mutex);
+        job_func = NULL;
+        pthread_cond_broadcast(&cond);
+    }
+    return NULL;
+}
+
+static void thread_idle() {
+    pthread_mutex_lock(&mutex);
+    while (job_func)
+        pthread_cond_wait(&cond, &mutex);
+    pthread_mutex_unlock(&mutex);
+}
+
+void thread_submit(void (*job)(void *), void *data, thread_bind_t bind) {
+    if (!started) {
+        if (pthread_create(&thread, NULL, thread_main, NULL) != 0) {
+            // no thread, run it here
+            job(data);
+            return;
+        }
+        started = 1;
+    }
+    if (thread_pending)
+        thread_idle();  // context is already released
+    else
+        bind(0);
+    pthread_mutex_lock(&mutex);
+    job_data = data;
+    job_bind = bind;
+    job_func = job;
+    thread_pending = 1;
+    pthread_cond_broadcast(&cond);
+    pthread_mutex_unlock(&mutex);
+}
+
+void thread_wait() {
+    if (!thread_pending || pthread_equal(pthread_self(), thread))
+        return;
+    thread_idle();
+    thread_pending = 0;
+    job_bind(1);
+}
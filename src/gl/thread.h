@@ -0,0 +1,18 @@
+#include "gl.h"
+
+#ifndef GL_THREAD_H
+#define GL_THREAD_H
+
+// Optional second thread that takes the EGL context to run a job (the buffer swap)
+// while the application goes on. The context comes back to the application thread
+// on its next use of GLES: thread_sync(), in LOAD_GLES or after the list recording of the wrappers
+
+// context switch of the calling thread: 1 to make it current, 0 to release it
+typedef void (*thread_bind_t)(int current);
+
+// run job(data) on the thread (wait for the previous one first)
+void thread_submit(void (*job)(void *), void *data, thread_bind_t bind);
+// wait for the job, and take the context back
+void thread_wait();
+
+#endif
@@ -2,1450 +2,1595 @@
 #include "gles.h"
 #ifndef skip_glActiveTexture
 void glshim_glActiveTexture(GLenum texture) {
-    LOAD_GLES(glActiveTexture);
+    LOAD_GLES_NOSYNC(glActiveTexture);
 #ifndef direct_glActiveTexture
     PUSH_IF_COMPILING(glActiveTexture)
 #endif
+    thread_sync();
     gles_glActiveTexture(texture);
 }
 void glActiveTexture(GLenum texture) __attribute__((alias("glshim_glActiveTexture"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glAlphaFunc
 void glshim_glAlphaFunc(GLenum func, GLclampf ref) {
-    LOAD_GLES(glAlphaFunc);
+    LOAD_GLES_NOSYNC(glAlphaFunc);
 #ifndef direct_glAlphaFunc
     PUSH_IF_COMPILING(glAlphaFunc)
 #endif
+    thread_sync();
     gles_glAlphaFunc(func, ref);
 }
 void glAlphaFunc(GLenum func, GLclampf ref) __attribute__((alias("glshim_glAlphaFunc"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glAlphaFuncx
 void glshim_glAlphaFuncx(GLenum func, GLclampx ref) {
-    LOAD_GLES(glAlphaFuncx);
+    LOAD_GLES_NOSYNC(glAlphaFuncx);
 #ifndef direct_glAlphaFuncx
     PUSH_IF_COMPILING(glAlphaFuncx)
 #endif
+    thread_sync();
     gles_glAlphaFuncx(func, ref);
 }
 void glAlphaFuncx(GLenum func, GLclampx ref) __attribute__((alias("glshim_glAlphaFuncx"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glBindBuffer
 void glshim_glBindBuffer(GLenum target, GLuint buffer) {
-    LOAD_GLES(glBindBuffer);
+    LOAD_GLES_NOSYNC(glBindBuffer);
 #ifndef direct_glBindBuffer
     PUSH_IF_COMPILING(glBindBuffer)
 #endif
+    thread_sync();
     gles_glBindBuffer(target, buffer);
 }
 void glBindBuffer(GLenum target, GLuint buffer) __attribute__((alias("glshim_glBindBuffer"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glBindTexture
 void glshim_glBindTexture(GLenum target, GLuint texture) {
-    LOAD_GLES(glBindTexture);
+    LOAD_GLES_NOSYNC(glBindTexture);
 #ifndef direct_glBindTexture
     PUSH_IF_COMPILING(glBindTexture)
 #endif
+    thread_sync();
     gles_glBindTexture(target, texture);
 }
 void glBindTexture(GLenum target, GLuint texture) __attribute__((alias("glshim_glBindTexture"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glBlendFunc
 void glshim_glBlendFunc(GLenum sfactor, GLenum dfactor) {
-    LOAD_GLES(glBlendFunc);
+    LOAD_GLES_NOSYNC(glBlendFunc);
 #ifndef direct_glBlendFunc
     PUSH_IF_COMPILING(glBlendFunc)
 #endif
+    thread_sync();
     gles_glBlendFunc(sfactor, dfactor);
 }
 void glBlendFunc(GLenum sfactor, GLenum dfactor) __attribute__((alias("glshim_glBlendFunc"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glBufferData
 void glshim_glBufferData(GLenum target, GLsizeiptr size, const GLvoid * data, GLenum usage) {
-    LOAD_GLES(glBufferData);
+    LOAD_GLES_NOSYNC(glBufferData);
 #ifndef direct_glBufferData
     PUSH_IF_COMPILING(glBufferData)
 #endif
+    thread_sync();
     gles_glBufferData(target, size, data, usage);
 }
 void glBufferData(GLenum target, GLsizeiptr size, const GLvoid * data, GLenum usage) __attribute__((alias("glshim_glBufferData"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glBufferSubData
 void glshim_glBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const GLvoid * data) {
-    LOAD_GLES(glBufferSubData);
+    LOAD_GLES_NOSYNC(glBufferSubData);
 #ifndef direct_glBufferSubData
     PUSH_IF_COMPILING(glBufferSubData)
 #endif
+    thread_sync();
     gles_glBufferSubData(target, offset, size, data);
 }
 void glBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const GLvoid * data) __attribute__((alias("glshim_glBufferSubData"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glClear
 void glshim_glClear(GLbitfield mask) {
-    LOAD_GLES(glClear);
+    LOAD_GLES_NOSYNC(glClear);
 #ifndef direct_glClear
     PUSH_IF_COMPILING(glClear)
 #endif
+    thread_sync();
     gles_glClear(mask);
 }
 void glClear(GLbitfield mask) __attribute__((alias("glshim_glClear"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glClearColor
 void glshim_glClearColor(GLclampf red, GLclampf green, GLclampf blue, GLclampf alpha) {
-    LOAD_GLES(glClearColor);
+    LOAD_GLES_NOSYNC(glClearColor);
 #ifndef direct_glClearColor
     PUSH_IF_COMPILING(glClearColor)
 #endif
+    thread_sync();
     gles_glClearColor(red, green, blue, alpha);
 }
 void glClearColor(GLclampf red, GLclampf green, GLclampf blue, GLclampf alpha) __attribute__((alias("glshim_glClearColor"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glClearColorx
 void glshim_glClearColorx(GLclampx red, GLclampx green, GLclampx blue, GLclampx alpha) {
-    LOAD_GLES(glClearColorx);
+    LOAD_GLES_NOSYNC(glClearColorx);
 #ifndef direct_glClearColorx
     PUSH_IF_COMPILING(glClearColorx)
 #endif
+    thread_sync();
     gles_glClearColorx(red, green, blue, alpha);
 }
 void glClearColorx(GLclampx red, GLclampx green, GLclampx blue, GLclampx alpha) __attribute__((alias("glshim_glClearColorx"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glClearDepthf
 void glshim_glClearDepthf(GLclampf depth) {
-    LOAD_GLES(glClearDepthf);
+    LOAD_GLES_NOSYNC(glClearDepthf);
 #ifndef direct_glClearDepthf
     PUSH_IF_COMPILING(glClearDepthf)
 #endif
+    thread_sync();
     gles_glClearDepthf(depth);
 }
 void glClearDepthf(GLclampf depth) __attribute__((alias("glshim_glClearDepthf"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glClearDepthx
 void glshim_glClearDepthx(GLclampx depth) {
-    LOAD_GLES(glClearDepthx);
+    LOAD_GLES_NOSYNC(glClearDepthx);
 #ifndef direct_glClearDepthx
     PUSH_IF_COMPILING(glClearDepthx)
 #endif
+    thread_sync();
     gles_glClearDepthx(depth);
 }
 void glClearDepthx(GLclampx depth) __attribute__((alias("glshim_glClearDepthx"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glClearStencil
 void glshim_glClearStencil(GLint s) {
-    LOAD_GLES(glClearStencil);
+    LOAD_GLES_NOSYNC(glClearStencil);
 #ifndef direct_glClearStencil
     PUSH_IF_COMPILING(glClearStencil)
 #endif
+    thread_sync();
     gles_glClearStencil(s);
 }
 void glClearStencil(GLint s) __attribute__((alias("glshim_glClearStencil"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glClientActiveTexture
 void glshim_glClientActiveTexture(GLenum texture) {
-    LOAD_GLES(glClientActiveTexture);
+    LOAD_GLES_NOSYNC(glClientActiveTexture);
 #ifndef direct_glClientActiveTexture
     PUSH_IF_COMPILING(glClientActiveTexture)
 #endif
+    thread_sync();
     gles_glClientActiveTexture(texture);
 }
 void glClientActiveTexture(GLenum texture) __attribute__((alias("glshim_glClientActiveTexture"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glClipPlanef
 void glshim_glClipPlanef(GLenum plane, const GLfloat * equation) {
-    LOAD_GLES(glClipPlanef);
+    LOAD_GLES_NOSYNC(glClipPlanef);
 #ifndef direct_glClipPlanef
     PUSH_IF_COMPILING(glClipPlanef)
 #endif
+    thread_sync();
     gles_glClipPlanef(plane, equation);
 }
 void glClipPlanef(GLenum plane, const GLfloat * equation) __attribute__((alias("glshim_glClipPlanef"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glClipPlanex
 void glshim_glClipPlanex(GLenum plane, const GLfixed * equation) {
-    LOAD_GLES(glClipPlanex);
+    LOAD_GLES_NOSYNC(glClipPlanex);
 #ifndef direct_glClipPlanex
     PUSH_IF_COMPILING(glClipPlanex)
 #endif
+    thread_sync();
     gles_glClipPlanex(plane, equation);
 }
 void glClipPlanex(GLenum plane, const GLfixed * equation) __attribute__((alias("glshim_glClipPlanex"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glColor4f
 void glshim_glColor4f(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
-    LOAD_GLES(glColor4f);
+    LOAD_GLES_NOSYNC(glColor4f);
 #ifndef direct_glColor4f
     PUSH_IF_COMPILING(glColor4f)
 #endif
+    thread_sync();
     gles_glColor4f(red, green, blue, alpha);
 }
 void glColor4f(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) __attribute__((alias("glshim_glColor4f"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glColor4ub
 void glshim_glColor4ub(GLubyte red, GLubyte green, GLubyte blue, GLubyte alpha) {
-    LOAD_GLES(glColor4ub);
+    LOAD_GLES_NOSYNC(glColor4ub);
 #ifndef direct_glColor4ub
     PUSH_IF_COMPILING(glColor4ub)
 #endif
+    thread_sync();
     gles_glColor4ub(red, green, blue, alpha);
 }
 void glColor4ub(GLubyte red, GLubyte green, GLubyte blue, GLubyte alpha) __attribute__((alias("glshim_glColor4ub"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glColor4x
 void glshim_glColor4x(GLfixed red, GLfixed green, GLfixed blue, GLfixed alpha) {
-    LOAD_GLES(glColor4x);
+    LOAD_GLES_NOSYNC(glColor4x);
 #ifndef direct_glColor4x
     PUSH_IF_COMPILING(glColor4x)
 #endif
+    thread_sync();
     gles_glColor4x(red, green, blue, alpha);
 }
 void glColor4x(GLfixed red, GLfixed green, GLfixed blue, GLfixed alpha) __attribute__((alias("glshim_glColor4x"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glColorMask
 void glshim_glColorMask(GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha) {
-    LOAD_GLES(glColorMask);
+    LOAD_GLES_NOSYNC(glColorMask);
 #ifndef direct_glColorMask
     PUSH_IF_COMPILING(glColorMask)
 #endif
+    thread_sync();
     gles_glColorMask(red, green, blue, alpha);
 }
 void glColorMask(GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha) __attribute__((alias("glshim_glColorMask"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glColorPointer
 void glshim_glColorPointer(GLint size, GLenum type, GLsizei stride, const GLvoid * pointer) {
-    LOAD_GLES(glColorPointer);
+    LOAD_GLES_NOSYNC(glColorPointer);
 #ifndef direct_glColorPointer
     PUSH_IF_COMPILING(glColorPointer)
 #endif
+    thread_sync();
     gles_glColorPointer(size, type, stride, pointer);
 }
 void glColorPointer(GLint size, GLenum type, GLsizei stride, const GLvoid * pointer) __attribute__((alias("glshim_glColorPointer"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glCompressedTexImage2D
 void glshim_glCompressedTexImage2D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const GLvoid * data) {
-    LOAD_GLES(glCompressedTexImage2D);
+    LOAD_GLES_NOSYNC(glCompressedTexImage2D);
 #ifndef direct_glCompressedTexImage2D
     PUSH_IF_COMPILING(glCompressedTexImage2D)
 #endif
+    thread_sync();
     gles_glCompressedTexImage2D(target, level, internalformat, width, height, border, imageSize, data);
 }
 void glCompressedTexImage2D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const GLvoid * data) __attribute__((alias("glshim_glCompressedTexImage2D"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glCompressedTexSubImage2D
 void glshim_glCompressedTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const GLvoid * data) {
-    LOAD_GLES(glCompressedTexSubImage2D);
+    LOAD_GLES_NOSYNC(glCompressedTexSubImage2D);
 #ifndef direct_glCompressedTexSubImage2D
     PUSH_IF_COMPILING(glCompressedTexSubImage2D)
 #endif
+    thread_sync();
     gles_glCompressedTexSubImage2D(target, level, xoffset, yoffset, width, height, format, imageSize, data);
 }
 void glCompressedTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const GLvoid * data) __attribute__((alias("glshim_glCompressedTexSubImage2D"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glCopyTexImage2D
 void glshim_glCopyTexImage2D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border) {
-    LOAD_GLES(glCopyTexImage2D);
+    LOAD_GLES_NOSYNC(glCopyTexImage2D);
 #ifndef direct_glCopyTexImage2D
     PUSH_IF_COMPILING(glCopyTexImage2D)
 #endif
+    thread_sync();
     gles_glCopyTexImage2D(target, level, internalformat, x, y, width, height, border);
 }
 void glCopyTexImage2D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border) __attribute__((alias("glshim_glCopyTexImage2D"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glCopyTexSubImage2D
 void glshim_glCopyTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
-    LOAD_GLES(glCopyTexSubImage2D);
+    LOAD_GLES_NOSYNC(glCopyTexSubImage2D);
 #ifndef direct_glCopyTexSubImage2D
     PUSH_IF_COMPILING(glCopyTexSubImage2D)
 #endif
+    thread_sync();
     gles_glCopyTexSubImage2D(target, level, xoffset, yoffset, x, y, width, height);
 }
 void glCopyTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height) __attribute__((alias("glshim_glCopyTexSubImage2D"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glCullFace
 void glshim_glCullFace(GLenum mode) {
-    LOAD_GLES(glCullFace);
+    LOAD_GLES_NOSYNC(glCullFace);
 #ifndef direct_glCullFace
     PUSH_IF_COMPILING(glCullFace)
 #endif
+    thread_sync();
     gles_glCullFace(mode);
 }
 void glCullFace(GLenum mode) __attribute__((alias("glshim_glCullFace"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glDeleteBuffers
 void glshim_glDeleteBuffers(GLsizei n, const GLuint * buffers) {
-    LOAD_GLES(glDeleteBuffers);
+    LOAD_GLES_NOSYNC(glDeleteBuffers);
 #ifndef direct_glDeleteBuffers
     PUSH_IF_COMPILING(glDeleteBuffers)
 #endif
+    thread_sync();
     gles_glDeleteBuffers(n, buffers);
 }
 void glDeleteBuffers(GLsizei n, const GLuint * buffers) __attribute__((alias("glshim_glDeleteBuffers"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glDeleteTextures
 void glshim_glDeleteTextures(GLsizei n, const GLuint * textures) {
-    LOAD_GLES(glDeleteTextures);
+    LOAD_GLES_NOSYNC(glDeleteTextures);
 #ifndef direct_glDeleteTextures
     PUSH_IF_COMPILING(glDeleteTextures)
 #endif
+    thread_sync();
     gles_glDeleteTextures(n, textures);
 }
 void glDeleteTextures(GLsizei n, const GLuint * textures) __attribute__((alias("glshim_glDeleteTextures"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glDepthFunc
 void glshim_glDepthFunc(GLenum func) {
-    LOAD_GLES(glDepthFunc);
+    LOAD_GLES_NOSYNC(glDepthFunc);
 #ifndef direct_glDepthFunc
     PUSH_IF_COMPILING(glDepthFunc)
 #endif
+    thread_sync();
     gles_glDepthFunc(func);
 }
 void glDepthFunc(GLenum func) __attribute__((alias("glshim_glDepthFunc"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glDepthMask
 void glshim_glDepthMask(GLboolean flag) {
-    LOAD_GLES(glDepthMask);
+    LOAD_GLES_NOSYNC(glDepthMask);
 #ifndef direct_glDepthMask
     PUSH_IF_COMPILING(glDepthMask)
 #endif
+    thread_sync();
     gles_glDepthMask(flag);
 }
 void glDepthMask(GLboolean flag) __attribute__((alias("glshim_glDepthMask"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glDepthRangef
 void glshim_glDepthRangef(GLclampf near, GLclampf far) {
-    LOAD_GLES(glDepthRangef);
+    LOAD_GLES_NOSYNC(glDepthRangef);
 #ifndef direct_glDepthRangef
     PUSH_IF_COMPILING(glDepthRangef)
 #endif
+    thread_sync();
     gles_glDepthRangef(near, far);
 }
 void glDepthRangef(GLclampf near, GLclampf far) __attribute__((alias("glshim_glDepthRangef"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glDepthRangex
 void glshim_glDepthRangex(GLclampx near, GLclampx far) {
-    LOAD_GLES(glDepthRangex);
+    LOAD_GLES_NOSYNC(glDepthRangex);
 #ifndef direct_glDepthRangex
     PUSH_IF_COMPILING(glDepthRangex)
 #endif
+    thread_sync();
     gles_glDepthRangex(near, far);
 }
 void glDepthRangex(GLclampx near, GLclampx far) __attribute__((alias("glshim_glDepthRangex"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glDisable
 void glshim_glDisable(GLenum cap) {
-    LOAD_GLES(glDisable);
+    LOAD_GLES_NOSYNC(glDisable);
 #ifndef direct_glDisable
     PUSH_IF_COMPILING(glDisable)
 #endif
+    thread_sync();
     gles_glDisable(cap);
 }
 void glDisable(GLenum cap) __attribute__((alias("glshim_glDisable"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glDisableClientState
 void glshim_glDisableClientState(GLenum array) {
-    LOAD_GLES(glDisableClientState);
+    LOAD_GLES_NOSYNC(glDisableClientState);
 #ifndef direct_glDisableClientState
     PUSH_IF_COMPILING(glDisableClientState)
 #endif
+    thread_sync();
     gles_glDisableClientState(array);
 }
 void glDisableClientState(GLenum array) __attribute__((alias("glshim_glDisableClientState"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glDrawArrays
 void glshim_glDrawArrays(GLenum mode, GLint first, GLsizei count) {
-    LOAD_GLES(glDrawArrays);
+    LOAD_GLES_NOSYNC(glDrawArrays);
 #ifndef direct_glDrawArrays
     PUSH_IF_COMPILING(glDrawArrays)
 #endif
+    thread_sync();
     gles_glDrawArrays(mode, first, count);
 }
 void glDrawArrays(GLenum mode, GLint first, GLsizei count) __attribute__((alias("glshim_glDrawArrays"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glDrawElements
 void glshim_glDrawElements(GLenum mode, GLsizei count, GLenum type, const GLvoid * indices) {
-    LOAD_GLES(glDrawElements);
+    LOAD_GLES_NOSYNC(glDrawElements);
 #ifndef direct_glDrawElements
     PUSH_IF_COMPILING(glDrawElements)
 #endif
+    thread_sync();
     gles_glDrawElements(mode, count, type, indices);
 }
 void glDrawElements(GLenum mode, GLsizei count, GLenum type, const GLvoid * indices) __attribute__((alias("glshim_glDrawElements"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glEnable
 void glshim_glEnable(GLenum cap) {
-    LOAD_GLES(glEnable);
+    LOAD_GLES_NOSYNC(glEnable);
 #ifndef direct_glEnable
     PUSH_IF_COMPILING(glEnable)
 #endif
+    thread_sync();
     gles_glEnable(cap);
 }
 void glEnable(GLenum cap) __attribute__((alias("glshim_glEnable"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glEnableClientState
 void glshim_glEnableClientState(GLenum array) {
-    LOAD_GLES(glEnableClientState);
+    LOAD_GLES_NOSYNC(glEnableClientState);
 #ifndef direct_glEnableClientState
     PUSH_IF_COMPILING(glEnableClientState)
 #endif
+    thread_sync();
     gles_glEnableClientState(array);
 }
 void glEnableClientState(GLenum array) __attribute__((alias("glshim_glEnableClientState"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glFinish
 void glshim_glFinish() {
-    LOAD_GLES(glFinish);
+    LOAD_GLES_NOSYNC(glFinish);
 #ifndef direct_glFinish
     PUSH_IF_COMPILING(glFinish)
 #endif
+    thread_sync();
     gles_glFinish();
 }
 void glFinish() __attribute__((alias("glshim_glFinish"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glFlush
 void glshim_glFlush() {
-    LOAD_GLES(glFlush);
+    LOAD_GLES_NOSYNC(glFlush);
 #ifndef direct_glFlush
     PUSH_IF_COMPILING(glFlush)
 #endif
+    thread_sync();
     gles_glFlush();
 }
 void glFlush() __attribute__((alias("glshim_glFlush"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glFogf
 void glshim_glFogf(GLenum pname, GLfloat param) {
-    LOAD_GLES(glFogf);
+    LOAD_GLES_NOSYNC(glFogf);
 #ifndef direct_glFogf
     PUSH_IF_COMPILING(glFogf)
 #endif
+    thread_sync();
     gles_glFogf(pname, param);
 }
 void glFogf(GLenum pname, GLfloat param) __attribute__((alias("glshim_glFogf"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glFogfv
 void glshim_glFogfv(GLenum pname, const GLfloat * params) {
-    LOAD_GLES(glFogfv);
+    LOAD_GLES_NOSYNC(glFogfv);
 #ifndef direct_glFogfv
     PUSH_IF_COMPILING(glFogfv)
 #endif
+    thread_sync();
     gles_glFogfv(pname, params);
 }
 void glFogfv(GLenum pname, const GLfloat * params) __attribute__((alias("glshim_glFogfv"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glFogx
 void glshim_glFogx(GLenum pname, GLfixed param) {
-    LOAD_GLES(glFogx);
+    LOAD_GLES_NOSYNC(glFogx);
 #ifndef direct_glFogx
     PUSH_IF_COMPILING(glFogx)
 #endif
+    thread_sync();
     gles_glFogx(pname, param);
 }
 void glFogx(GLenum pname, GLfixed param) __attribute__((alias("glshim_glFogx"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glFogxv
 void glshim_glFogxv(GLenum pname, const GLfixed * params) {
-    LOAD_GLES(glFogxv);
+    LOAD_GLES_NOSYNC(glFogxv);
 #ifndef direct_glFogxv
     PUSH_IF_COMPILING(glFogxv)
 #endif
+    thread_sync();
     gles_glFogxv(pname, params);
 }
 void glFogxv(GLenum pname, const GLfixed * params) __attribute__((alias("glshim_glFogxv"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glFrontFace
 void glshim_glFrontFace(GLenum mode) {
-    LOAD_GLES(glFrontFace);
+    LOAD_GLES_NOSYNC(glFrontFace);
 #ifndef direct_glFrontFace
     PUSH_IF_COMPILING(glFrontFace)
 #endif
+    thread_sync();
     gles_glFrontFace(mode);
 }
 void glFrontFace(GLenum mode) __attribute__((alias("glshim_glFrontFace"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glFrustumf
 void glshim_glFrustumf(GLfloat left, GLfloat right, GLfloat bottom, GLfloat top, GLfloat near, GLfloat far) {
-    LOAD_GLES(glFrustumf);
+    LOAD_GLES_NOSYNC(glFrustumf);
 #ifndef direct_glFrustumf
     PUSH_IF_COMPILING(glFrustumf)
 #endif
+    thread_sync();
     gles_glFrustumf(left, right, bottom, top, near, far);
 }
 void glFrustumf(GLfloat left, GLfloat right, GLfloat bottom, GLfloat top, GLfloat near, GLfloat far) __attribute__((alias("glshim_glFrustumf"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glFrustumx
 void glshim_glFrustumx(GLfixed left, GLfixed right, GLfixed bottom, GLfixed top, GLfixed near, GLfixed far) {
-    LOAD_GLES(glFrustumx);
+    LOAD_GLES_NOSYNC(glFrustumx);
 #ifndef direct_glFrustumx
     PUSH_IF_COMPILING(glFrustumx)
 #endif
+    thread_sync();
     gles_glFrustumx(left, right, bottom, top, near, far);
 }
 void glFrustumx(GLfixed left, GLfixed right, GLfixed bottom, GLfixed top, GLfixed near, GLfixed far) __attribute__((alias("glshim_glFrustumx"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glGenBuffers
 void glshim_glGenBuffers(GLsizei n, GLuint * buffers) {
-    LOAD_GLES(glGenBuffers);
+    LOAD_GLES_NOSYNC(glGenBuffers);
 #ifndef direct_glGenBuffers
     PUSH_IF_COMPILING(glGenBuffers)
 #endif
+    thread_sync();
     gles_glGenBuffers(n, buffers);
 }
 void glGenBuffers(GLsizei n, GLuint * buffers) __attribute__((alias("glshim_glGenBuffers"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glGenTextures
 void glshim_glGenTextures(GLsizei n, GLuint * textures) {
-    LOAD_GLES(glGenTextures);
+    LOAD_GLES_NOSYNC(glGenTextures);
 #ifndef direct_glGenTextures
     PUSH_IF_COMPILING(glGenTextures)
 #endif
+    thread_sync();
     gles_glGenTextures(n, textures);
 }
 void glGenTextures(GLsizei n, GLuint * textures) __attribute__((alias("glshim_glGenTextures"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glGetBooleanv
 void glshim_glGetBooleanv(GLenum pname, GLboolean * params) {
-    LOAD_GLES(glGetBooleanv);
+    LOAD_GLES_NOSYNC(glGetBooleanv);
 #ifndef direct_glGetBooleanv
     PUSH_IF_COMPILING(glGetBooleanv)
 #endif
+    thread_sync();
     gles_glGetBooleanv(pname, params);
 }
 void glGetBooleanv(GLenum pname, GLboolean * params) __attribute__((alias("glshim_glGetBooleanv"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glGetBufferParameteriv
 void glshim_glGetBufferParameteriv(GLenum target, GLenum pname, GLint * params) {
-    LOAD_GLES(glGetBufferParameteriv);
+    LOAD_GLES_NOSYNC(glGetBufferParameteriv);
 #ifndef direct_glGetBufferParameteriv
     PUSH_IF_COMPILING(glGetBufferParameteriv)
 #endif
+    thread_sync();
     gles_glGetBufferParameteriv(target, pname, params);
 }
 void glGetBufferParameteriv(GLenum target, GLenum pname, GLint * params) __attribute__((alias("glshim_glGetBufferParameteriv"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glGetClipPlanef
 void glshim_glGetClipPlanef(GLenum plane, GLfloat * equation) {
-    LOAD_GLES(glGetClipPlanef);
+    LOAD_GLES_NOSYNC(glGetClipPlanef);
 #ifndef direct_glGetClipPlanef
     PUSH_IF_COMPILING(glGetClipPlanef)
 #endif
+    thread_sync();
     gles_glGetClipPlanef(plane, equation);
 }
 void glGetClipPlanef(GLenum plane, GLfloat * equation) __attribute__((alias("glshim_glGetClipPlanef"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glGetClipPlanex
 void glshim_glGetClipPlanex(GLenum plane, GLfixed * equation) {
-    LOAD_GLES(glGetClipPlanex);
+    LOAD_GLES_NOSYNC(glGetClipPlanex);
 #ifndef direct_glGetClipPlanex
     PUSH_IF_COMPILING(glGetClipPlanex)
 #endif
+    thread_sync();
     gles_glGetClipPlanex(plane, equation);
 }
 void glGetClipPlanex(GLenum plane, GLfixed * equation) __attribute__((alias("glshim_glGetClipPlanex"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glGetError
 GLenum glshim_glGetError() {
-    LOAD_GLES(glGetError);
+    LOAD_GLES_NOSYNC(glGetError);
 #ifndef direct_glGetError
     PUSH_IF_COMPILING(glGetError)
 #endif
+    thread_sync();
     return gles_glGetError();
 }
 GLenum glGetError() __attribute__((alias("glshim_glGetError"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glGetFixedv
 void glshim_glGetFixedv(GLenum pname, GLfixed * params) {
-    LOAD_GLES(glGetFixedv);
+    LOAD_GLES_NOSYNC(glGetFixedv);
 #ifndef direct_glGetFixedv
     PUSH_IF_COMPILING(glGetFixedv)
 #endif
+    thread_sync();
     gles_glGetFixedv(pname, params);
 }
 void glGetFixedv(GLenum pname, GLfixed * params) __attribute__((alias("glshim_glGetFixedv"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glGetFloatv
 void glshim_glGetFloatv(GLenum pname, GLfloat * params) {
-    LOAD_GLES(glGetFloatv);
+    LOAD_GLES_NOSYNC(glGetFloatv);
 #ifndef direct_glGetFloatv
     PUSH_IF_COMPILING(glGetFloatv)
 #endif
+    thread_sync();
     gles_glGetFloatv(pname, params);
 }
 void glGetFloatv(GLenum pname, GLfloat * params) __attribute__((alias("glshim_glGetFloatv"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glGetIntegerv
 void glshim_glGetIntegerv(GLenum pname, GLint * params) {
-    LOAD_GLES(glGetIntegerv);
+    LOAD_GLES_NOSYNC(glGetIntegerv);
 #ifndef direct_glGetIntegerv
     PUSH_IF_COMPILING(glGetIntegerv)
 #endif
+    thread_sync();
     gles_glGetIntegerv(pname, params);
 }
 void glGetIntegerv(GLenum pname, GLint * params) __attribute__((alias("glshim_glGetIntegerv"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glGetLightfv
 void glshim_glGetLightfv(GLenum light, GLenum pname, GLfloat * params) {
-    LOAD_GLES(glGetLightfv);
+    LOAD_GLES_NOSYNC(glGetLightfv);
 #ifndef direct_glGetLightfv
     PUSH_IF_COMPILING(glGetLightfv)
 #endif
+    thread_sync();
     gles_glGetLightfv(light, pname, params);
 }
 void glGetLightfv(GLenum light, GLenum pname, GLfloat * params) __attribute__((alias("glshim_glGetLightfv"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glGetLightxv
 void glshim_glGetLightxv(GLenum light, GLenum pname, GLfixed * params) {
-    LOAD_GLES(glGetLightxv);
+    LOAD_GLES_NOSYNC(glGetLightxv);
 #ifndef direct_glGetLightxv
     PUSH_IF_COMPILING(glGetLightxv)
 #endif
+    thread_sync();
     gles_glGetLightxv(light, pname, params);
 }
 void glGetLightxv(GLenum light, GLenum pname, GLfixed * params) __attribute__((alias("glshim_glGetLightxv"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glGetMaterialfv
 void glshim_glGetMaterialfv(GLenum face, GLenum pname, GLfloat * params) {
-    LOAD_GLES(glGetMaterialfv);
+    LOAD_GLES_NOSYNC(glGetMaterialfv);
 #ifndef direct_glGetMaterialfv
     PUSH_IF_COMPILING(glGetMaterialfv)
 #endif
+    thread_sync();
     gles_glGetMaterialfv(face, pname, params);
 }
 void glGetMaterialfv(GLenum face, GLenum pname, GLfloat * params) __attribute__((alias("glshim_glGetMaterialfv"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glGetMaterialxv
 void glshim_glGetMaterialxv(GLenum face, GLenum pname, GLfixed * params) {
-    LOAD_GLES(glGetMaterialxv);
+    LOAD_GLES_NOSYNC(glGetMaterialxv);
 #ifndef direct_glGetMaterialxv
     PUSH_IF_COMPILING(glGetMaterialxv)
 #endif
+    thread_sync();
     gles_glGetMaterialxv(face, pname, params);
 }
 void glGetMaterialxv(GLenum face, GLenum pname, GLfixed * params) __attribute__((alias("glshim_glGetMaterialxv"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glGetPointerv
 void glshim_glGetPointerv(GLenum pname, GLvoid ** params) {
-    LOAD_GLES(glGetPointerv);
+    LOAD_GLES_NOSYNC(glGetPointerv);
 #ifndef direct_glGetPointerv
     PUSH_IF_COMPILING(glGetPointerv)
 #endif
+    thread_sync();
     gles_glGetPointerv(pname, params);
 }
 void glGetPointerv(GLenum pname, GLvoid ** params) __attribute__((alias("glshim_glGetPointerv"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glGetString
 const GLubyte * glshim_glGetString(GLenum name) {
-    LOAD_GLES(glGetString);
+    LOAD_GLES_NOSYNC(glGetString);
 #ifndef direct_glGetString
     PUSH_IF_COMPILING(glGetString)
 #endif
+    thread_sync();
     return gles_glGetString(name);
 }
 const GLubyte * glGetString(GLenum name) __attribute__((alias("glshim_glGetString"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glGetTexEnvfv
 void glshim_glGetTexEnvfv(GLenum target, GLenum pname, GLfloat * params) {
-    LOAD_GLES(glGetTexEnvfv);
+    LOAD_GLES_NOSYNC(glGetTexEnvfv);
 #ifndef direct_glGetTexEnvfv
     PUSH_IF_COMPILING(glGetTexEnvfv)
 #endif
+    thread_sync();
     gles_glGetTexEnvfv(target, pname, params);
 }
 void glGetTexEnvfv(GLenum target, GLenum pname, GLfloat * params) __attribute__((alias("glshim_glGetTexEnvfv"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glGetTexEnviv
 void glshim_glGetTexEnviv(GLenum target, GLenum pname, GLint * params) {
-    LOAD_GLES(glGetTexEnviv);
+    LOAD_GLES_NOSYNC(glGetTexEnviv);
 #ifndef direct_glGetTexEnviv
     PUSH_IF_COMPILING(glGetTexEnviv)
 #endif
+    thread_sync();
     gles_glGetTexEnviv(target, pname, params);
 }
 void glGetTexEnviv(GLenum target, GLenum pname, GLint * params) __attribute__((alias("glshim_glGetTexEnviv"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glGetTexEnvxv
 void glshim_glGetTexEnvxv(GLenum target, GLenum pname, GLfixed * params) {
-    LOAD_GLES(glGetTexEnvxv);
+    LOAD_GLES_NOSYNC(glGetTexEnvxv);
 #ifndef direct_glGetTexEnvxv
     PUSH_IF_COMPILING(glGetTexEnvxv)
 #endif
+    thread_sync();
     gles_glGetTexEnvxv(target, pname, params);
 }
 void glGetTexEnvxv(GLenum target, GLenum pname, GLfixed * params) __attribute__((alias("glshim_glGetTexEnvxv"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glGetTexParameterfv
 void glshim_glGetTexParameterfv(GLenum target, GLenum pname, GLfloat * params) {
-    LOAD_GLES(glGetTexParameterfv);
+    LOAD_GLES_NOSYNC(glGetTexParameterfv);
 #ifndef direct_glGetTexParameterfv
     PUSH_IF_COMPILING(glGetTexParameterfv)
 #endif
+    thread_sync();
     gles_glGetTexParameterfv(target, pname, params);
 }
 void glGetTexParameterfv(GLenum target, GLenum pname, GLfloat * params) __attribute__((alias("glshim_glGetTexParameterfv"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glGetTexParameteriv
 void glshim_glGetTexParameteriv(GLenum target, GLenum pname, GLint * params) {
-    LOAD_GLES(glGetTexParameteriv);
+    LOAD_GLES_NOSYNC(glGetTexParameteriv);
 #ifndef direct_glGetTexParameteriv
     PUSH_IF_COMPILING(glGetTexParameteriv)
 #endif
+    thread_sync();
     gles_glGetTexParameteriv(target, pname, params);
 }
 void glGetTexParameteriv(GLenum target, GLenum pname, GLint * params) __attribute__((alias("glshim_glGetTexParameteriv"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glGetTexParameterxv
 void glshim_glGetTexParameterxv(GLenum target, GLenum pname, GLfixed * params) {
-    LOAD_GLES(glGetTexParameterxv);
+    LOAD_GLES_NOSYNC(glGetTexParameterxv);
 #ifndef direct_glGetTexParameterxv
     PUSH_IF_COMPILING(glGetTexParameterxv)
 #endif
+    thread_sync();
     gles_glGetTexParameterxv(target, pname, params);
 }
 void glGetTexParameterxv(GLenum target, GLenum pname, GLfixed * params) __attribute__((alias("glshim_glGetTexParameterxv"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glHint
 void glshim_glHint(GLenum target, GLenum mode) {
-    LOAD_GLES(glHint);
+    LOAD_GLES_NOSYNC(glHint);
 #ifndef direct_glHint
     PUSH_IF_COMPILING(glHint)
 #endif
+    thread_sync();
     gles_glHint(target, mode);
 }
 void glHint(GLenum target, GLenum mode) __attribute__((alias("glshim_glHint"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glIsBuffer
 GLboolean glshim_glIsBuffer(GLuint buffer) {
-    LOAD_GLES(glIsBuffer);
+    LOAD_GLES_NOSYNC(glIsBuffer);
 #ifndef direct_glIsBuffer
     PUSH_IF_COMPILING(glIsBuffer)
 #endif
+    thread_sync();
     return gles_glIsBuffer(buffer);
 }
 GLboolean glIsBuffer(GLuint buffer) __attribute__((alias("glshim_glIsBuffer"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glIsEnabled
 GLboolean glshim_glIsEnabled(GLenum cap) {
-    LOAD_GLES(glIsEnabled);
+    LOAD_GLES_NOSYNC(glIsEnabled);
 #ifndef direct_glIsEnabled
     PUSH_IF_COMPILING(glIsEnabled)
 #endif
+    thread_sync();
     return gles_glIsEnabled(cap);
 }
 GLboolean glIsEnabled(GLenum cap) __attribute__((alias("glshim_glIsEnabled"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glIsTexture
 GLboolean glshim_glIsTexture(GLuint texture) {
-    LOAD_GLES(glIsTexture);
+    LOAD_GLES_NOSYNC(glIsTexture);
 #ifndef direct_glIsTexture
     PUSH_IF_COMPILING(glIsTexture)
 #endif
+    thread_sync();
     return gles_glIsTexture(texture);
 }
 GLboolean glIsTexture(GLuint texture) __attribute__((alias("glshim_glIsTexture"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glLightModelf
 void glshim_glLightModelf(GLenum pname, GLfloat param) {
-    LOAD_GLES(glLightModelf);
+    LOAD_GLES_NOSYNC(glLightModelf);
 #ifndef direct_glLightModelf
     PUSH_IF_COMPILING(glLightModelf)
 #endif
+    thread_sync();
     gles_glLightModelf(pname, param);
 }
 void glLightModelf(GLenum pname, GLfloat param) __attribute__((alias("glshim_glLightModelf"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glLightModelfv
 void glshim_glLightModelfv(GLenum pname, const GLfloat * params) {
-    LOAD_GLES(glLightModelfv);
+    LOAD_GLES_NOSYNC(glLightModelfv);
 #ifndef direct_glLightModelfv
     PUSH_IF_COMPILING(glLightModelfv)
 #endif
+    thread_sync();
     gles_glLightModelfv(pname, params);
 }
 void glLightModelfv(GLenum pname, const GLfloat * params) __attribute__((alias("glshim_glLightModelfv"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glLightModelx
 void glshim_glLightModelx(GLenum pname, GLfixed param) {
-    LOAD_GLES(glLightModelx);
+    LOAD_GLES_NOSYNC(glLightModelx);
 #ifndef direct_glLightModelx
     PUSH_IF_COMPILING(glLightModelx)
 #endif
+    thread_sync();
     gles_glLightModelx(pname, param);
 }
 void glLightModelx(GLenum pname, GLfixed param) __attribute__((alias("glshim_glLightModelx"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glLightModelxv
 void glshim_glLightModelxv(GLenum pname, const GLfixed * params) {
-    LOAD_GLES(glLightModelxv);
+    LOAD_GLES_NOSYNC(glLightModelxv);
 #ifndef direct_glLightModelxv
     PUSH_IF_COMPILING(glLightModelxv)
 #endif
+    thread_sync();
     gles_glLightModelxv(pname, params);
 }
 void glLightModelxv(GLenum pname, const GLfixed * params) __attribute__((alias("glshim_glLightModelxv"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glLightf
 void glshim_glLightf(GLenum light, GLenum pname, GLfloat param) {
-    LOAD_GLES(glLightf);
+    LOAD_GLES_NOSYNC(glLightf);
 #ifndef direct_glLightf
     PUSH_IF_COMPILING(glLightf)
 #endif
+    thread_sync();
     gles_glLightf(light, pname, param);
 }
 void glLightf(GLenum light, GLenum pname, GLfloat param) __attribute__((alias("glshim_glLightf"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glLightfv
 void glshim_glLightfv(GLenum light, GLenum pname, const GLfloat * params) {
-    LOAD_GLES(glLightfv);
+    LOAD_GLES_NOSYNC(glLightfv);
 #ifndef direct_glLightfv
     PUSH_IF_COMPILING(glLightfv)
 #endif
+    thread_sync();
     gles_glLightfv(light, pname, params);
 }
 void glLightfv(GLenum light, GLenum pname, const GLfloat * params) __attribute__((alias("glshim_glLightfv"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glLightx
 void glshim_glLightx(GLenum light, GLenum pname, GLfixed param) {
-    LOAD_GLES(glLightx);
+    LOAD_GLES_NOSYNC(glLightx);
 #ifndef direct_glLightx
     PUSH_IF_COMPILING(glLightx)
 #endif
+    thread_sync();
     gles_glLightx(light, pname, param);
 }
 void glLightx(GLenum light, GLenum pname, GLfixed param) __attribute__((alias("glshim_glLightx"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glLightxv
 void glshim_glLightxv(GLenum light, GLenum pname, const GLfixed * params) {
-    LOAD_GLES(glLightxv);
+    LOAD_GLES_NOSYNC(glLightxv);
 #ifndef direct_glLightxv
     PUSH_IF_COMPILING(glLightxv)
 #endif
+    thread_sync();
     gles_glLightxv(light, pname, params);
 }
 void glLightxv(GLenum light, GLenum pname, const GLfixed * params) __attribute__((alias("glshim_glLightxv"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glLineWidth
 void glshim_glLineWidth(GLfloat width) {
-    LOAD_GLES(glLineWidth);
+    LOAD_GLES_NOSYNC(glLineWidth);
 #ifndef direct_glLineWidth
     PUSH_IF_COMPILING(glLineWidth)
 #endif
+    thread_sync();
     gles_glLineWidth(width);
 }
 void glLineWidth(GLfloat width) __attribute__((alias("glshim_glLineWidth"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glLineWidthx
 void glshim_glLineWidthx(GLfixed width) {
-    LOAD_GLES(glLineWidthx);
+    LOAD_GLES_NOSYNC(glLineWidthx);
 #ifndef direct_glLineWidthx
     PUSH_IF_COMPILING(glLineWidthx)
 #endif
+    thread_sync();
     gles_glLineWidthx(width);
 }
 void glLineWidthx(GLfixed width) __attribute__((alias("glshim_glLineWidthx"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glLoadIdentity
 void glshim_glLoadIdentity() {
-    LOAD_GLES(glLoadIdentity);
+    LOAD_GLES_NOSYNC(glLoadIdentity);
 #ifndef direct_glLoadIdentity
     PUSH_IF_COMPILING(glLoadIdentity)
 #endif
+    thread_sync();
     gles_glLoadIdentity();
 }
 void glLoadIdentity() __attribute__((alias("glshim_glLoadIdentity"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glLoadMatrixf
 void glshim_glLoadMatrixf(const GLfloat * m) {
-    LOAD_GLES(glLoadMatrixf);
+    LOAD_GLES_NOSYNC(glLoadMatrixf);
 #ifndef direct_glLoadMatrixf
     PUSH_IF_COMPILING(glLoadMatrixf)
 #endif
+    thread_sync();
     gles_glLoadMatrixf(m);
 }
 void glLoadMatrixf(const GLfloat * m) __attribute__((alias("glshim_glLoadMatrixf"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glLoadMatrixx
 void glshim_glLoadMatrixx(const GLfixed * m) {
-    LOAD_GLES(glLoadMatrixx);
+    LOAD_GLES_NOSYNC(glLoadMatrixx);
 #ifndef direct_glLoadMatrixx
     PUSH_IF_COMPILING(glLoadMatrixx)
 #endif
+    thread_sync();
     gles_glLoadMatrixx(m);
 }
 void glLoadMatrixx(const GLfixed * m) __attribute__((alias("glshim_glLoadMatrixx"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glLogicOp
 void glshim_glLogicOp(GLenum opcode) {
-    LOAD_GLES(glLogicOp);
+    LOAD_GLES_NOSYNC(glLogicOp);
 #ifndef direct_glLogicOp
     PUSH_IF_COMPILING(glLogicOp)
 #endif
+    thread_sync();
     gles_glLogicOp(opcode);
 }
 void glLogicOp(GLenum opcode) __attribute__((alias("glshim_glLogicOp"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glMaterialf
 void glshim_glMaterialf(GLenum face, GLenum pname, GLfloat param) {
-    LOAD_GLES(glMaterialf);
+    LOAD_GLES_NOSYNC(glMaterialf);
 #ifndef direct_glMaterialf
     PUSH_IF_COMPILING(glMaterialf)
 #endif
+    thread_sync();
     gles_glMaterialf(face, pname, param);
 }
 void glMaterialf(GLenum face, GLenum pname, GLfloat param) __attribute__((alias("glshim_glMaterialf"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glMaterialfv
 void glshim_glMaterialfv(GLenum face, GLenum pname, const GLfloat * params) {
-    LOAD_GLES(glMaterialfv);
+    LOAD_GLES_NOSYNC(glMaterialfv);
 #ifndef direct_glMaterialfv
     PUSH_IF_COMPILING(glMaterialfv)
 #endif
+    thread_sync();
     gles_glMaterialfv(face, pname, params);
 }
 void glMaterialfv(GLenum face, GLenum pname, const GLfloat * params) __attribute__((alias("glshim_glMaterialfv"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glMaterialx
 void glshim_glMaterialx(GLenum face, GLenum pname, GLfixed param) {
-    LOAD_GLES(glMaterialx);
+    LOAD_GLES_NOSYNC(glMaterialx);
 #ifndef direct_glMaterialx
     PUSH_IF_COMPILING(glMaterialx)
 #endif
+    thread_sync();
     gles_glMaterialx(face, pname, param);
 }
 void glMaterialx(GLenum face, GLenum pname, GLfixed param) __attribute__((alias("glshim_glMaterialx"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glMaterialxv
 void glshim_glMaterialxv(GLenum face, GLenum pname, const GLfixed * params) {
-    LOAD_GLES(glMaterialxv);
+    LOAD_GLES_NOSYNC(glMaterialxv);
 #ifndef direct_glMaterialxv
     PUSH_IF_COMPILING(glMaterialxv)
 #endif
+    thread_sync();
     gles_glMaterialxv(face, pname, params);
 }
 void glMaterialxv(GLenum face, GLenum pname, const GLfixed * params) __attribute__((alias("glshim_glMaterialxv"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glMatrixMode
 void glshim_glMatrixMode(GLenum mode) {
-    LOAD_GLES(glMatrixMode);
+    LOAD_GLES_NOSYNC(glMatrixMode);
 #ifndef direct_glMatrixMode
     PUSH_IF_COMPILING(glMatrixMode)
 #endif
+    thread_sync();
     gles_glMatrixMode(mode);
 }
 void glMatrixMode(GLenum mode) __attribute__((alias("glshim_glMatrixMode"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glMultMatrixf
 void glshim_glMultMatrixf(const GLfloat * m) {
-    LOAD_GLES(glMultMatrixf);
+    LOAD_GLES_NOSYNC(glMultMatrixf);
 #ifndef direct_glMultMatrixf
     PUSH_IF_COMPILING(glMultMatrixf)
 #endif
+    thread_sync();
     gles_glMultMatrixf(m);
 }
 void glMultMatrixf(const GLfloat * m) __attribute__((alias("glshim_glMultMatrixf"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glMultMatrixx
 void glshim_glMultMatrixx(const GLfixed * m) {
-    LOAD_GLES(glMultMatrixx);
+    LOAD_GLES_NOSYNC(glMultMatrixx);
 #ifndef direct_glMultMatrixx
     PUSH_IF_COMPILING(glMultMatrixx)
 #endif
+    thread_sync();
     gles_glMultMatrixx(m);
 }
 void glMultMatrixx(const GLfixed * m) __attribute__((alias("glshim_glMultMatrixx"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glMultiTexCoord4f
 void glshim_glMultiTexCoord4f(GLenum target, GLfloat s, GLfloat t, GLfloat r, GLfloat q) {
-    LOAD_GLES(glMultiTexCoord4f);
+    LOAD_GLES_NOSYNC(glMultiTexCoord4f);
 #ifndef direct_glMultiTexCoord4f
     PUSH_IF_COMPILING(glMultiTexCoord4f)
 #endif
+    thread_sync();
     gles_glMultiTexCoord4f(target, s, t, r, q);
 }
 void glMultiTexCoord4f(GLenum target, GLfloat s, GLfloat t, GLfloat r, GLfloat q) __attribute__((alias("glshim_glMultiTexCoord4f"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glMultiTexCoord4x
 void glshim_glMultiTexCoord4x(GLenum target, GLfixed s, GLfixed t, GLfixed r, GLfixed q) {
-    LOAD_GLES(glMultiTexCoord4x);
+    LOAD_GLES_NOSYNC(glMultiTexCoord4x);
 #ifndef direct_glMultiTexCoord4x
     PUSH_IF_COMPILING(glMultiTexCoord4x)
 #endif
+    thread_sync();
     gles_glMultiTexCoord4x(target, s, t, r, q);
 }
 void glMultiTexCoord4x(GLenum target, GLfixed s, GLfixed t, GLfixed r, GLfixed q) __attribute__((alias("glshim_glMultiTexCoord4x"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glNormal3f
 void glshim_glNormal3f(GLfloat nx, GLfloat ny, GLfloat nz) {
-    LOAD_GLES(glNormal3f);
+    LOAD_GLES_NOSYNC(glNormal3f);
 #ifndef direct_glNormal3f
     PUSH_IF_COMPILING(glNormal3f)
 #endif
+    thread_sync();
     gles_glNormal3f(nx, ny, nz);
 }
 void glNormal3f(GLfloat nx, GLfloat ny, GLfloat nz) __attribute__((alias("glshim_glNormal3f"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glNormal3x
 void glshim_glNormal3x(GLfixed nx, GLfixed ny, GLfixed nz) {
-    LOAD_GLES(glNormal3x);
+    LOAD_GLES_NOSYNC(glNormal3x);
 #ifndef direct_glNormal3x
     PUSH_IF_COMPILING(glNormal3x)
 #endif
+    thread_sync();
     gles_glNormal3x(nx, ny, nz);
 }
 void glNormal3x(GLfixed nx, GLfixed ny, GLfixed nz) __attribute__((alias("glshim_glNormal3x"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glNormalPointer
 void glshim_glNormalPointer(GLenum type, GLsizei stride, const GLvoid * pointer) {
-    LOAD_GLES(glNormalPointer);
+    LOAD_GLES_NOSYNC(glNormalPointer);
 #ifndef direct_glNormalPointer
     PUSH_IF_COMPILING(glNormalPointer)
 #endif
+    thread_sync();
     gles_glNormalPointer(type, stride, pointer);
 }
 void glNormalPointer(GLenum type, GLsizei stride, const GLvoid * pointer) __attribute__((alias("glshim_glNormalPointer"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glOrthof
 void glshim_glOrthof(GLfloat left, GLfloat right, GLfloat bottom, GLfloat top, GLfloat near, GLfloat far) {
-    LOAD_GLES(glOrthof);
+    LOAD_GLES_NOSYNC(glOrthof);
 #ifndef direct_glOrthof
     PUSH_IF_COMPILING(glOrthof)
 #endif
+    thread_sync();
     gles_glOrthof(left, right, bottom, top, near, far);
 }
 void glOrthof(GLfloat left, GLfloat right, GLfloat bottom, GLfloat top, GLfloat near, GLfloat far) __attribute__((alias("glshim_glOrthof"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glOrthox
 void glshim_glOrthox(GLfixed left, GLfixed right, GLfixed bottom, GLfixed top, GLfixed near, GLfixed far) {
-    LOAD_GLES(glOrthox);
+    LOAD_GLES_NOSYNC(glOrthox);
 #ifndef direct_glOrthox
     PUSH_IF_COMPILING(glOrthox)
 #endif
+    thread_sync();
     gles_glOrthox(left, right, bottom, top, near, far);
 }
 void glOrthox(GLfixed left, GLfixed right, GLfixed bottom, GLfixed top, GLfixed near, GLfixed far) __attribute__((alias("glshim_glOrthox"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glPixelStorei
 void glshim_glPixelStorei(GLenum pname, GLint param) {
-    LOAD_GLES(glPixelStorei);
+    LOAD_GLES_NOSYNC(glPixelStorei);
 #ifndef direct_glPixelStorei
     PUSH_IF_COMPILING(glPixelStorei)
 #endif
+    thread_sync();
     gles_glPixelStorei(pname, param);
 }
 void glPixelStorei(GLenum pname, GLint param) __attribute__((alias("glshim_glPixelStorei"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glPointParameterf
 void glshim_glPointParameterf(GLenum pname, GLfloat param) {
-    LOAD_GLES(glPointParameterf);
+    LOAD_GLES_NOSYNC(glPointParameterf);
 #ifndef direct_glPointParameterf
     PUSH_IF_COMPILING(glPointParameterf)
 #endif
+    thread_sync();
     gles_glPointParameterf(pname, param);
 }
 void glPointParameterf(GLenum pname, GLfloat param) __attribute__((alias("glshim_glPointParameterf"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glPointParameterfv
 void glshim_glPointParameterfv(GLenum pname, const GLfloat * params) {
-    LOAD_GLES(glPointParameterfv);
+    LOAD_GLES_NOSYNC(glPointParameterfv);
 #ifndef direct_glPointParameterfv
     PUSH_IF_COMPILING(glPointParameterfv)
 #endif
+    thread_sync();
     gles_glPointParameterfv(pname, params);
 }
 void glPointParameterfv(GLenum pname, const GLfloat * params) __attribute__((alias("glshim_glPointParameterfv"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glPointParameterx
 void glshim_glPointParameterx(GLenum pname, GLfixed param) {
-    LOAD_GLES(glPointParameterx);
+    LOAD_GLES_NOSYNC(glPointParameterx);
 #ifndef direct_glPointParameterx
     PUSH_IF_COMPILING(glPointParameterx)
 #endif
+    thread_sync();
     gles_glPointParameterx(pname, param);
 }
 void glPointParameterx(GLenum pname, GLfixed param) __attribute__((alias("glshim_glPointParameterx"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glPointParameterxv
 void glshim_glPointParameterxv(GLenum pname, const GLfixed * params) {
-    LOAD_GLES(glPointParameterxv);
+    LOAD_GLES_NOSYNC(glPointParameterxv);
 #ifndef direct_glPointParameterxv
     PUSH_IF_COMPILING(glPointParameterxv)
 #endif
+    thread_sync();
     gles_glPointParameterxv(pname, params);
 }
 void glPointParameterxv(GLenum pname, const GLfixed * params) __attribute__((alias("glshim_glPointParameterxv"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glPointSize
 void glshim_glPointSize(GLfloat size) {
-    LOAD_GLES(glPointSize);
+    LOAD_GLES_NOSYNC(glPointSize);
 #ifndef direct_glPointSize
     PUSH_IF_COMPILING(glPointSize)
 #endif
+    thread_sync();
     gles_glPointSize(size);
 }
 void glPointSize(GLfloat size) __attribute__((alias("glshim_glPointSize"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glPointSizePointerOES
 void glshim_glPointSizePointerOES(GLenum type, GLsizei stride, const GLvoid * pointer) {
-    LOAD_GLES(glPointSizePointerOES);
+    LOAD_GLES_NOSYNC(glPointSizePointerOES);
 #ifndef direct_glPointSizePointerOES
     PUSH_IF_COMPILING(glPointSizePointerOES)
 #endif
+    thread_sync();
     gles_glPointSizePointerOES(type, stride, pointer);
 }
 void glPointSizePointerOES(GLenum type, GLsizei stride, const GLvoid * pointer) __attribute__((alias("glshim_glPointSizePointerOES"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glPointSizex
 void glshim_glPointSizex(GLfixed size) {
-    LOAD_GLES(glPointSizex);
+    LOAD_GLES_NOSYNC(glPointSizex);
 #ifndef direct_glPointSizex
     PUSH_IF_COMPILING(glPointSizex)
 #endif
+    thread_sync();
     gles_glPointSizex(size);
 }
 void glPointSizex(GLfixed size) __attribute__((alias("glshim_glPointSizex"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glPolygonOffset
 void glshim_glPolygonOffset(GLfloat factor, GLfloat units) {
-    LOAD_GLES(glPolygonOffset);
+    LOAD_GLES_NOSYNC(glPolygonOffset);
 #ifndef direct_glPolygonOffset
     PUSH_IF_COMPILING(glPolygonOffset)
 #endif
+    thread_sync();
     gles_glPolygonOffset(factor, units);
 }
 void glPolygonOffset(GLfloat factor, GLfloat units) __attribute__((alias("glshim_glPolygonOffset"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glPolygonOffsetx
 void glshim_glPolygonOffsetx(GLfixed factor, GLfixed units) {
-    LOAD_GLES(glPolygonOffsetx);
+    LOAD_GLES_NOSYNC(glPolygonOffsetx);
 #ifndef direct_glPolygonOffsetx
     PUSH_IF_COMPILING(glPolygonOffsetx)
 #endif
+    thread_sync();
     gles_glPolygonOffsetx(factor, units);
 }
 void glPolygonOffsetx(GLfixed factor, GLfixed units) __attribute__((alias("glshim_glPolygonOffsetx"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glPopMatrix
 void glshim_glPopMatrix() {
-    LOAD_GLES(glPopMatrix);
+    LOAD_GLES_NOSYNC(glPopMatrix);
 #ifndef direct_glPopMatrix
     PUSH_IF_COMPILING(glPopMatrix)
 #endif
+    thread_sync();
     gles_glPopMatrix();
 }
 void glPopMatrix() __attribute__((alias("glshim_glPopMatrix"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glPushMatrix
 void glshim_glPushMatrix() {
-    LOAD_GLES(glPushMatrix);
+    LOAD_GLES_NOSYNC(glPushMatrix);
 #ifndef direct_glPushMatrix
     PUSH_IF_COMPILING(glPushMatrix)
 #endif
+    thread_sync();
     gles_glPushMatrix();
 }
 void glPushMatrix() __attribute__((alias("glshim_glPushMatrix"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glReadPixels
 void glshim_glReadPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, GLvoid * pixels) {
-    LOAD_GLES(glReadPixels);
+    LOAD_GLES_NOSYNC(glReadPixels);
 #ifndef direct_glReadPixels
     PUSH_IF_COMPILING(glReadPixels)
 #endif
+    thread_sync();
     gles_glReadPixels(x, y, width, height, format, type, pixels);
 }
 void glReadPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, GLvoid * pixels) __attribute__((alias("glshim_glReadPixels"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glRotatef
 void glshim_glRotatef(GLfloat angle, GLfloat x, GLfloat y, GLfloat z) {
-    LOAD_GLES(glRotatef);
+    LOAD_GLES_NOSYNC(glRotatef);
 #ifndef direct_glRotatef
     PUSH_IF_COMPILING(glRotatef)
 #endif
+    thread_sync();
     gles_glRotatef(angle, x, y, z);
 }
 void glRotatef(GLfloat angle, GLfloat x, GLfloat y, GLfloat z) __attribute__((alias("glshim_glRotatef"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glRotatex
 void glshim_glRotatex(GLfixed angle, GLfixed x, GLfixed y, GLfixed z) {
-    LOAD_GLES(glRotatex);
+    LOAD_GLES_NOSYNC(glRotatex);
 #ifndef direct_glRotatex
     PUSH_IF_COMPILING(glRotatex)
 #endif
+    thread_sync();
     gles_glRotatex(angle, x, y, z);
 }
 void glRotatex(GLfixed angle, GLfixed x, GLfixed y, GLfixed z) __attribute__((alias("glshim_glRotatex"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glSampleCoverage
 void glshim_glSampleCoverage(GLclampf value, GLboolean invert) {
-    LOAD_GLES(glSampleCoverage);
+    LOAD_GLES_NOSYNC(glSampleCoverage);
 #ifndef direct_glSampleCoverage
     PUSH_IF_COMPILING(glSampleCoverage)
 #endif
+    thread_sync();
     gles_glSampleCoverage(value, invert);
 }
 void glSampleCoverage(GLclampf value, GLboolean invert) __attribute__((alias("glshim_glSampleCoverage"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glSampleCoveragex
 void glshim_glSampleCoveragex(GLclampx value, GLboolean invert) {
-    LOAD_GLES(glSampleCoveragex);
+    LOAD_GLES_NOSYNC(glSampleCoveragex);
 #ifndef direct_glSampleCoveragex
     PUSH_IF_COMPILING(glSampleCoveragex)
 #endif
+    thread_sync();
     gles_glSampleCoveragex(value, invert);
 }
 void glSampleCoveragex(GLclampx value, GLboolean invert) __attribute__((alias("glshim_glSampleCoveragex"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glScalef
 void glshim_glScalef(GLfloat x, GLfloat y, GLfloat z) {
-    LOAD_GLES(glScalef);
+    LOAD_GLES_NOSYNC(glScalef);
 #ifndef direct_glScalef
     PUSH_IF_COMPILING(glScalef)
 #endif
+    thread_sync();
     gles_glScalef(x, y, z);
 }
 void glScalef(GLfloat x, GLfloat y, GLfloat z) __attribute__((alias("glshim_glScalef"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glScalex
 void glshim_glScalex(GLfixed x, GLfixed y, GLfixed z) {
-    LOAD_GLES(glScalex);
+    LOAD_GLES_NOSYNC(glScalex);
 #ifndef direct_glScalex
     PUSH_IF_COMPILING(glScalex)
 #endif
+    thread_sync();
     gles_glScalex(x, y, z);
 }
 void glScalex(GLfixed x, GLfixed y, GLfixed z) __attribute__((alias("glshim_glScalex"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glScissor
 void glshim_glScissor(GLint x, GLint y, GLsizei width, GLsizei height) {
-    LOAD_GLES(glScissor);
+    LOAD_GLES_NOSYNC(glScissor);
 #ifndef direct_glScissor
     PUSH_IF_COMPILING(glScissor)
 #endif
+    thread_sync();
     gles_glScissor(x, y, width, height);
 }
 void glScissor(GLint x, GLint y, GLsizei width, GLsizei height) __attribute__((alias("glshim_glScissor"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glShadeModel
 void glshim_glShadeModel(GLenum mode) {
-    LOAD_GLES(glShadeModel);
+    LOAD_GLES_NOSYNC(glShadeModel);
 #ifndef direct_glShadeModel
     PUSH_IF_COMPILING(glShadeModel)
 #endif
+    thread_sync();
     gles_glShadeModel(mode);
 }
 void glShadeModel(GLenum mode) __attribute__((alias("glshim_glShadeModel"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glStencilFunc
 void glshim_glStencilFunc(GLenum func, GLint ref, GLuint mask) {
-    LOAD_GLES(glStencilFunc);
+    LOAD_GLES_NOSYNC(glStencilFunc);
 #ifndef direct_glStencilFunc
     PUSH_IF_COMPILING(glStencilFunc)
 #endif
+    thread_sync();
     gles_glStencilFunc(func, ref, mask);
 }
 void glStencilFunc(GLenum func, GLint ref, GLuint mask) __attribute__((alias("glshim_glStencilFunc"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glStencilMask
 void glshim_glStencilMask(GLuint mask) {
-    LOAD_GLES(glStencilMask);
+    LOAD_GLES_NOSYNC(glStencilMask);
 #ifndef direct_glStencilMask
     PUSH_IF_COMPILING(glStencilMask)
 #endif
+    thread_sync();
     gles_glStencilMask(mask);
 }
 void glStencilMask(GLuint mask) __attribute__((alias("glshim_glStencilMask"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glStencilOp
 void glshim_glStencilOp(GLenum fail, GLenum zfail, GLenum zpass) {
-    LOAD_GLES(glStencilOp);
+    LOAD_GLES_NOSYNC(glStencilOp);
 #ifndef direct_glStencilOp
     PUSH_IF_COMPILING(glStencilOp)
 #endif
+    thread_sync();
     gles_glStencilOp(fail, zfail, zpass);
 }
 void glStencilOp(GLenum fail, GLenum zfail, GLenum zpass) __attribute__((alias("glshim_glStencilOp"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glTexCoordPointer
 void glshim_glTexCoordPointer(GLint size, GLenum type, GLsizei stride, const GLvoid * pointer) {
-    LOAD_GLES(glTexCoordPointer);
+    LOAD_GLES_NOSYNC(glTexCoordPointer);
 #ifndef direct_glTexCoordPointer
     PUSH_IF_COMPILING(glTexCoordPointer)
 #endif
+    thread_sync();
     gles_glTexCoordPointer(size, type, stride, pointer);
 }
 void glTexCoordPointer(GLint size, GLenum type, GLsizei stride, const GLvoid * pointer) __attribute__((alias("glshim_glTexCoordPointer"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glTexEnvf
 void glshim_glTexEnvf(GLenum target, GLenum pname, GLfloat param) {
-    LOAD_GLES(glTexEnvf);
+    LOAD_GLES_NOSYNC(glTexEnvf);
 #ifndef direct_glTexEnvf
     PUSH_IF_COMPILING(glTexEnvf)
 #endif
+    thread_sync();
     gles_glTexEnvf(target, pname, param);
 }
 void glTexEnvf(GLenum target, GLenum pname, GLfloat param) __attribute__((alias("glshim_glTexEnvf"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glTexEnvfv
 void glshim_glTexEnvfv(GLenum target, GLenum pname, const GLfloat * params) {
-    LOAD_GLES(glTexEnvfv);
+    LOAD_GLES_NOSYNC(glTexEnvfv);
 #ifndef direct_glTexEnvfv
     PUSH_IF_COMPILING(glTexEnvfv)
 #endif
+    thread_sync();
     gles_glTexEnvfv(target, pname, params);
 }
 void glTexEnvfv(GLenum target, GLenum pname, const GLfloat * params) __attribute__((alias("glshim_glTexEnvfv"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glTexEnvi
 void glshim_glTexEnvi(GLenum target, GLenum pname, GLint param) {
-    LOAD_GLES(glTexEnvi);
+    LOAD_GLES_NOSYNC(glTexEnvi);
 #ifndef direct_glTexEnvi
     PUSH_IF_COMPILING(glTexEnvi)
 #endif
+    thread_sync();
     gles_glTexEnvi(target, pname, param);
 }
 void glTexEnvi(GLenum target, GLenum pname, GLint param) __attribute__((alias("glshim_glTexEnvi"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glTexEnviv
 void glshim_glTexEnviv(GLenum target, GLenum pname, const GLint * params) {
-    LOAD_GLES(glTexEnviv);
+    LOAD_GLES_NOSYNC(glTexEnviv);
 #ifndef direct_glTexEnviv
     PUSH_IF_COMPILING(glTexEnviv)
 #endif
+    thread_sync();
     gles_glTexEnviv(target, pname, params);
 }
 void glTexEnviv(GLenum target, GLenum pname, const GLint * params) __attribute__((alias("glshim_glTexEnviv"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glTexEnvx
 void glshim_glTexEnvx(GLenum target, GLenum pname, GLfixed param) {
-    LOAD_GLES(glTexEnvx);
+    LOAD_GLES_NOSYNC(glTexEnvx);
 #ifndef direct_glTexEnvx
     PUSH_IF_COMPILING(glTexEnvx)
 #endif
+    thread_sync();
     gles_glTexEnvx(target, pname, param);
 }
 void glTexEnvx(GLenum target, GLenum pname, GLfixed param) __attribute__((alias("glshim_glTexEnvx"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glTexEnvxv
 void glshim_glTexEnvxv(GLenum target, GLenum pname, const GLfixed * params) {
-    LOAD_GLES(glTexEnvxv);
+    LOAD_GLES_NOSYNC(glTexEnvxv);
 #ifndef direct_glTexEnvxv
     PUSH_IF_COMPILING(glTexEnvxv)
 #endif
+    thread_sync();
     gles_glTexEnvxv(target, pname, params);
 }
 void glTexEnvxv(GLenum target, GLenum pname, const GLfixed * params) __attribute__((alias("glshim_glTexEnvxv"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glTexImage2D
 void glshim_glTexImage2D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const GLvoid * pixels) {
-    LOAD_GLES(glTexImage2D);
+    LOAD_GLES_NOSYNC(glTexImage2D);
 #ifndef direct_glTexImage2D
     PUSH_IF_COMPILING(glTexImage2D)
 #endif
+    thread_sync();
     gles_glTexImage2D(target, level, internalformat, width, height, border, format, type, pixels);
 }
 void glTexImage2D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const GLvoid * pixels) __attribute__((alias("glshim_glTexImage2D"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glTexParameterf
 void glshim_glTexParameterf(GLenum target, GLenum pname, GLfloat param) {
-    LOAD_GLES(glTexParameterf);
+    LOAD_GLES_NOSYNC(glTexParameterf);
 #ifndef direct_glTexParameterf
     PUSH_IF_COMPILING(glTexParameterf)
 #endif
+    thread_sync();
     gles_glTexParameterf(target, pname, param);
 }
 void glTexParameterf(GLenum target, GLenum pname, GLfloat param) __attribute__((alias("glshim_glTexParameterf"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glTexParameterfv
 void glshim_glTexParameterfv(GLenum target, GLenum pname, const GLfloat * params) {
-    LOAD_GLES(glTexParameterfv);
+    LOAD_GLES_NOSYNC(glTexParameterfv);
 #ifndef direct_glTexParameterfv
     PUSH_IF_COMPILING(glTexParameterfv)
 #endif
+    thread_sync();
     gles_glTexParameterfv(target, pname, params);
 }
 void glTexParameterfv(GLenum target, GLenum pname, const GLfloat * params) __attribute__((alias("glshim_glTexParameterfv"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glTexParameteri
 void glshim_glTexParameteri(GLenum target, GLenum pname, GLint param) {
-    LOAD_GLES(glTexParameteri);
+    LOAD_GLES_NOSYNC(glTexParameteri);
 #ifndef direct_glTexParameteri
     PUSH_IF_COMPILING(glTexParameteri)
 #endif
+    thread_sync();
     gles_glTexParameteri(target, pname, param);
 }
 void glTexParameteri(GLenum target, GLenum pname, GLint param) __attribute__((alias("glshim_glTexParameteri"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glTexParameteriv
 void glshim_glTexParameteriv(GLenum target, GLenum pname, const GLint * params) {
-    LOAD_GLES(glTexParameteriv);
+    LOAD_GLES_NOSYNC(glTexParameteriv);
 #ifndef direct_glTexParameteriv
     PUSH_IF_COMPILING(glTexParameteriv)
 #endif
+    thread_sync();
     gles_glTexParameteriv(target, pname, params);
 }
 void glTexParameteriv(GLenum target, GLenum pname, const GLint * params) __attribute__((alias("glshim_glTexParameteriv"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glTexParameterx
 void glshim_glTexParameterx(GLenum target, GLenum pname, GLfixed param) {
-    LOAD_GLES(glTexParameterx);
+    LOAD_GLES_NOSYNC(glTexParameterx);
 #ifndef direct_glTexParameterx
     PUSH_IF_COMPILING(glTexParameterx)
 #endif
+    thread_sync();
     gles_glTexParameterx(target, pname, param);
 }
 void glTexParameterx(GLenum target, GLenum pname, GLfixed param) __attribute__((alias("glshim_glTexParameterx"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glTexParameterxv
 void glshim_glTexParameterxv(GLenum target, GLenum pname, const GLfixed * params) {
-    LOAD_GLES(glTexParameterxv);
+    LOAD_GLES_NOSYNC(glTexParameterxv);
 #ifndef direct_glTexParameterxv
     PUSH_IF_COMPILING(glTexParameterxv)
 #endif
+    thread_sync();
     gles_glTexParameterxv(target, pname, params);
 }
 void glTexParameterxv(GLenum target, GLenum pname, const GLfixed * params) __attribute__((alias("glshim_glTexParameterxv"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glTexSubImage2D
 void glshim_glTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const GLvoid * pixels) {
-    LOAD_GLES(glTexSubImage2D);
+    LOAD_GLES_NOSYNC(glTexSubImage2D);
 #ifndef direct_glTexSubImage2D
     PUSH_IF_COMPILING(glTexSubImage2D)
 #endif
+    thread_sync();
     gles_glTexSubImage2D(target, level, xoffset, yoffset, width, height, format, type, pixels);
 }
 void glTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const GLvoid * pixels) __attribute__((alias("glshim_glTexSubImage2D"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glTranslatef
 void glshim_glTranslatef(GLfloat x, GLfloat y, GLfloat z) {
-    LOAD_GLES(glTranslatef);
+    LOAD_GLES_NOSYNC(glTranslatef);
 #ifndef direct_glTranslatef
     PUSH_IF_COMPILING(glTranslatef)
 #endif
+    thread_sync();
     gles_glTranslatef(x, y, z);
 }
 void glTranslatef(GLfloat x, GLfloat y, GLfloat z) __attribute__((alias("glshim_glTranslatef"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glTranslatex
 void glshim_glTranslatex(GLfixed x, GLfixed y, GLfixed z) {
-    LOAD_GLES(glTranslatex);
+    LOAD_GLES_NOSYNC(glTranslatex);
 #ifndef direct_glTranslatex
     PUSH_IF_COMPILING(glTranslatex)
 #endif
+    thread_sync();
     gles_glTranslatex(x, y, z);
 }
 void glTranslatex(GLfixed x, GLfixed y, GLfixed z) __attribute__((alias("glshim_glTranslatex"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glVertexPointer
 void glshim_glVertexPointer(GLint size, GLenum type, GLsizei stride, const GLvoid * pointer) {
-    LOAD_GLES(glVertexPointer);
+    LOAD_GLES_NOSYNC(glVertexPointer);
 #ifndef direct_glVertexPointer
     PUSH_IF_COMPILING(glVertexPointer)
 #endif
+    thread_sync();
     gles_glVertexPointer(size, type, stride, pointer);
 }
 void glVertexPointer(GLint size, GLenum type, GLsizei stride, const GLvoid * pointer) __attribute__((alias("glshim_glVertexPointer"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glViewport
 void glshim_glViewport(GLint x, GLint y, GLsizei width, GLsizei height) {
-    LOAD_GLES(glViewport);
+    LOAD_GLES_NOSYNC(glViewport);
 #ifndef direct_glViewport
     PUSH_IF_COMPILING(glViewport)
 #endif
+    thread_sync();
     gles_glViewport(x, y, width, height);
 }
 void glViewport(GLint x, GLint y, GLsizei width, GLsizei height) __attribute__((alias("glshim_glViewport"))) __attribute__((visibility("default")));
@@ -1902,6 +2047,162 @@ void glPackedCall(const packed_call_t *packed) {
         }
     }
 }
+
+int glSizeofPackedCall(const packed_call_t *packed) {
+    switch (packed->format) {
+        case FORMAT_void_GLenum:
+            return sizeof(PACKED_void_GLenum);
+        case FORMAT_void_GLenum_GLclampf:
+            return sizeof(PACKED_void_GLenum_GLclampf);
+        case FORMAT_void_GLenum_GLclampx:
+            return sizeof(PACKED_void_GLenum_GLclampx);
+        case FORMAT_void_GLenum_GLuint:
+            return sizeof(PACKED_void_GLenum_GLuint);
+        case FORMAT_void_GLenum_GLenum:
+            return sizeof(PACKED_void_GLenum_GLenum);
+        case FORMAT_void_GLenum_GLsizeiptr_const_GLvoid___GENPT___GLenum:
+            return sizeof(PACKED_void_GLenum_GLsizeiptr_const_GLvoid___GENPT___GLenum);
+        case FORMAT_void_GLenum_GLintptr_GLsizeiptr_const_GLvoid___GENPT__:
+            return sizeof(PACKED_void_GLenum_GLintptr_GLsizeiptr_const_GLvoid___GENPT__);
+        case FORMAT_void_GLbitfield:
+            return sizeof(PACKED_void_GLbitfield);
+        case FORMAT_void_GLclampf_GLclampf_GLclampf_GLclampf:
+            return sizeof(PACKED_void_GLclampf_GLclampf_GLclampf_GLclampf);
+        case FORMAT_void_GLclampx_GLclampx_GLclampx_GLclampx:
+            return sizeof(PACKED_void_GLclampx_GLclampx_GLclampx_GLclampx);
+        case FORMAT_void_GLclampf:
+            return sizeof(PACKED_void_GLclampf);
+        case FORMAT_void_GLclampx:
+            return sizeof(PACKED_void_GLclampx);
+        case FORMAT_void_GLint:
+            return sizeof(PACKED_void_GLint);
+        case FORMAT_void_GLenum_const_GLfloat___GENPT__:
+            return sizeof(PACKED_void_GLenum_const_GLfloat___GENPT__);
+        case FORMAT_void_GLenum_const_GLfixed___GENPT__:
+            return sizeof(PACKED_void_GLenum_const_GLfixed___GENPT__);
+        case FORMAT_void_GLfloat_GLfloat_GLfloat_GLfloat:
+            return sizeof(PACKED_void_GLfloat_GLfloat_GLfloat_GLfloat);
+        case FORMAT_void_GLubyte_GLubyte_GLubyte_GLubyte:
+            return sizeof(PACKED_void_GLubyte_GLubyte_GLubyte_GLubyte);
+        case FORMAT_void_GLfixed_GLfixed_GLfixed_GLfixed:
+            return sizeof(PACKED_void_GLfixed_GLfixed_GLfixed_GLfixed);
+        case FORMAT_void_GLboolean_GLboolean_GLboolean_GLboolean:
+            return sizeof(PACKED_void_GLboolean_GLboolean_GLboolean_GLboolean);
+        case FORMAT_void_GLint_GLenum_GLsizei_const_GLvoid___GENPT__:
+            return sizeof(PACKED_void_GLint_GLenum_GLsizei_const_GLvoid___GENPT__);
+        case FORMAT_void_GLenum_GLint_GLenum_GLsizei_GLsizei_GLint_GLsizei_const_GLvoid___GENPT__:
+            return sizeof(PACKED_void_GLenum_GLint_GLenum_GLsizei_GLsizei_GLint_GLsizei_const_GLvoid___GENPT__);
+        case FORMAT_void_GLenum_GLint_GLint_GLint_GLsizei_GLsizei_GLenum_GLsizei_const_GLvoid___GENPT__:
+            return sizeof(PACKED_void_GLenum_GLint_GLint_GLint_GLsizei_GLsizei_GLenum_GLsizei_const_GLvoid___GENPT__);
+        case FORMAT_void_GLenum_GLint_GLenum_GLint_GLint_GLsizei_GLsizei_GLint:
+            return sizeof(PACKED_void_GLenum_GLint_GLenum_GLint_GLint_GLsizei_GLsizei_GLint);
+        case FORMAT_void_GLenum_GLint_GLint_GLint_GLint_GLint_GLsizei_GLsizei:
+            return sizeof(PACKED_void_GLenum_GLint_GLint_GLint_GLint_GLint_GLsizei_GLsizei);
+        case FORMAT_void_GLsizei_const_GLuint___GENPT__:
+            return sizeof(PACKED_void_GLsizei_const_GLuint___GENPT__);
+        case FORMAT_void_GLboolean:
+            return sizeof(PACKED_void_GLboolean);
+        case FORMAT_void_GLclampf_GLclampf:
+            return sizeof(PACKED_void_GLclampf_GLclampf);
+        case FORMAT_void_GLclampx_GLclampx:
+            return sizeof(PACKED_void_GLclampx_GLclampx);
+        case FORMAT_void_GLenum_GLint_GLsizei:
+            return sizeof(PACKED_void_GLenum_GLint_GLsizei);
+        case FORMAT_void_GLenum_GLsizei_GLenum_const_GLvoid___GENPT__:
+            return sizeof(PACKED_void_GLenum_GLsizei_GLenum_const_GLvoid___GENPT__);
+        case FORMAT_void:
+            return sizeof(PACKED_void);
+        case FORMAT_void_GLenum_GLfloat:
+            return sizeof(PACKED_void_GLenum_GLfloat);
+        case FORMAT_void_GLenum_GLfixed:
+            return sizeof(PACKED_void_GLenum_GLfixed);
+        case FORMAT_void_GLfloat_GLfloat_GLfloat_GLfloat_GLfloat_GLfloat:
+            return sizeof(PACKED_void_GLfloat_GLfloat_GLfloat_GLfloat_GLfloat_GLfloat);
+        case FORMAT_void_GLfixed_GLfixed_GLfixed_GLfixed_GLfixed_GLfixed:
+            return sizeof(PACKED_void_GLfixed_GLfixed_GLfixed_GLfixed_GLfixed_GLfixed);
+        case FORMAT_void_GLsizei_GLuint___GENPT__:
+            return sizeof(PACKED_void_GLsizei_GLuint___GENPT__);
+        case FORMAT_void_GLenum_GLboolean___GENPT__:
+            return sizeof(PACKED_void_GLenum_GLboolean___GENPT__);
+        case FORMAT_void_GLenum_GLenum_GLint___GENPT__:
+            return sizeof(PACKED_void_GLenum_GLenum_GLint___GENPT__);
+        case FORMAT_void_GLenum_GLfloat___GENPT__:
+            return sizeof(PACKED_void_GLenum_GLfloat___GENPT__);
+        case FORMAT_void_GLenum_GLfixed___GENPT__:
+            return sizeof(PACKED_void_GLenum_GLfixed___GENPT__);
+        case FORMAT_GLenum:
+            return sizeof(PACKED_GLenum);
+        case FORMAT_void_GLenum_GLint___GENPT__:
+            return sizeof(PACKED_void_GLenum_GLint___GENPT__);
+        case FORMAT_void_GLenum_GLenum_GLfloat___GENPT__:
+            return sizeof(PACKED_void_GLenum_GLenum_GLfloat___GENPT__);
+        case FORMAT_void_GLenum_GLenum_GLfixed___GENPT__:
+            return sizeof(PACKED_void_GLenum_GLenum_GLfixed___GENPT__);
+        case FORMAT_void_GLenum_GLvoid___GENPT____GENPT__:
+            return sizeof(PACKED_void_GLenum_GLvoid___GENPT____GENPT__);
+        case FORMAT_const_GLubyte___GENPT___GLenum:
+            return sizeof(PACKED_const_GLubyte___GENPT___GLenum);
+        case FORMAT_GLboolean_GLuint:
+            return sizeof(PACKED_GLboolean_GLuint);
+        case FORMAT_GLboolean_GLenum:
+            return sizeof(PACKED_GLboolean_GLenum);
+        case FORMAT_void_GLenum_GLenum_GLfloat:
+            return sizeof(PACKED_void_GLenum_GLenum_GLfloat);
+        case FORMAT_void_GLenum_GLenum_const_GLfloat___GENPT__:
+            return sizeof(PACKED_void_GLenum_GLenum_const_GLfloat___GENPT__);
+        case FORMAT_void_GLenum_GLenum_GLfixed:
+            return sizeof(PACKED_void_GLenum_GLenum_GLfixed);
+        case FORMAT_void_GLenum_GLenum_const_GLfixed___GENPT__:
+            return sizeof(PACKED_void_GLenum_GLenum_const_GLfixed___GENPT__);
+        case FORMAT_void_GLfloat:
+            return sizeof(PACKED_void_GLfloat);
+        case FORMAT_void_GLfixed:
+            return sizeof(PACKED_void_GLfixed);
+        case FORMAT_void_const_GLfloat___GENPT__:
+            return sizeof(PACKED_void_const_GLfloat___GENPT__);
+        case FORMAT_void_const_GLfixed___GENPT__:
+            return sizeof(PACKED_void_const_GLfixed___GENPT__);
+        case FORMAT_void_GLenum_GLfloat_GLfloat_GLfloat_GLfloat:
+            return sizeof(PACKED_void_GLenum_GLfloat_GLfloat_GLfloat_GLfloat);
+        case FORMAT_void_GLenum_GLfixed_GLfixed_GLfixed_GLfixed:
+            return sizeof(PACKED_void_GLenum_GLfixed_GLfixed_GLfixed_GLfixed);
+        case FORMAT_void_GLfloat_GLfloat_GLfloat:
+            return sizeof(PACKED_void_GLfloat_GLfloat_GLfloat);
+        case FORMAT_void_GLfixed_GLfixed_GLfixed:
+            return sizeof(PACKED_void_GLfixed_GLfixed_GLfixed);
+        case FORMAT_void_GLenum_GLsizei_const_GLvoid___GENPT__:
+            return sizeof(PACKED_void_GLenum_GLsizei_const_GLvoid___GENPT__);
+        case FORMAT_void_GLenum_GLint:
+            return sizeof(PACKED_void_GLenum_GLint);
+        case FORMAT_void_GLfloat_GLfloat:
+            return sizeof(PACKED_void_GLfloat_GLfloat);
+        case FORMAT_void_GLfixed_GLfixed:
+            return sizeof(PACKED_void_GLfixed_GLfixed);
+        case FORMAT_void_GLint_GLint_GLsizei_GLsizei_GLenum_GLenum_GLvoid___GENPT__:
+            return sizeof(PACKED_void_GLint_GLint_GLsizei_GLsizei_GLenum_GLenum_GLvoid___GENPT__);
+        case FORMAT_void_GLclampf_GLboolean:
+            return sizeof(PACKED_void_GLclampf_GLboolean);
+        case FORMAT_void_GLclampx_GLboolean:
+            return sizeof(PACKED_void_GLclampx_GLboolean);
+        case FORMAT_void_GLint_GLint_GLsizei_GLsizei:
+            return sizeof(PACKED_void_GLint_GLint_GLsizei_GLsizei);
+        case FORMAT_void_GLenum_GLint_GLuint:
+            return sizeof(PACKED_void_GLenum_GLint_GLuint);
+        case FORMAT_void_GLuint:
+            return sizeof(PACKED_void_GLuint);
+        case FORMAT_void_GLenum_GLenum_GLenum:
+            return sizeof(PACKED_void_GLenum_GLenum_GLenum);
+        case FORMAT_void_GLenum_GLenum_GLint:
+            return sizeof(PACKED_void_GLenum_GLenum_GLint);
+        case FORMAT_void_GLenum_GLenum_const_GLint___GENPT__:
+            return sizeof(PACKED_void_GLenum_GLenum_const_GLint___GENPT__);
+        case FORMAT_void_GLenum_GLint_GLint_GLsizei_GLsizei_GLint_GLenum_GLenum_const_GLvoid___GENPT__:
+            return sizeof(PACKED_void_GLenum_GLint_GLint_GLsizei_GLsizei_GLint_GLenum_GLenum_const_GLvoid___GENPT__);
+        case FORMAT_void_GLenum_GLint_GLint_GLint_GLsizei_GLsizei_GLenum_GLenum_const_GLvoid___GENPT__:
+            return sizeof(PACKED_void_GLenum_GLint_GLint_GLint_GLsizei_GLsizei_GLenum_GLenum_const_GLvoid___GENPT__);
+    }
+    return 0;
+}
 /*
 packed_call_t* glCopyPackedCall(const packed_call_t *packed) {
     switch (packed->format) {
@@ -1386,6 +1386,7 @@ typedef struct {
 
 extern void glPushCall(void *data);
 void glPackedCall(const packed_call_t *packed);
+int glSizeofPackedCall(const packed_call_t *packed);
 void glIndexedCall(const indexed_call_t *packed, void *ret_v);
 /*packed_call_t* glCopyPackedCall(const packed_call_t *packed);*/
 
@@ -2925,7 +2926,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 
 #ifndef direct_glActiveTexture
 #define push_glActiveTexture(texture) { \
-    glActiveTexture_PACKED *packed_data = malloc(sizeof(glActiveTexture_PACKED)); \
+    glActiveTexture_PACKED packed_data[1]; \
     packed_data->format = glActiveTexture_FORMAT; \
     packed_data->func = glshim_glActiveTexture; \
     packed_data->args.a1 = (GLenum)texture; \
@@ -2934,7 +2935,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glAlphaFunc
 #define push_glAlphaFunc(func, ref) { \
-    glAlphaFunc_PACKED *packed_data = malloc(sizeof(glAlphaFunc_PACKED)); \
+    glAlphaFunc_PACKED packed_data[1]; \
     packed_data->format = glAlphaFunc_FORMAT; \
     packed_data->func = glshim_glAlphaFunc; \
     packed_data->args.a1 = (GLenum)func; \
@@ -2944,7 +2945,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glAlphaFuncx
 #define push_glAlphaFuncx(func, ref) { \
-    glAlphaFuncx_PACKED *packed_data = malloc(sizeof(glAlphaFuncx_PACKED)); \
+    glAlphaFuncx_PACKED packed_data[1]; \
     packed_data->format = glAlphaFuncx_FORMAT; \
     packed_data->func = glshim_glAlphaFuncx; \
     packed_data->args.a1 = (GLenum)func; \
@@ -2954,7 +2955,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glBindBuffer
 #define push_glBindBuffer(target, buffer) { \
-    glBindBuffer_PACKED *packed_data = malloc(sizeof(glBindBuffer_PACKED)); \
+    glBindBuffer_PACKED packed_data[1]; \
     packed_data->format = glBindBuffer_FORMAT; \
     packed_data->func = glshim_glBindBuffer; \
     packed_data->args.a1 = (GLenum)target; \
@@ -2964,7 +2965,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glBindFramebuffer
 #define push_glBindFramebuffer(target, framebuffer) { \
-    glBindFramebuffer_PACKED *packed_data = malloc(sizeof(glBindFramebuffer_PACKED)); \
+    glBindFramebuffer_PACKED packed_data[1]; \
     packed_data->format = glBindFramebuffer_FORMAT; \
     packed_data->func = glshim_glBindFramebuffer; \
     packed_data->args.a1 = (GLenum)target; \
@@ -2974,7 +2975,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glBindRenderbuffer
 #define push_glBindRenderbuffer(target, renderbuffer) { \
-    glBindRenderbuffer_PACKED *packed_data = malloc(sizeof(glBindRenderbuffer_PACKED)); \
+    glBindRenderbuffer_PACKED packed_data[1]; \
     packed_data->format = glBindRenderbuffer_FORMAT; \
     packed_data->func = glshim_glBindRenderbuffer; \
     packed_data->args.a1 = (GLenum)target; \
@@ -2984,7 +2985,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glBindTexture
 #define push_glBindTexture(target, texture) { \
-    glBindTexture_PACKED *packed_data = malloc(sizeof(glBindTexture_PACKED)); \
+    glBindTexture_PACKED packed_data[1]; \
     packed_data->format = glBindTexture_FORMAT; \
     packed_data->func = glshim_glBindTexture; \
     packed_data->args.a1 = (GLenum)target; \
@@ -2994,7 +2995,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glBlendColor
 #define push_glBlendColor(red, green, blue, alpha) { \
-    glBlendColor_PACKED *packed_data = malloc(sizeof(glBlendColor_PACKED)); \
+    glBlendColor_PACKED packed_data[1]; \
     packed_data->format = glBlendColor_FORMAT; \
     packed_data->func = glshim_glBlendColor; \
     packed_data->args.a1 = (GLclampf)red; \
@@ -3006,7 +3007,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glBlendEquation
 #define push_glBlendEquation(mode) { \
-    glBlendEquation_PACKED *packed_data = malloc(sizeof(glBlendEquation_PACKED)); \
+    glBlendEquation_PACKED packed_data[1]; \
     packed_data->format = glBlendEquation_FORMAT; \
     packed_data->func = glshim_glBlendEquation; \
     packed_data->args.a1 = (GLenum)mode; \
@@ -3015,7 +3016,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glBlendEquationSeparate
 #define push_glBlendEquationSeparate(modeRGB, modeA) { \
-    glBlendEquationSeparate_PACKED *packed_data = malloc(sizeof(glBlendEquationSeparate_PACKED)); \
+    glBlendEquationSeparate_PACKED packed_data[1]; \
     packed_data->format = glBlendEquationSeparate_FORMAT; \
     packed_data->func = glshim_glBlendEquationSeparate; \
     packed_data->args.a1 = (GLenum)modeRGB; \
@@ -3025,7 +3026,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glBlendFunc
 #define push_glBlendFunc(sfactor, dfactor) { \
-    glBlendFunc_PACKED *packed_data = malloc(sizeof(glBlendFunc_PACKED)); \
+    glBlendFunc_PACKED packed_data[1]; \
     packed_data->format = glBlendFunc_FORMAT; \
     packed_data->func = glshim_glBlendFunc; \
     packed_data->args.a1 = (GLenum)sfactor; \
@@ -3035,7 +3036,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glBlendFuncSeparate
 #define push_glBlendFuncSeparate(sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha) { \
-    glBlendFuncSeparate_PACKED *packed_data = malloc(sizeof(glBlendFuncSeparate_PACKED)); \
+    glBlendFuncSeparate_PACKED packed_data[1]; \
     packed_data->format = glBlendFuncSeparate_FORMAT; \
     packed_data->func = glshim_glBlendFuncSeparate; \
     packed_data->args.a1 = (GLenum)sfactorRGB; \
@@ -3047,7 +3048,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glBufferData
 #define push_glBufferData(target, size, data, usage) { \
-    glBufferData_PACKED *packed_data = malloc(sizeof(glBufferData_PACKED)); \
+    glBufferData_PACKED packed_data[1]; \
     packed_data->format = glBufferData_FORMAT; \
     packed_data->func = glshim_glBufferData; \
     packed_data->args.a1 = (GLenum)target; \
@@ -3059,7 +3060,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glBufferSubData
 #define push_glBufferSubData(target, offset, size, data) { \
-    glBufferSubData_PACKED *packed_data = malloc(sizeof(glBufferSubData_PACKED)); \
+    glBufferSubData_PACKED packed_data[1]; \
     packed_data->format = glBufferSubData_FORMAT; \
     packed_data->func = glshim_glBufferSubData; \
     packed_data->args.a1 = (GLenum)target; \
@@ -3071,7 +3072,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glCheckFramebufferStatus
 #define push_glCheckFramebufferStatus(target) { \
-    glCheckFramebufferStatus_PACKED *packed_data = malloc(sizeof(glCheckFramebufferStatus_PACKED)); \
+    glCheckFramebufferStatus_PACKED packed_data[1]; \
     packed_data->format = glCheckFramebufferStatus_FORMAT; \
     packed_data->func = glshim_glCheckFramebufferStatus; \
     packed_data->args.a1 = (GLenum)target; \
@@ -3080,7 +3081,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glClear
 #define push_glClear(mask) { \
-    glClear_PACKED *packed_data = malloc(sizeof(glClear_PACKED)); \
+    glClear_PACKED packed_data[1]; \
     packed_data->format = glClear_FORMAT; \
     packed_data->func = glshim_glClear; \
     packed_data->args.a1 = (GLbitfield)mask; \
@@ -3089,7 +3090,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glClearColor
 #define push_glClearColor(red, green, blue, alpha) { \
-    glClearColor_PACKED *packed_data = malloc(sizeof(glClearColor_PACKED)); \
+    glClearColor_PACKED packed_data[1]; \
     packed_data->format = glClearColor_FORMAT; \
     packed_data->func = glshim_glClearColor; \
     packed_data->args.a1 = (GLclampf)red; \
@@ -3101,7 +3102,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glClearColorx
 #define push_glClearColorx(red, green, blue, alpha) { \
-    glClearColorx_PACKED *packed_data = malloc(sizeof(glClearColorx_PACKED)); \
+    glClearColorx_PACKED packed_data[1]; \
     packed_data->format = glClearColorx_FORMAT; \
     packed_data->func = glshim_glClearColorx; \
     packed_data->args.a1 = (GLclampx)red; \
@@ -3113,7 +3114,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glClearDepthf
 #define push_glClearDepthf(depth) { \
-    glClearDepthf_PACKED *packed_data = malloc(sizeof(glClearDepthf_PACKED)); \
+    glClearDepthf_PACKED packed_data[1]; \
     packed_data->format = glClearDepthf_FORMAT; \
     packed_data->func = glshim_glClearDepthf; \
     packed_data->args.a1 = (GLclampf)depth; \
@@ -3122,7 +3123,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glClearDepthx
 #define push_glClearDepthx(depth) { \
-    glClearDepthx_PACKED *packed_data = malloc(sizeof(glClearDepthx_PACKED)); \
+    glClearDepthx_PACKED packed_data[1]; \
     packed_data->format = glClearDepthx_FORMAT; \
     packed_data->func = glshim_glClearDepthx; \
     packed_data->args.a1 = (GLclampx)depth; \
@@ -3131,7 +3132,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glClearStencil
 #define push_glClearStencil(s) { \
-    glClearStencil_PACKED *packed_data = malloc(sizeof(glClearStencil_PACKED)); \
+    glClearStencil_PACKED packed_data[1]; \
     packed_data->format = glClearStencil_FORMAT; \
     packed_data->func = glshim_glClearStencil; \
     packed_data->args.a1 = (GLint)s; \
@@ -3140,7 +3141,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glClientActiveTexture
 #define push_glClientActiveTexture(texture) { \
-    glClientActiveTexture_PACKED *packed_data = malloc(sizeof(glClientActiveTexture_PACKED)); \
+    glClientActiveTexture_PACKED packed_data[1]; \
     packed_data->format = glClientActiveTexture_FORMAT; \
     packed_data->func = glshim_glClientActiveTexture; \
     packed_data->args.a1 = (GLenum)texture; \
@@ -3149,7 +3150,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glClipPlanef
 #define push_glClipPlanef(plane, equation) { \
-    glClipPlanef_PACKED *packed_data = malloc(sizeof(glClipPlanef_PACKED)); \
+    glClipPlanef_PACKED packed_data[1]; \
     packed_data->format = glClipPlanef_FORMAT; \
     packed_data->func = glshim_glClipPlanef; \
     packed_data->args.a1 = (GLenum)plane; \
@@ -3159,7 +3160,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glClipPlanex
 #define push_glClipPlanex(plane, equation) { \
-    glClipPlanex_PACKED *packed_data = malloc(sizeof(glClipPlanex_PACKED)); \
+    glClipPlanex_PACKED packed_data[1]; \
     packed_data->format = glClipPlanex_FORMAT; \
     packed_data->func = glshim_glClipPlanex; \
     packed_data->args.a1 = (GLenum)plane; \
@@ -3169,7 +3170,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glColor4f
 #define push_glColor4f(red, green, blue, alpha) { \
-    glColor4f_PACKED *packed_data = malloc(sizeof(glColor4f_PACKED)); \
+    glColor4f_PACKED packed_data[1]; \
     packed_data->format = glColor4f_FORMAT; \
     packed_data->func = glshim_glColor4f; \
     packed_data->args.a1 = (GLfloat)red; \
@@ -3181,7 +3182,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glColor4ub
 #define push_glColor4ub(red, green, blue, alpha) { \
-    glColor4ub_PACKED *packed_data = malloc(sizeof(glColor4ub_PACKED)); \
+    glColor4ub_PACKED packed_data[1]; \
     packed_data->format = glColor4ub_FORMAT; \
     packed_data->func = glshim_glColor4ub; \
     packed_data->args.a1 = (GLubyte)red; \
@@ -3193,7 +3194,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glColor4x
 #define push_glColor4x(red, green, blue, alpha) { \
-    glColor4x_PACKED *packed_data = malloc(sizeof(glColor4x_PACKED)); \
+    glColor4x_PACKED packed_data[1]; \
     packed_data->format = glColor4x_FORMAT; \
     packed_data->func = glshim_glColor4x; \
     packed_data->args.a1 = (GLfixed)red; \
@@ -3205,7 +3206,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glColorMask
 #define push_glColorMask(red, green, blue, alpha) { \
-    glColorMask_PACKED *packed_data = malloc(sizeof(glColorMask_PACKED)); \
+    glColorMask_PACKED packed_data[1]; \
     packed_data->format = glColorMask_FORMAT; \
     packed_data->func = glshim_glColorMask; \
     packed_data->args.a1 = (GLboolean)red; \
@@ -3217,7 +3218,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glColorPointer
 #define push_glColorPointer(size, type, stride, pointer) { \
-    glColorPointer_PACKED *packed_data = malloc(sizeof(glColorPointer_PACKED)); \
+    glColorPointer_PACKED packed_data[1]; \
     packed_data->format = glColorPointer_FORMAT; \
     packed_data->func = glshim_glColorPointer; \
     packed_data->args.a1 = (GLint)size; \
@@ -3229,7 +3230,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glCompressedTexImage2D
 #define push_glCompressedTexImage2D(target, level, internalformat, width, height, border, imageSize, data) { \
-    glCompressedTexImage2D_PACKED *packed_data = malloc(sizeof(glCompressedTexImage2D_PACKED)); \
+    glCompressedTexImage2D_PACKED packed_data[1]; \
     packed_data->format = glCompressedTexImage2D_FORMAT; \
     packed_data->func = glshim_glCompressedTexImage2D; \
     packed_data->args.a1 = (GLenum)target; \
@@ -3245,7 +3246,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glCompressedTexSubImage2D
 #define push_glCompressedTexSubImage2D(target, level, xoffset, yoffset, width, height, format, imageSize, data) { \
-    glCompressedTexSubImage2D_PACKED *packed_data = malloc(sizeof(glCompressedTexSubImage2D_PACKED)); \
+    glCompressedTexSubImage2D_PACKED packed_data[1]; \
     packed_data->format = glCompressedTexSubImage2D_FORMAT; \
     packed_data->func = glshim_glCompressedTexSubImage2D; \
     packed_data->args.a1 = (GLenum)target; \
@@ -3262,7 +3263,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glCopyTexImage2D
 #define push_glCopyTexImage2D(target, level, internalformat, x, y, width, height, border) { \
-    glCopyTexImage2D_PACKED *packed_data = malloc(sizeof(glCopyTexImage2D_PACKED)); \
+    glCopyTexImage2D_PACKED packed_data[1]; \
     packed_data->format = glCopyTexImage2D_FORMAT; \
     packed_data->func = glshim_glCopyTexImage2D; \
     packed_data->args.a1 = (GLenum)target; \
@@ -3278,7 +3279,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glCopyTexSubImage2D
 #define push_glCopyTexSubImage2D(target, level, xoffset, yoffset, x, y, width, height) { \
-    glCopyTexSubImage2D_PACKED *packed_data = malloc(sizeof(glCopyTexSubImage2D_PACKED)); \
+    glCopyTexSubImage2D_PACKED packed_data[1]; \
     packed_data->format = glCopyTexSubImage2D_FORMAT; \
     packed_data->func = glshim_glCopyTexSubImage2D; \
     packed_data->args.a1 = (GLenum)target; \
@@ -3294,7 +3295,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glCullFace
 #define push_glCullFace(mode) { \
-    glCullFace_PACKED *packed_data = malloc(sizeof(glCullFace_PACKED)); \
+    glCullFace_PACKED packed_data[1]; \
     packed_data->format = glCullFace_FORMAT; \
     packed_data->func = glshim_glCullFace; \
     packed_data->args.a1 = (GLenum)mode; \
@@ -3303,7 +3304,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glDeleteBuffers
 #define push_glDeleteBuffers(n, buffers) { \
-    glDeleteBuffers_PACKED *packed_data = malloc(sizeof(glDeleteBuffers_PACKED)); \
+    glDeleteBuffers_PACKED packed_data[1]; \
     packed_data->format = glDeleteBuffers_FORMAT; \
     packed_data->func = glshim_glDeleteBuffers; \
     packed_data->args.a1 = (GLsizei)n; \
@@ -3313,7 +3314,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glDeleteFramebuffers
 #define push_glDeleteFramebuffers(n, framebuffers) { \
-    glDeleteFramebuffers_PACKED *packed_data = malloc(sizeof(glDeleteFramebuffers_PACKED)); \
+    glDeleteFramebuffers_PACKED packed_data[1]; \
     packed_data->format = glDeleteFramebuffers_FORMAT; \
     packed_data->func = glshim_glDeleteFramebuffers; \
     packed_data->args.a1 = (GLsizei)n; \
@@ -3323,7 +3324,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glDeleteRenderbuffers
 #define push_glDeleteRenderbuffers(n, renderbuffers) { \
-    glDeleteRenderbuffers_PACKED *packed_data = malloc(sizeof(glDeleteRenderbuffers_PACKED)); \
+    glDeleteRenderbuffers_PACKED packed_data[1]; \
     packed_data->format = glDeleteRenderbuffers_FORMAT; \
     packed_data->func = glshim_glDeleteRenderbuffers; \
     packed_data->args.a1 = (GLsizei)n; \
@@ -3333,7 +3334,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glDeleteTextures
 #define push_glDeleteTextures(n, textures) { \
-    glDeleteTextures_PACKED *packed_data = malloc(sizeof(glDeleteTextures_PACKED)); \
+    glDeleteTextures_PACKED packed_data[1]; \
     packed_data->format = glDeleteTextures_FORMAT; \
     packed_data->func = glshim_glDeleteTextures; \
     packed_data->args.a1 = (GLsizei)n; \
@@ -3343,7 +3344,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glDepthFunc
 #define push_glDepthFunc(func) { \
-    glDepthFunc_PACKED *packed_data = malloc(sizeof(glDepthFunc_PACKED)); \
+    glDepthFunc_PACKED packed_data[1]; \
     packed_data->format = glDepthFunc_FORMAT; \
     packed_data->func = glshim_glDepthFunc; \
     packed_data->args.a1 = (GLenum)func; \
@@ -3352,7 +3353,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glDepthMask
 #define push_glDepthMask(flag) { \
-    glDepthMask_PACKED *packed_data = malloc(sizeof(glDepthMask_PACKED)); \
+    glDepthMask_PACKED packed_data[1]; \
     packed_data->format = glDepthMask_FORMAT; \
     packed_data->func = glshim_glDepthMask; \
     packed_data->args.a1 = (GLboolean)flag; \
@@ -3361,7 +3362,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glDepthRangef
 #define push_glDepthRangef(near, far) { \
-    glDepthRangef_PACKED *packed_data = malloc(sizeof(glDepthRangef_PACKED)); \
+    glDepthRangef_PACKED packed_data[1]; \
     packed_data->format = glDepthRangef_FORMAT; \
     packed_data->func = glshim_glDepthRangef; \
     packed_data->args.a1 = (GLclampf)near; \
@@ -3371,7 +3372,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glDepthRangex
 #define push_glDepthRangex(near, far) { \
-    glDepthRangex_PACKED *packed_data = malloc(sizeof(glDepthRangex_PACKED)); \
+    glDepthRangex_PACKED packed_data[1]; \
     packed_data->format = glDepthRangex_FORMAT; \
     packed_data->func = glshim_glDepthRangex; \
     packed_data->args.a1 = (GLclampx)near; \
@@ -3381,7 +3382,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glDisable
 #define push_glDisable(cap) { \
-    glDisable_PACKED *packed_data = malloc(sizeof(glDisable_PACKED)); \
+    glDisable_PACKED packed_data[1]; \
     packed_data->format = glDisable_FORMAT; \
     packed_data->func = glshim_glDisable; \
     packed_data->args.a1 = (GLenum)cap; \
@@ -3390,7 +3391,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glDisableClientState
 #define push_glDisableClientState(array) { \
-    glDisableClientState_PACKED *packed_data = malloc(sizeof(glDisableClientState_PACKED)); \
+    glDisableClientState_PACKED packed_data[1]; \
     packed_data->format = glDisableClientState_FORMAT; \
     packed_data->func = glshim_glDisableClientState; \
     packed_data->args.a1 = (GLenum)array; \
@@ -3399,7 +3400,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glDrawArrays
 #define push_glDrawArrays(mode, first, count) { \
-    glDrawArrays_PACKED *packed_data = malloc(sizeof(glDrawArrays_PACKED)); \
+    glDrawArrays_PACKED packed_data[1]; \
     packed_data->format = glDrawArrays_FORMAT; \
     packed_data->func = glshim_glDrawArrays; \
     packed_data->args.a1 = (GLenum)mode; \
@@ -3410,7 +3411,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glDrawElements
 #define push_glDrawElements(mode, count, type, indices) { \
-    glDrawElements_PACKED *packed_data = malloc(sizeof(glDrawElements_PACKED)); \
+    glDrawElements_PACKED packed_data[1]; \
     packed_data->format = glDrawElements_FORMAT; \
     packed_data->func = glshim_glDrawElements; \
     packed_data->args.a1 = (GLenum)mode; \
@@ -3422,7 +3423,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glDrawTexf
 #define push_glDrawTexf(x, y, z, width, height) { \
-    glDrawTexf_PACKED *packed_data = malloc(sizeof(glDrawTexf_PACKED)); \
+    glDrawTexf_PACKED packed_data[1]; \
     packed_data->format = glDrawTexf_FORMAT; \
     packed_data->func = glshim_glDrawTexf; \
     packed_data->args.a1 = (GLfloat)x; \
@@ -3435,7 +3436,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glDrawTexi
 #define push_glDrawTexi(x, y, z, width, height) { \
-    glDrawTexi_PACKED *packed_data = malloc(sizeof(glDrawTexi_PACKED)); \
+    glDrawTexi_PACKED packed_data[1]; \
     packed_data->format = glDrawTexi_FORMAT; \
     packed_data->func = glshim_glDrawTexi; \
     packed_data->args.a1 = (GLint)x; \
@@ -3448,7 +3449,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glEnable
 #define push_glEnable(cap) { \
-    glEnable_PACKED *packed_data = malloc(sizeof(glEnable_PACKED)); \
+    glEnable_PACKED packed_data[1]; \
     packed_data->format = glEnable_FORMAT; \
     packed_data->func = glshim_glEnable; \
     packed_data->args.a1 = (GLenum)cap; \
@@ -3457,7 +3458,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glEnableClientState
 #define push_glEnableClientState(array) { \
-    glEnableClientState_PACKED *packed_data = malloc(sizeof(glEnableClientState_PACKED)); \
+    glEnableClientState_PACKED packed_data[1]; \
     packed_data->format = glEnableClientState_FORMAT; \
     packed_data->func = glshim_glEnableClientState; \
     packed_data->args.a1 = (GLenum)array; \
@@ -3466,7 +3467,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glFinish
 #define push_glFinish() { \
-    glFinish_PACKED *packed_data = malloc(sizeof(glFinish_PACKED)); \
+    glFinish_PACKED packed_data[1]; \
     packed_data->format = glFinish_FORMAT; \
     packed_data->func = glshim_glFinish; \
     glPushCall((void *)packed_data); \
@@ -3474,7 +3475,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glFlush
 #define push_glFlush() { \
-    glFlush_PACKED *packed_data = malloc(sizeof(glFlush_PACKED)); \
+    glFlush_PACKED packed_data[1]; \
     packed_data->format = glFlush_FORMAT; \
     packed_data->func = glshim_glFlush; \
     glPushCall((void *)packed_data); \
@@ -3482,7 +3483,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glFogf
 #define push_glFogf(pname, param) { \
-    glFogf_PACKED *packed_data = malloc(sizeof(glFogf_PACKED)); \
+    glFogf_PACKED packed_data[1]; \
     packed_data->format = glFogf_FORMAT; \
     packed_data->func = glshim_glFogf; \
     packed_data->args.a1 = (GLenum)pname; \
@@ -3492,7 +3493,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glFogfv
 #define push_glFogfv(pname, params) { \
-    glFogfv_PACKED *packed_data = malloc(sizeof(glFogfv_PACKED)); \
+    glFogfv_PACKED packed_data[1]; \
     packed_data->format = glFogfv_FORMAT; \
     packed_data->func = glshim_glFogfv; \
     packed_data->args.a1 = (GLenum)pname; \
@@ -3502,7 +3503,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glFogx
 #define push_glFogx(pname, param) { \
-    glFogx_PACKED *packed_data = malloc(sizeof(glFogx_PACKED)); \
+    glFogx_PACKED packed_data[1]; \
     packed_data->format = glFogx_FORMAT; \
     packed_data->func = glshim_glFogx; \
     packed_data->args.a1 = (GLenum)pname; \
@@ -3512,7 +3513,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glFogxv
 #define push_glFogxv(pname, params) { \
-    glFogxv_PACKED *packed_data = malloc(sizeof(glFogxv_PACKED)); \
+    glFogxv_PACKED packed_data[1]; \
     packed_data->format = glFogxv_FORMAT; \
     packed_data->func = glshim_glFogxv; \
     packed_data->args.a1 = (GLenum)pname; \
@@ -3522,7 +3523,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glFramebufferRenderbuffer
 #define push_glFramebufferRenderbuffer(target, attachment, renderbuffertarget, renderbuffer) { \
-    glFramebufferRenderbuffer_PACKED *packed_data = malloc(sizeof(glFramebufferRenderbuffer_PACKED)); \
+    glFramebufferRenderbuffer_PACKED packed_data[1]; \
     packed_data->format = glFramebufferRenderbuffer_FORMAT; \
     packed_data->func = glshim_glFramebufferRenderbuffer; \
     packed_data->args.a1 = (GLenum)target; \
@@ -3534,7 +3535,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glFramebufferTexture2D
 #define push_glFramebufferTexture2D(target, attachment, textarget, texture, level) { \
-    glFramebufferTexture2D_PACKED *packed_data = malloc(sizeof(glFramebufferTexture2D_PACKED)); \
+    glFramebufferTexture2D_PACKED packed_data[1]; \
     packed_data->format = glFramebufferTexture2D_FORMAT; \
     packed_data->func = glshim_glFramebufferTexture2D; \
     packed_data->args.a1 = (GLenum)target; \
@@ -3547,7 +3548,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glFrontFace
 #define push_glFrontFace(mode) { \
-    glFrontFace_PACKED *packed_data = malloc(sizeof(glFrontFace_PACKED)); \
+    glFrontFace_PACKED packed_data[1]; \
     packed_data->format = glFrontFace_FORMAT; \
     packed_data->func = glshim_glFrontFace; \
     packed_data->args.a1 = (GLenum)mode; \
@@ -3556,7 +3557,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glFrustumf
 #define push_glFrustumf(left, right, bottom, top, near, far) { \
-    glFrustumf_PACKED *packed_data = malloc(sizeof(glFrustumf_PACKED)); \
+    glFrustumf_PACKED packed_data[1]; \
     packed_data->format = glFrustumf_FORMAT; \
     packed_data->func = glshim_glFrustumf; \
     packed_data->args.a1 = (GLfloat)left; \
@@ -3570,7 +3571,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glFrustumx
 #define push_glFrustumx(left, right, bottom, top, near, far) { \
-    glFrustumx_PACKED *packed_data = malloc(sizeof(glFrustumx_PACKED)); \
+    glFrustumx_PACKED packed_data[1]; \
     packed_data->format = glFrustumx_FORMAT; \
     packed_data->func = glshim_glFrustumx; \
     packed_data->args.a1 = (GLfixed)left; \
@@ -3584,7 +3585,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glGenBuffers
 #define push_glGenBuffers(n, buffers) { \
-    glGenBuffers_PACKED *packed_data = malloc(sizeof(glGenBuffers_PACKED)); \
+    glGenBuffers_PACKED packed_data[1]; \
     packed_data->format = glGenBuffers_FORMAT; \
     packed_data->func = glshim_glGenBuffers; \
     packed_data->args.a1 = (GLsizei)n; \
@@ -3594,7 +3595,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glGenFramebuffers
 #define push_glGenFramebuffers(n, ids) { \
-    glGenFramebuffers_PACKED *packed_data = malloc(sizeof(glGenFramebuffers_PACKED)); \
+    glGenFramebuffers_PACKED packed_data[1]; \
     packed_data->format = glGenFramebuffers_FORMAT; \
     packed_data->func = glshim_glGenFramebuffers; \
     packed_data->args.a1 = (GLsizei)n; \
@@ -3604,7 +3605,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glGenRenderbuffers
 #define push_glGenRenderbuffers(n, renderbuffers) { \
-    glGenRenderbuffers_PACKED *packed_data = malloc(sizeof(glGenRenderbuffers_PACKED)); \
+    glGenRenderbuffers_PACKED packed_data[1]; \
     packed_data->format = glGenRenderbuffers_FORMAT; \
     packed_data->func = glshim_glGenRenderbuffers; \
     packed_data->args.a1 = (GLsizei)n; \
@@ -3614,7 +3615,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glGenTextures
 #define push_glGenTextures(n, textures) { \
-    glGenTextures_PACKED *packed_data = malloc(sizeof(glGenTextures_PACKED)); \
+    glGenTextures_PACKED packed_data[1]; \
     packed_data->format = glGenTextures_FORMAT; \
     packed_data->func = glshim_glGenTextures; \
     packed_data->args.a1 = (GLsizei)n; \
@@ -3624,7 +3625,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glGenerateMipmap
 #define push_glGenerateMipmap(target) { \
-    glGenerateMipmap_PACKED *packed_data = malloc(sizeof(glGenerateMipmap_PACKED)); \
+    glGenerateMipmap_PACKED packed_data[1]; \
     packed_data->format = glGenerateMipmap_FORMAT; \
     packed_data->func = glshim_glGenerateMipmap; \
     packed_data->args.a1 = (GLenum)target; \
@@ -3633,7 +3634,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glGetBooleanv
 #define push_glGetBooleanv(pname, params) { \
-    glGetBooleanv_PACKED *packed_data = malloc(sizeof(glGetBooleanv_PACKED)); \
+    glGetBooleanv_PACKED packed_data[1]; \
     packed_data->format = glGetBooleanv_FORMAT; \
     packed_data->func = glshim_glGetBooleanv; \
     packed_data->args.a1 = (GLenum)pname; \
@@ -3643,7 +3644,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glGetBufferParameteriv
 #define push_glGetBufferParameteriv(target, pname, params) { \
-    glGetBufferParameteriv_PACKED *packed_data = malloc(sizeof(glGetBufferParameteriv_PACKED)); \
+    glGetBufferParameteriv_PACKED packed_data[1]; \
     packed_data->format = glGetBufferParameteriv_FORMAT; \
     packed_data->func = glshim_glGetBufferParameteriv; \
     packed_data->args.a1 = (GLenum)target; \
@@ -3654,7 +3655,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glGetClipPlanef
 #define push_glGetClipPlanef(plane, equation) { \
-    glGetClipPlanef_PACKED *packed_data = malloc(sizeof(glGetClipPlanef_PACKED)); \
+    glGetClipPlanef_PACKED packed_data[1]; \
     packed_data->format = glGetClipPlanef_FORMAT; \
     packed_data->func = glshim_glGetClipPlanef; \
     packed_data->args.a1 = (GLenum)plane; \
@@ -3664,7 +3665,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glGetClipPlanex
 #define push_glGetClipPlanex(plane, equation) { \
-    glGetClipPlanex_PACKED *packed_data = malloc(sizeof(glGetClipPlanex_PACKED)); \
+    glGetClipPlanex_PACKED packed_data[1]; \
     packed_data->format = glGetClipPlanex_FORMAT; \
     packed_data->func = glshim_glGetClipPlanex; \
     packed_data->args.a1 = (GLenum)plane; \
@@ -3674,7 +3675,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glGetError
 #define push_glGetError() { \
-    glGetError_PACKED *packed_data = malloc(sizeof(glGetError_PACKED)); \
+    glGetError_PACKED packed_data[1]; \
     packed_data->format = glGetError_FORMAT; \
     packed_data->func = glshim_glGetError; \
     glPushCall((void *)packed_data); \
@@ -3682,7 +3683,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glGetFixedv
 #define push_glGetFixedv(pname, params) { \
-    glGetFixedv_PACKED *packed_data = malloc(sizeof(glGetFixedv_PACKED)); \
+    glGetFixedv_PACKED packed_data[1]; \
     packed_data->format = glGetFixedv_FORMAT; \
     packed_data->func = glshim_glGetFixedv; \
     packed_data->args.a1 = (GLenum)pname; \
@@ -3692,7 +3693,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glGetFloatv
 #define push_glGetFloatv(pname, params) { \
-    glGetFloatv_PACKED *packed_data = malloc(sizeof(glGetFloatv_PACKED)); \
+    glGetFloatv_PACKED packed_data[1]; \
     packed_data->format = glGetFloatv_FORMAT; \
     packed_data->func = glshim_glGetFloatv; \
     packed_data->args.a1 = (GLenum)pname; \
@@ -3702,7 +3703,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glGetFramebufferAttachmentParameteriv
 #define push_glGetFramebufferAttachmentParameteriv(target, attachment, pname, params) { \
-    glGetFramebufferAttachmentParameteriv_PACKED *packed_data = malloc(sizeof(glGetFramebufferAttachmentParameteriv_PACKED)); \
+    glGetFramebufferAttachmentParameteriv_PACKED packed_data[1]; \
     packed_data->format = glGetFramebufferAttachmentParameteriv_FORMAT; \
     packed_data->func = glshim_glGetFramebufferAttachmentParameteriv; \
     packed_data->args.a1 = (GLenum)target; \
@@ -3714,7 +3715,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glGetIntegerv
 #define push_glGetIntegerv(pname, params) { \
-    glGetIntegerv_PACKED *packed_data = malloc(sizeof(glGetIntegerv_PACKED)); \
+    glGetIntegerv_PACKED packed_data[1]; \
     packed_data->format = glGetIntegerv_FORMAT; \
     packed_data->func = glshim_glGetIntegerv; \
     packed_data->args.a1 = (GLenum)pname; \
@@ -3724,7 +3725,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glGetLightfv
 #define push_glGetLightfv(light, pname, params) { \
-    glGetLightfv_PACKED *packed_data = malloc(sizeof(glGetLightfv_PACKED)); \
+    glGetLightfv_PACKED packed_data[1]; \
     packed_data->format = glGetLightfv_FORMAT; \
     packed_data->func = glshim_glGetLightfv; \
     packed_data->args.a1 = (GLenum)light; \
@@ -3735,7 +3736,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glGetLightxv
 #define push_glGetLightxv(light, pname, params) { \
-    glGetLightxv_PACKED *packed_data = malloc(sizeof(glGetLightxv_PACKED)); \
+    glGetLightxv_PACKED packed_data[1]; \
     packed_data->format = glGetLightxv_FORMAT; \
     packed_data->func = glshim_glGetLightxv; \
     packed_data->args.a1 = (GLenum)light; \
@@ -3746,7 +3747,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glGetMaterialfv
 #define push_glGetMaterialfv(face, pname, params) { \
-    glGetMaterialfv_PACKED *packed_data = malloc(sizeof(glGetMaterialfv_PACKED)); \
+    glGetMaterialfv_PACKED packed_data[1]; \
     packed_data->format = glGetMaterialfv_FORMAT; \
     packed_data->func = glshim_glGetMaterialfv; \
     packed_data->args.a1 = (GLenum)face; \
@@ -3757,7 +3758,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glGetMaterialxv
 #define push_glGetMaterialxv(face, pname, params) { \
-    glGetMaterialxv_PACKED *packed_data = malloc(sizeof(glGetMaterialxv_PACKED)); \
+    glGetMaterialxv_PACKED packed_data[1]; \
     packed_data->format = glGetMaterialxv_FORMAT; \
     packed_data->func = glshim_glGetMaterialxv; \
     packed_data->args.a1 = (GLenum)face; \
@@ -3768,7 +3769,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glGetPointerv
 #define push_glGetPointerv(pname, params) { \
-    glGetPointerv_PACKED *packed_data = malloc(sizeof(glGetPointerv_PACKED)); \
+    glGetPointerv_PACKED packed_data[1]; \
     packed_data->format = glGetPointerv_FORMAT; \
     packed_data->func = glshim_glGetPointerv; \
     packed_data->args.a1 = (GLenum)pname; \
@@ -3778,7 +3779,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glGetRenderbufferParameteriv
 #define push_glGetRenderbufferParameteriv(target, pname, params) { \
-    glGetRenderbufferParameteriv_PACKED *packed_data = malloc(sizeof(glGetRenderbufferParameteriv_PACKED)); \
+    glGetRenderbufferParameteriv_PACKED packed_data[1]; \
     packed_data->format = glGetRenderbufferParameteriv_FORMAT; \
     packed_data->func = glshim_glGetRenderbufferParameteriv; \
     packed_data->args.a1 = (GLenum)target; \
@@ -3789,7 +3790,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glGetString
 #define push_glGetString(name) { \
-    glGetString_PACKED *packed_data = malloc(sizeof(glGetString_PACKED)); \
+    glGetString_PACKED packed_data[1]; \
     packed_data->format = glGetString_FORMAT; \
     packed_data->func = glshim_glGetString; \
     packed_data->args.a1 = (GLenum)name; \
@@ -3798,7 +3799,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glGetTexEnvfv
 #define push_glGetTexEnvfv(target, pname, params) { \
-    glGetTexEnvfv_PACKED *packed_data = malloc(sizeof(glGetTexEnvfv_PACKED)); \
+    glGetTexEnvfv_PACKED packed_data[1]; \
     packed_data->format = glGetTexEnvfv_FORMAT; \
     packed_data->func = glshim_glGetTexEnvfv; \
     packed_data->args.a1 = (GLenum)target; \
@@ -3809,7 +3810,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glGetTexEnviv
 #define push_glGetTexEnviv(target, pname, params) { \
-    glGetTexEnviv_PACKED *packed_data = malloc(sizeof(glGetTexEnviv_PACKED)); \
+    glGetTexEnviv_PACKED packed_data[1]; \
     packed_data->format = glGetTexEnviv_FORMAT; \
     packed_data->func = glshim_glGetTexEnviv; \
     packed_data->args.a1 = (GLenum)target; \
@@ -3820,7 +3821,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glGetTexEnvxv
 #define push_glGetTexEnvxv(target, pname, params) { \
-    glGetTexEnvxv_PACKED *packed_data = malloc(sizeof(glGetTexEnvxv_PACKED)); \
+    glGetTexEnvxv_PACKED packed_data[1]; \
     packed_data->format = glGetTexEnvxv_FORMAT; \
     packed_data->func = glshim_glGetTexEnvxv; \
     packed_data->args.a1 = (GLenum)target; \
@@ -3831,7 +3832,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glGetTexParameterfv
 #define push_glGetTexParameterfv(target, pname, params) { \
-    glGetTexParameterfv_PACKED *packed_data = malloc(sizeof(glGetTexParameterfv_PACKED)); \
+    glGetTexParameterfv_PACKED packed_data[1]; \
     packed_data->format = glGetTexParameterfv_FORMAT; \
     packed_data->func = glshim_glGetTexParameterfv; \
     packed_data->args.a1 = (GLenum)target; \
@@ -3842,7 +3843,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glGetTexParameteriv
 #define push_glGetTexParameteriv(target, pname, params) { \
-    glGetTexParameteriv_PACKED *packed_data = malloc(sizeof(glGetTexParameteriv_PACKED)); \
+    glGetTexParameteriv_PACKED packed_data[1]; \
     packed_data->format = glGetTexParameteriv_FORMAT; \
     packed_data->func = glshim_glGetTexParameteriv; \
     packed_data->args.a1 = (GLenum)target; \
@@ -3853,7 +3854,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glGetTexParameterxv
 #define push_glGetTexParameterxv(target, pname, params) { \
-    glGetTexParameterxv_PACKED *packed_data = malloc(sizeof(glGetTexParameterxv_PACKED)); \
+    glGetTexParameterxv_PACKED packed_data[1]; \
     packed_data->format = glGetTexParameterxv_FORMAT; \
     packed_data->func = glshim_glGetTexParameterxv; \
     packed_data->args.a1 = (GLenum)target; \
@@ -3864,7 +3865,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glHint
 #define push_glHint(target, mode) { \
-    glHint_PACKED *packed_data = malloc(sizeof(glHint_PACKED)); \
+    glHint_PACKED packed_data[1]; \
     packed_data->format = glHint_FORMAT; \
     packed_data->func = glshim_glHint; \
     packed_data->args.a1 = (GLenum)target; \
@@ -3874,7 +3875,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glIsBuffer
 #define push_glIsBuffer(buffer) { \
-    glIsBuffer_PACKED *packed_data = malloc(sizeof(glIsBuffer_PACKED)); \
+    glIsBuffer_PACKED packed_data[1]; \
     packed_data->format = glIsBuffer_FORMAT; \
     packed_data->func = glshim_glIsBuffer; \
     packed_data->args.a1 = (GLuint)buffer; \
@@ -3883,7 +3884,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glIsEnabled
 #define push_glIsEnabled(cap) { \
-    glIsEnabled_PACKED *packed_data = malloc(sizeof(glIsEnabled_PACKED)); \
+    glIsEnabled_PACKED packed_data[1]; \
     packed_data->format = glIsEnabled_FORMAT; \
     packed_data->func = glshim_glIsEnabled; \
     packed_data->args.a1 = (GLenum)cap; \
@@ -3892,7 +3893,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glIsFramebuffer
 #define push_glIsFramebuffer(framebuffer) { \
-    glIsFramebuffer_PACKED *packed_data = malloc(sizeof(glIsFramebuffer_PACKED)); \
+    glIsFramebuffer_PACKED packed_data[1]; \
     packed_data->format = glIsFramebuffer_FORMAT; \
     packed_data->func = glshim_glIsFramebuffer; \
     packed_data->args.a1 = (GLuint)framebuffer; \
@@ -3901,7 +3902,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glIsRenderbuffer
 #define push_glIsRenderbuffer(renderbuffer) { \
-    glIsRenderbuffer_PACKED *packed_data = malloc(sizeof(glIsRenderbuffer_PACKED)); \
+    glIsRenderbuffer_PACKED packed_data[1]; \
     packed_data->format = glIsRenderbuffer_FORMAT; \
     packed_data->func = glshim_glIsRenderbuffer; \
     packed_data->args.a1 = (GLuint)renderbuffer; \
@@ -3910,7 +3911,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glIsTexture
 #define push_glIsTexture(texture) { \
-    glIsTexture_PACKED *packed_data = malloc(sizeof(glIsTexture_PACKED)); \
+    glIsTexture_PACKED packed_data[1]; \
     packed_data->format = glIsTexture_FORMAT; \
     packed_data->func = glshim_glIsTexture; \
     packed_data->args.a1 = (GLuint)texture; \
@@ -3919,7 +3920,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glLightModelf
 #define push_glLightModelf(pname, param) { \
-    glLightModelf_PACKED *packed_data = malloc(sizeof(glLightModelf_PACKED)); \
+    glLightModelf_PACKED packed_data[1]; \
     packed_data->format = glLightModelf_FORMAT; \
     packed_data->func = glshim_glLightModelf; \
     packed_data->args.a1 = (GLenum)pname; \
@@ -3929,7 +3930,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glLightModelfv
 #define push_glLightModelfv(pname, params) { \
-    glLightModelfv_PACKED *packed_data = malloc(sizeof(glLightModelfv_PACKED)); \
+    glLightModelfv_PACKED packed_data[1]; \
     packed_data->format = glLightModelfv_FORMAT; \
     packed_data->func = glshim_glLightModelfv; \
     packed_data->args.a1 = (GLenum)pname; \
@@ -3939,7 +3940,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glLightModelx
 #define push_glLightModelx(pname, param) { \
-    glLightModelx_PACKED *packed_data = malloc(sizeof(glLightModelx_PACKED)); \
+    glLightModelx_PACKED packed_data[1]; \
     packed_data->format = glLightModelx_FORMAT; \
     packed_data->func = glshim_glLightModelx; \
     packed_data->args.a1 = (GLenum)pname; \
@@ -3949,7 +3950,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glLightModelxv
 #define push_glLightModelxv(pname, params) { \
-    glLightModelxv_PACKED *packed_data = malloc(sizeof(glLightModelxv_PACKED)); \
+    glLightModelxv_PACKED packed_data[1]; \
     packed_data->format = glLightModelxv_FORMAT; \
     packed_data->func = glshim_glLightModelxv; \
     packed_data->args.a1 = (GLenum)pname; \
@@ -3959,7 +3960,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glLightf
 #define push_glLightf(light, pname, param) { \
-    glLightf_PACKED *packed_data = malloc(sizeof(glLightf_PACKED)); \
+    glLightf_PACKED packed_data[1]; \
     packed_data->format = glLightf_FORMAT; \
     packed_data->func = glshim_glLightf; \
     packed_data->args.a1 = (GLenum)light; \
@@ -3970,7 +3971,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glLightfv
 #define push_glLightfv(light, pname, params) { \
-    glLightfv_PACKED *packed_data = malloc(sizeof(glLightfv_PACKED)); \
+    glLightfv_PACKED packed_data[1]; \
     packed_data->format = glLightfv_FORMAT; \
     packed_data->func = glshim_glLightfv; \
     packed_data->args.a1 = (GLenum)light; \
@@ -3981,7 +3982,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glLightx
 #define push_glLightx(light, pname, param) { \
-    glLightx_PACKED *packed_data = malloc(sizeof(glLightx_PACKED)); \
+    glLightx_PACKED packed_data[1]; \
     packed_data->format = glLightx_FORMAT; \
     packed_data->func = glshim_glLightx; \
     packed_data->args.a1 = (GLenum)light; \
@@ -3992,7 +3993,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glLightxv
 #define push_glLightxv(light, pname, params) { \
-    glLightxv_PACKED *packed_data = malloc(sizeof(glLightxv_PACKED)); \
+    glLightxv_PACKED packed_data[1]; \
     packed_data->format = glLightxv_FORMAT; \
     packed_data->func = glshim_glLightxv; \
     packed_data->args.a1 = (GLenum)light; \
@@ -4003,7 +4004,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glLineWidth
 #define push_glLineWidth(width) { \
-    glLineWidth_PACKED *packed_data = malloc(sizeof(glLineWidth_PACKED)); \
+    glLineWidth_PACKED packed_data[1]; \
     packed_data->format = glLineWidth_FORMAT; \
     packed_data->func = glshim_glLineWidth; \
     packed_data->args.a1 = (GLfloat)width; \
@@ -4012,7 +4013,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glLineWidthx
 #define push_glLineWidthx(width) { \
-    glLineWidthx_PACKED *packed_data = malloc(sizeof(glLineWidthx_PACKED)); \
+    glLineWidthx_PACKED packed_data[1]; \
     packed_data->format = glLineWidthx_FORMAT; \
     packed_data->func = glshim_glLineWidthx; \
     packed_data->args.a1 = (GLfixed)width; \
@@ -4021,7 +4022,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glLoadIdentity
 #define push_glLoadIdentity() { \
-    glLoadIdentity_PACKED *packed_data = malloc(sizeof(glLoadIdentity_PACKED)); \
+    glLoadIdentity_PACKED packed_data[1]; \
     packed_data->format = glLoadIdentity_FORMAT; \
     packed_data->func = glshim_glLoadIdentity; \
     glPushCall((void *)packed_data); \
@@ -4029,7 +4030,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glLoadMatrixf
 #define push_glLoadMatrixf(m) { \
-    glLoadMatrixf_PACKED *packed_data = malloc(sizeof(glLoadMatrixf_PACKED)); \
+    glLoadMatrixf_PACKED packed_data[1]; \
     packed_data->format = glLoadMatrixf_FORMAT; \
     packed_data->func = glshim_glLoadMatrixf; \
     packed_data->args.a1 = (GLfloat *)m; \
@@ -4038,7 +4039,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glLoadMatrixx
 #define push_glLoadMatrixx(m) { \
-    glLoadMatrixx_PACKED *packed_data = malloc(sizeof(glLoadMatrixx_PACKED)); \
+    glLoadMatrixx_PACKED packed_data[1]; \
     packed_data->format = glLoadMatrixx_FORMAT; \
     packed_data->func = glshim_glLoadMatrixx; \
     packed_data->args.a1 = (GLfixed *)m; \
@@ -4047,7 +4048,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glLogicOp
 #define push_glLogicOp(opcode) { \
-    glLogicOp_PACKED *packed_data = malloc(sizeof(glLogicOp_PACKED)); \
+    glLogicOp_PACKED packed_data[1]; \
     packed_data->format = glLogicOp_FORMAT; \
     packed_data->func = glshim_glLogicOp; \
     packed_data->args.a1 = (GLenum)opcode; \
@@ -4056,7 +4057,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glMaterialf
 #define push_glMaterialf(face, pname, param) { \
-    glMaterialf_PACKED *packed_data = malloc(sizeof(glMaterialf_PACKED)); \
+    glMaterialf_PACKED packed_data[1]; \
     packed_data->format = glMaterialf_FORMAT; \
     packed_data->func = glshim_glMaterialf; \
     packed_data->args.a1 = (GLenum)face; \
@@ -4067,7 +4068,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glMaterialfv
 #define push_glMaterialfv(face, pname, params) { \
-    glMaterialfv_PACKED *packed_data = malloc(sizeof(glMaterialfv_PACKED)); \
+    glMaterialfv_PACKED packed_data[1]; \
     packed_data->format = glMaterialfv_FORMAT; \
     packed_data->func = glshim_glMaterialfv; \
     packed_data->args.a1 = (GLenum)face; \
@@ -4078,7 +4079,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glMaterialx
 #define push_glMaterialx(face, pname, param) { \
-    glMaterialx_PACKED *packed_data = malloc(sizeof(glMaterialx_PACKED)); \
+    glMaterialx_PACKED packed_data[1]; \
     packed_data->format = glMaterialx_FORMAT; \
     packed_data->func = glshim_glMaterialx; \
     packed_data->args.a1 = (GLenum)face; \
@@ -4089,7 +4090,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glMaterialxv
 #define push_glMaterialxv(face, pname, params) { \
-    glMaterialxv_PACKED *packed_data = malloc(sizeof(glMaterialxv_PACKED)); \
+    glMaterialxv_PACKED packed_data[1]; \
     packed_data->format = glMaterialxv_FORMAT; \
     packed_data->func = glshim_glMaterialxv; \
     packed_data->args.a1 = (GLenum)face; \
@@ -4100,7 +4101,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glMatrixMode
 #define push_glMatrixMode(mode) { \
-    glMatrixMode_PACKED *packed_data = malloc(sizeof(glMatrixMode_PACKED)); \
+    glMatrixMode_PACKED packed_data[1]; \
     packed_data->format = glMatrixMode_FORMAT; \
     packed_data->func = glshim_glMatrixMode; \
     packed_data->args.a1 = (GLenum)mode; \
@@ -4109,7 +4110,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glMultMatrixf
 #define push_glMultMatrixf(m) { \
-    glMultMatrixf_PACKED *packed_data = malloc(sizeof(glMultMatrixf_PACKED)); \
+    glMultMatrixf_PACKED packed_data[1]; \
     packed_data->format = glMultMatrixf_FORMAT; \
     packed_data->func = glshim_glMultMatrixf; \
     packed_data->args.a1 = (GLfloat *)m; \
@@ -4118,7 +4119,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glMultMatrixx
 #define push_glMultMatrixx(m) { \
-    glMultMatrixx_PACKED *packed_data = malloc(sizeof(glMultMatrixx_PACKED)); \
+    glMultMatrixx_PACKED packed_data[1]; \
     packed_data->format = glMultMatrixx_FORMAT; \
     packed_data->func = glshim_glMultMatrixx; \
     packed_data->args.a1 = (GLfixed *)m; \
@@ -4127,7 +4128,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glMultiDrawArrays
 #define push_glMultiDrawArrays(mode, first, count, primcount) { \
-    glMultiDrawArrays_PACKED *packed_data = malloc(sizeof(glMultiDrawArrays_PACKED)); \
+    glMultiDrawArrays_PACKED packed_data[1]; \
     packed_data->format = glMultiDrawArrays_FORMAT; \
     packed_data->func = glshim_glMultiDrawArrays; \
     packed_data->args.a1 = (GLenum)mode; \
@@ -4139,7 +4140,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glMultiDrawElements
 #define push_glMultiDrawElements(mode, count, type, indices, primcount) { \
-    glMultiDrawElements_PACKED *packed_data = malloc(sizeof(glMultiDrawElements_PACKED)); \
+    glMultiDrawElements_PACKED packed_data[1]; \
     packed_data->format = glMultiDrawElements_FORMAT; \
     packed_data->func = glshim_glMultiDrawElements; \
     packed_data->args.a1 = (GLenum)mode; \
@@ -4152,7 +4153,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glMultiTexCoord4f
 #define push_glMultiTexCoord4f(target, s, t, r, q) { \
-    glMultiTexCoord4f_PACKED *packed_data = malloc(sizeof(glMultiTexCoord4f_PACKED)); \
+    glMultiTexCoord4f_PACKED packed_data[1]; \
     packed_data->format = glMultiTexCoord4f_FORMAT; \
     packed_data->func = glshim_glMultiTexCoord4f; \
     packed_data->args.a1 = (GLenum)target; \
@@ -4165,7 +4166,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glMultiTexCoord4x
 #define push_glMultiTexCoord4x(target, s, t, r, q) { \
-    glMultiTexCoord4x_PACKED *packed_data = malloc(sizeof(glMultiTexCoord4x_PACKED)); \
+    glMultiTexCoord4x_PACKED packed_data[1]; \
     packed_data->format = glMultiTexCoord4x_FORMAT; \
     packed_data->func = glshim_glMultiTexCoord4x; \
     packed_data->args.a1 = (GLenum)target; \
@@ -4178,7 +4179,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glNormal3f
 #define push_glNormal3f(nx, ny, nz) { \
-    glNormal3f_PACKED *packed_data = malloc(sizeof(glNormal3f_PACKED)); \
+    glNormal3f_PACKED packed_data[1]; \
     packed_data->format = glNormal3f_FORMAT; \
     packed_data->func = glshim_glNormal3f; \
     packed_data->args.a1 = (GLfloat)nx; \
@@ -4189,7 +4190,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glNormal3x
 #define push_glNormal3x(nx, ny, nz) { \
-    glNormal3x_PACKED *packed_data = malloc(sizeof(glNormal3x_PACKED)); \
+    glNormal3x_PACKED packed_data[1]; \
     packed_data->format = glNormal3x_FORMAT; \
     packed_data->func = glshim_glNormal3x; \
     packed_data->args.a1 = (GLfixed)nx; \
@@ -4200,7 +4201,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glNormalPointer
 #define push_glNormalPointer(type, stride, pointer) { \
-    glNormalPointer_PACKED *packed_data = malloc(sizeof(glNormalPointer_PACKED)); \
+    glNormalPointer_PACKED packed_data[1]; \
     packed_data->format = glNormalPointer_FORMAT; \
     packed_data->func = glshim_glNormalPointer; \
     packed_data->args.a1 = (GLenum)type; \
@@ -4211,7 +4212,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glOrthof
 #define push_glOrthof(left, right, bottom, top, near, far) { \
-    glOrthof_PACKED *packed_data = malloc(sizeof(glOrthof_PACKED)); \
+    glOrthof_PACKED packed_data[1]; \
     packed_data->format = glOrthof_FORMAT; \
     packed_data->func = glshim_glOrthof; \
     packed_data->args.a1 = (GLfloat)left; \
@@ -4225,7 +4226,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glOrthox
 #define push_glOrthox(left, right, bottom, top, near, far) { \
-    glOrthox_PACKED *packed_data = malloc(sizeof(glOrthox_PACKED)); \
+    glOrthox_PACKED packed_data[1]; \
     packed_data->format = glOrthox_FORMAT; \
     packed_data->func = glshim_glOrthox; \
     packed_data->args.a1 = (GLfixed)left; \
@@ -4239,7 +4240,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glPixelStorei
 #define push_glPixelStorei(pname, param) { \
-    glPixelStorei_PACKED *packed_data = malloc(sizeof(glPixelStorei_PACKED)); \
+    glPixelStorei_PACKED packed_data[1]; \
     packed_data->format = glPixelStorei_FORMAT; \
     packed_data->func = glshim_glPixelStorei; \
     packed_data->args.a1 = (GLenum)pname; \
@@ -4249,7 +4250,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glPointParameterf
 #define push_glPointParameterf(pname, param) { \
-    glPointParameterf_PACKED *packed_data = malloc(sizeof(glPointParameterf_PACKED)); \
+    glPointParameterf_PACKED packed_data[1]; \
     packed_data->format = glPointParameterf_FORMAT; \
     packed_data->func = glshim_glPointParameterf; \
     packed_data->args.a1 = (GLenum)pname; \
@@ -4259,7 +4260,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glPointParameterfv
 #define push_glPointParameterfv(pname, params) { \
-    glPointParameterfv_PACKED *packed_data = malloc(sizeof(glPointParameterfv_PACKED)); \
+    glPointParameterfv_PACKED packed_data[1]; \
     packed_data->format = glPointParameterfv_FORMAT; \
     packed_data->func = glshim_glPointParameterfv; \
     packed_data->args.a1 = (GLenum)pname; \
@@ -4269,7 +4270,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glPointParameterx
 #define push_glPointParameterx(pname, param) { \
-    glPointParameterx_PACKED *packed_data = malloc(sizeof(glPointParameterx_PACKED)); \
+    glPointParameterx_PACKED packed_data[1]; \
     packed_data->format = glPointParameterx_FORMAT; \
     packed_data->func = glshim_glPointParameterx; \
     packed_data->args.a1 = (GLenum)pname; \
@@ -4279,7 +4280,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glPointParameterxv
 #define push_glPointParameterxv(pname, params) { \
-    glPointParameterxv_PACKED *packed_data = malloc(sizeof(glPointParameterxv_PACKED)); \
+    glPointParameterxv_PACKED packed_data[1]; \
     packed_data->format = glPointParameterxv_FORMAT; \
     packed_data->func = glshim_glPointParameterxv; \
     packed_data->args.a1 = (GLenum)pname; \
@@ -4289,7 +4290,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glPointSize
 #define push_glPointSize(size) { \
-    glPointSize_PACKED *packed_data = malloc(sizeof(glPointSize_PACKED)); \
+    glPointSize_PACKED packed_data[1]; \
     packed_data->format = glPointSize_FORMAT; \
     packed_data->func = glshim_glPointSize; \
     packed_data->args.a1 = (GLfloat)size; \
@@ -4298,7 +4299,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glPointSizePointerOES
 #define push_glPointSizePointerOES(type, stride, pointer) { \
-    glPointSizePointerOES_PACKED *packed_data = malloc(sizeof(glPointSizePointerOES_PACKED)); \
+    glPointSizePointerOES_PACKED packed_data[1]; \
     packed_data->format = glPointSizePointerOES_FORMAT; \
     packed_data->func = glshim_glPointSizePointerOES; \
     packed_data->args.a1 = (GLenum)type; \
@@ -4309,7 +4310,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glPointSizex
 #define push_glPointSizex(size) { \
-    glPointSizex_PACKED *packed_data = malloc(sizeof(glPointSizex_PACKED)); \
+    glPointSizex_PACKED packed_data[1]; \
     packed_data->format = glPointSizex_FORMAT; \
     packed_data->func = glshim_glPointSizex; \
     packed_data->args.a1 = (GLfixed)size; \
@@ -4318,7 +4319,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glPolygonOffset
 #define push_glPolygonOffset(factor, units) { \
-    glPolygonOffset_PACKED *packed_data = malloc(sizeof(glPolygonOffset_PACKED)); \
+    glPolygonOffset_PACKED packed_data[1]; \
     packed_data->format = glPolygonOffset_FORMAT; \
     packed_data->func = glshim_glPolygonOffset; \
     packed_data->args.a1 = (GLfloat)factor; \
@@ -4328,7 +4329,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glPolygonOffsetx
 #define push_glPolygonOffsetx(factor, units) { \
-    glPolygonOffsetx_PACKED *packed_data = malloc(sizeof(glPolygonOffsetx_PACKED)); \
+    glPolygonOffsetx_PACKED packed_data[1]; \
     packed_data->format = glPolygonOffsetx_FORMAT; \
     packed_data->func = glshim_glPolygonOffsetx; \
     packed_data->args.a1 = (GLfixed)factor; \
@@ -4338,7 +4339,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glPopMatrix
 #define push_glPopMatrix() { \
-    glPopMatrix_PACKED *packed_data = malloc(sizeof(glPopMatrix_PACKED)); \
+    glPopMatrix_PACKED packed_data[1]; \
     packed_data->format = glPopMatrix_FORMAT; \
     packed_data->func = glshim_glPopMatrix; \
     glPushCall((void *)packed_data); \
@@ -4346,7 +4347,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glPushMatrix
 #define push_glPushMatrix() { \
-    glPushMatrix_PACKED *packed_data = malloc(sizeof(glPushMatrix_PACKED)); \
+    glPushMatrix_PACKED packed_data[1]; \
     packed_data->format = glPushMatrix_FORMAT; \
     packed_data->func = glshim_glPushMatrix; \
     glPushCall((void *)packed_data); \
@@ -4354,7 +4355,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glReadPixels
 #define push_glReadPixels(x, y, width, height, format, type, pixels) { \
-    glReadPixels_PACKED *packed_data = malloc(sizeof(glReadPixels_PACKED)); \
+    glReadPixels_PACKED packed_data[1]; \
     packed_data->format = glReadPixels_FORMAT; \
     packed_data->func = glshim_glReadPixels; \
     packed_data->args.a1 = (GLint)x; \
@@ -4369,7 +4370,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glRenderbufferStorage
 #define push_glRenderbufferStorage(target, internalformat, width, height) { \
-    glRenderbufferStorage_PACKED *packed_data = malloc(sizeof(glRenderbufferStorage_PACKED)); \
+    glRenderbufferStorage_PACKED packed_data[1]; \
     packed_data->format = glRenderbufferStorage_FORMAT; \
     packed_data->func = glshim_glRenderbufferStorage; \
     packed_data->args.a1 = (GLenum)target; \
@@ -4381,7 +4382,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glRotatef
 #define push_glRotatef(angle, x, y, z) { \
-    glRotatef_PACKED *packed_data = malloc(sizeof(glRotatef_PACKED)); \
+    glRotatef_PACKED packed_data[1]; \
     packed_data->format = glRotatef_FORMAT; \
     packed_data->func = glshim_glRotatef; \
     packed_data->args.a1 = (GLfloat)angle; \
@@ -4393,7 +4394,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glRotatex
 #define push_glRotatex(angle, x, y, z) { \
-    glRotatex_PACKED *packed_data = malloc(sizeof(glRotatex_PACKED)); \
+    glRotatex_PACKED packed_data[1]; \
     packed_data->format = glRotatex_FORMAT; \
     packed_data->func = glshim_glRotatex; \
     packed_data->args.a1 = (GLfixed)angle; \
@@ -4405,7 +4406,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glSampleCoverage
 #define push_glSampleCoverage(value, invert) { \
-    glSampleCoverage_PACKED *packed_data = malloc(sizeof(glSampleCoverage_PACKED)); \
+    glSampleCoverage_PACKED packed_data[1]; \
     packed_data->format = glSampleCoverage_FORMAT; \
     packed_data->func = glshim_glSampleCoverage; \
     packed_data->args.a1 = (GLclampf)value; \
@@ -4415,7 +4416,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glSampleCoveragex
 #define push_glSampleCoveragex(value, invert) { \
-    glSampleCoveragex_PACKED *packed_data = malloc(sizeof(glSampleCoveragex_PACKED)); \
+    glSampleCoveragex_PACKED packed_data[1]; \
     packed_data->format = glSampleCoveragex_FORMAT; \
     packed_data->func = glshim_glSampleCoveragex; \
     packed_data->args.a1 = (GLclampx)value; \
@@ -4425,7 +4426,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glScalef
 #define push_glScalef(x, y, z) { \
-    glScalef_PACKED *packed_data = malloc(sizeof(glScalef_PACKED)); \
+    glScalef_PACKED packed_data[1]; \
     packed_data->format = glScalef_FORMAT; \
     packed_data->func = glshim_glScalef; \
     packed_data->args.a1 = (GLfloat)x; \
@@ -4436,7 +4437,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glScalex
 #define push_glScalex(x, y, z) { \
-    glScalex_PACKED *packed_data = malloc(sizeof(glScalex_PACKED)); \
+    glScalex_PACKED packed_data[1]; \
     packed_data->format = glScalex_FORMAT; \
     packed_data->func = glshim_glScalex; \
     packed_data->args.a1 = (GLfixed)x; \
@@ -4447,7 +4448,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glScissor
 #define push_glScissor(x, y, width, height) { \
-    glScissor_PACKED *packed_data = malloc(sizeof(glScissor_PACKED)); \
+    glScissor_PACKED packed_data[1]; \
     packed_data->format = glScissor_FORMAT; \
     packed_data->func = glshim_glScissor; \
     packed_data->args.a1 = (GLint)x; \
@@ -4459,7 +4460,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glShadeModel
 #define push_glShadeModel(mode) { \
-    glShadeModel_PACKED *packed_data = malloc(sizeof(glShadeModel_PACKED)); \
+    glShadeModel_PACKED packed_data[1]; \
     packed_data->format = glShadeModel_FORMAT; \
     packed_data->func = glshim_glShadeModel; \
     packed_data->args.a1 = (GLenum)mode; \
@@ -4468,7 +4469,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glStencilFunc
 #define push_glStencilFunc(func, ref, mask) { \
-    glStencilFunc_PACKED *packed_data = malloc(sizeof(glStencilFunc_PACKED)); \
+    glStencilFunc_PACKED packed_data[1]; \
     packed_data->format = glStencilFunc_FORMAT; \
     packed_data->func = glshim_glStencilFunc; \
     packed_data->args.a1 = (GLenum)func; \
@@ -4479,7 +4480,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glStencilMask
 #define push_glStencilMask(mask) { \
-    glStencilMask_PACKED *packed_data = malloc(sizeof(glStencilMask_PACKED)); \
+    glStencilMask_PACKED packed_data[1]; \
     packed_data->format = glStencilMask_FORMAT; \
     packed_data->func = glshim_glStencilMask; \
     packed_data->args.a1 = (GLuint)mask; \
@@ -4488,7 +4489,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glStencilOp
 #define push_glStencilOp(fail, zfail, zpass) { \
-    glStencilOp_PACKED *packed_data = malloc(sizeof(glStencilOp_PACKED)); \
+    glStencilOp_PACKED packed_data[1]; \
     packed_data->format = glStencilOp_FORMAT; \
     packed_data->func = glshim_glStencilOp; \
     packed_data->args.a1 = (GLenum)fail; \
@@ -4499,7 +4500,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glTexCoordPointer
 #define push_glTexCoordPointer(size, type, stride, pointer) { \
-    glTexCoordPointer_PACKED *packed_data = malloc(sizeof(glTexCoordPointer_PACKED)); \
+    glTexCoordPointer_PACKED packed_data[1]; \
     packed_data->format = glTexCoordPointer_FORMAT; \
     packed_data->func = glshim_glTexCoordPointer; \
     packed_data->args.a1 = (GLint)size; \
@@ -4511,7 +4512,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glTexEnvf
 #define push_glTexEnvf(target, pname, param) { \
-    glTexEnvf_PACKED *packed_data = malloc(sizeof(glTexEnvf_PACKED)); \
+    glTexEnvf_PACKED packed_data[1]; \
     packed_data->format = glTexEnvf_FORMAT; \
     packed_data->func = glshim_glTexEnvf; \
     packed_data->args.a1 = (GLenum)target; \
@@ -4522,7 +4523,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glTexEnvfv
 #define push_glTexEnvfv(target, pname, params) { \
-    glTexEnvfv_PACKED *packed_data = malloc(sizeof(glTexEnvfv_PACKED)); \
+    glTexEnvfv_PACKED packed_data[1]; \
     packed_data->format = glTexEnvfv_FORMAT; \
     packed_data->func = glshim_glTexEnvfv; \
     packed_data->args.a1 = (GLenum)target; \
@@ -4533,7 +4534,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glTexEnvi
 #define push_glTexEnvi(target, pname, param) { \
-    glTexEnvi_PACKED *packed_data = malloc(sizeof(glTexEnvi_PACKED)); \
+    glTexEnvi_PACKED packed_data[1]; \
     packed_data->format = glTexEnvi_FORMAT; \
     packed_data->func = glshim_glTexEnvi; \
     packed_data->args.a1 = (GLenum)target; \
@@ -4544,7 +4545,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glTexEnviv
 #define push_glTexEnviv(target, pname, params) { \
-    glTexEnviv_PACKED *packed_data = malloc(sizeof(glTexEnviv_PACKED)); \
+    glTexEnviv_PACKED packed_data[1]; \
     packed_data->format = glTexEnviv_FORMAT; \
     packed_data->func = glshim_glTexEnviv; \
     packed_data->args.a1 = (GLenum)target; \
@@ -4555,7 +4556,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glTexEnvx
 #define push_glTexEnvx(target, pname, param) { \
-    glTexEnvx_PACKED *packed_data = malloc(sizeof(glTexEnvx_PACKED)); \
+    glTexEnvx_PACKED packed_data[1]; \
     packed_data->format = glTexEnvx_FORMAT; \
     packed_data->func = glshim_glTexEnvx; \
     packed_data->args.a1 = (GLenum)target; \
@@ -4566,7 +4567,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glTexEnvxv
 #define push_glTexEnvxv(target, pname, params) { \
-    glTexEnvxv_PACKED *packed_data = malloc(sizeof(glTexEnvxv_PACKED)); \
+    glTexEnvxv_PACKED packed_data[1]; \
     packed_data->format = glTexEnvxv_FORMAT; \
     packed_data->func = glshim_glTexEnvxv; \
     packed_data->args.a1 = (GLenum)target; \
@@ -4577,7 +4578,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glTexGenfv
 #define push_glTexGenfv(coord, pname, params) { \
-    glTexGenfv_PACKED *packed_data = malloc(sizeof(glTexGenfv_PACKED)); \
+    glTexGenfv_PACKED packed_data[1]; \
     packed_data->format = glTexGenfv_FORMAT; \
     packed_data->func = glshim_glTexGenfv; \
     packed_data->args.a1 = (GLenum)coord; \
@@ -4588,7 +4589,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glTexGeni
 #define push_glTexGeni(coord, pname, param) { \
-    glTexGeni_PACKED *packed_data = malloc(sizeof(glTexGeni_PACKED)); \
+    glTexGeni_PACKED packed_data[1]; \
     packed_data->format = glTexGeni_FORMAT; \
     packed_data->func = glshim_glTexGeni; \
     packed_data->args.a1 = (GLenum)coord; \
@@ -4599,7 +4600,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glTexImage2D
 #define push_glTexImage2D(target, level, internalformat, width, height, border, format, type, pixels) { \
-    glTexImage2D_PACKED *packed_data = malloc(sizeof(glTexImage2D_PACKED)); \
+    glTexImage2D_PACKED packed_data[1]; \
     packed_data->format = glTexImage2D_FORMAT; \
     packed_data->func = glshim_glTexImage2D; \
     packed_data->args.a1 = (GLenum)target; \
@@ -4616,7 +4617,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glTexParameterf
 #define push_glTexParameterf(target, pname, param) { \
-    glTexParameterf_PACKED *packed_data = malloc(sizeof(glTexParameterf_PACKED)); \
+    glTexParameterf_PACKED packed_data[1]; \
     packed_data->format = glTexParameterf_FORMAT; \
     packed_data->func = glshim_glTexParameterf; \
     packed_data->args.a1 = (GLenum)target; \
@@ -4627,7 +4628,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glTexParameterfv
 #define push_glTexParameterfv(target, pname, params) { \
-    glTexParameterfv_PACKED *packed_data = malloc(sizeof(glTexParameterfv_PACKED)); \
+    glTexParameterfv_PACKED packed_data[1]; \
     packed_data->format = glTexParameterfv_FORMAT; \
     packed_data->func = glshim_glTexParameterfv; \
     packed_data->args.a1 = (GLenum)target; \
@@ -4638,7 +4639,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glTexParameteri
 #define push_glTexParameteri(target, pname, param) { \
-    glTexParameteri_PACKED *packed_data = malloc(sizeof(glTexParameteri_PACKED)); \
+    glTexParameteri_PACKED packed_data[1]; \
     packed_data->format = glTexParameteri_FORMAT; \
     packed_data->func = glshim_glTexParameteri; \
     packed_data->args.a1 = (GLenum)target; \
@@ -4649,7 +4650,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glTexParameteriv
 #define push_glTexParameteriv(target, pname, params) { \
-    glTexParameteriv_PACKED *packed_data = malloc(sizeof(glTexParameteriv_PACKED)); \
+    glTexParameteriv_PACKED packed_data[1]; \
     packed_data->format = glTexParameteriv_FORMAT; \
     packed_data->func = glshim_glTexParameteriv; \
     packed_data->args.a1 = (GLenum)target; \
@@ -4660,7 +4661,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glTexParameterx
 #define push_glTexParameterx(target, pname, param) { \
-    glTexParameterx_PACKED *packed_data = malloc(sizeof(glTexParameterx_PACKED)); \
+    glTexParameterx_PACKED packed_data[1]; \
     packed_data->format = glTexParameterx_FORMAT; \
     packed_data->func = glshim_glTexParameterx; \
     packed_data->args.a1 = (GLenum)target; \
@@ -4671,7 +4672,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glTexParameterxv
 #define push_glTexParameterxv(target, pname, params) { \
-    glTexParameterxv_PACKED *packed_data = malloc(sizeof(glTexParameterxv_PACKED)); \
+    glTexParameterxv_PACKED packed_data[1]; \
     packed_data->format = glTexParameterxv_FORMAT; \
     packed_data->func = glshim_glTexParameterxv; \
     packed_data->args.a1 = (GLenum)target; \
@@ -4682,7 +4683,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glTexSubImage2D
 #define push_glTexSubImage2D(target, level, xoffset, yoffset, width, height, format, type, pixels) { \
-    glTexSubImage2D_PACKED *packed_data = malloc(sizeof(glTexSubImage2D_PACKED)); \
+    glTexSubImage2D_PACKED packed_data[1]; \
     packed_data->format = glTexSubImage2D_FORMAT; \
     packed_data->func = glshim_glTexSubImage2D; \
     packed_data->args.a1 = (GLenum)target; \
@@ -4699,7 +4700,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glTranslatef
 #define push_glTranslatef(x, y, z) { \
-    glTranslatef_PACKED *packed_data = malloc(sizeof(glTranslatef_PACKED)); \
+    glTranslatef_PACKED packed_data[1]; \
     packed_data->format = glTranslatef_FORMAT; \
     packed_data->func = glshim_glTranslatef; \
     packed_data->args.a1 = (GLfloat)x; \
@@ -4710,7 +4711,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glTranslatex
 #define push_glTranslatex(x, y, z) { \
-    glTranslatex_PACKED *packed_data = malloc(sizeof(glTranslatex_PACKED)); \
+    glTranslatex_PACKED packed_data[1]; \
     packed_data->format = glTranslatex_FORMAT; \
     packed_data->func = glshim_glTranslatex; \
     packed_data->args.a1 = (GLfixed)x; \
@@ -4721,7 +4722,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glVertexPointer
 #define push_glVertexPointer(size, type, stride, pointer) { \
-    glVertexPointer_PACKED *packed_data = malloc(sizeof(glVertexPointer_PACKED)); \
+    glVertexPointer_PACKED packed_data[1]; \
     packed_data->format = glVertexPointer_FORMAT; \
     packed_data->func = glshim_glVertexPointer; \
     packed_data->args.a1 = (GLint)size; \
@@ -4733,7 +4734,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glViewport
 #define push_glViewport(x, y, width, height) { \
-    glViewport_PACKED *packed_data = malloc(sizeof(glViewport_PACKED)); \
+    glViewport_PACKED packed_data[1]; \
     packed_data->format = glViewport_FORMAT; \
     packed_data->func = glshim_glViewport; \
     packed_data->args.a1 = (GLint)x; \
@@ -1931,4 +1931,180 @@ void glPackedCall(const packed_call_t *packed) {
         }
     }
 }
+
+int glSizeofPackedCall(const packed_call_t *packed) {
+    switch (packed->format) {
+        case FORMAT_void_GLenum:
+            return sizeof(PACKED_void_GLenum);
+        case FORMAT_void_GLuint_GLuint:
+            return sizeof(PACKED_void_GLuint_GLuint);
+        case FORMAT_void_GLuint_GLuint_const_GLchar___GENPT__:
+            return sizeof(PACKED_void_GLuint_GLuint_const_GLchar___GENPT__);
+        case FORMAT_void_GLenum_GLuint:
+            return sizeof(PACKED_void_GLenum_GLuint);
+        case FORMAT_void_GLclampf_GLclampf_GLclampf_GLclampf:
+            return sizeof(PACKED_void_GLclampf_GLclampf_GLclampf_GLclampf);
+        case FORMAT_void_GLenum_GLenum:
+            return sizeof(PACKED_void_GLenum_GLenum);
+        case FORMAT_void_GLenum_GLenum_GLenum_GLenum:
+            return sizeof(PACKED_void_GLenum_GLenum_GLenum_GLenum);
+        case FORMAT_void_GLenum_GLsizeiptr_const_GLvoid___GENPT___GLenum:
+            return sizeof(PACKED_void_GLenum_GLsizeiptr_const_GLvoid___GENPT___GLenum);
+        case FORMAT_void_GLenum_GLintptr_GLsizeiptr_const_GLvoid___GENPT__:
+            return sizeof(PACKED_void_GLenum_GLintptr_GLsizeiptr_const_GLvoid___GENPT__);
+        case FORMAT_GLenum_GLenum:
+            return sizeof(PACKED_GLenum_GLenum);
+        case FORMAT_void_GLbitfield:
+            return sizeof(PACKED_void_GLbitfield);
+        case FORMAT_void_GLclampf:
+            return sizeof(PACKED_void_GLclampf);
+        case FORMAT_void_GLint:
+            return sizeof(PACKED_void_GLint);
+        case FORMAT_void_GLboolean_GLboolean_GLboolean_GLboolean:
+            return sizeof(PACKED_void_GLboolean_GLboolean_GLboolean_GLboolean);
+        case FORMAT_void_GLuint:
+            return sizeof(PACKED_void_GLuint);
+        case FORMAT_void_GLenum_GLint_GLenum_GLsizei_GLsizei_GLint_GLsizei_const_GLvoid___GENPT__:
+            return sizeof(PACKED_void_GLenum_GLint_GLenum_GLsizei_GLsizei_GLint_GLsizei_const_GLvoid___GENPT__);
+        case FORMAT_void_GLenum_GLint_GLint_GLint_GLsizei_GLsizei_GLenum_GLsizei_const_GLvoid___GENPT__:
+            return sizeof(PACKED_void_GLenum_GLint_GLint_GLint_GLsizei_GLsizei_GLenum_GLsizei_const_GLvoid___GENPT__);
+        case FORMAT_void_GLenum_GLint_GLenum_GLint_GLint_GLsizei_GLsizei_GLint:
+            return sizeof(PACKED_void_GLenum_GLint_GLenum_GLint_GLint_GLsizei_GLsizei_GLint);
+        case FORMAT_void_GLenum_GLint_GLint_GLint_GLint_GLint_GLsizei_GLsizei:
+            return sizeof(PACKED_void_GLenum_GLint_GLint_GLint_GLint_GLint_GLsizei_GLsizei);
+        case FORMAT_GLuint:
+            return sizeof(PACKED_GLuint);
+        case FORMAT_GLuint_GLenum:
+            return sizeof(PACKED_GLuint_GLenum);
+        case FORMAT_void_GLsizei_const_GLuint___GENPT__:
+            return sizeof(PACKED_void_GLsizei_const_GLuint___GENPT__);
+        case FORMAT_void_GLboolean:
+            return sizeof(PACKED_void_GLboolean);
+        case FORMAT_void_GLclampf_GLclampf:
+            return sizeof(PACKED_void_GLclampf_GLclampf);
+        case FORMAT_void_GLenum_GLint_GLsizei:
+            return sizeof(PACKED_void_GLenum_GLint_GLsizei);
+        case FORMAT_void_GLenum_GLsizei_GLenum_const_GLvoid___GENPT__:
+            return sizeof(PACKED_void_GLenum_GLsizei_GLenum_const_GLvoid___GENPT__);
+        case FORMAT_void:
+            return sizeof(PACKED_void);
+        case FORMAT_void_GLenum_GLenum_GLenum_GLuint:
+            return sizeof(PACKED_void_GLenum_GLenum_GLenum_GLuint);
+        case FORMAT_void_GLenum_GLenum_GLenum_GLuint_GLint:
+            return sizeof(PACKED_void_GLenum_GLenum_GLenum_GLuint_GLint);
+        case FORMAT_void_GLsizei_GLuint___GENPT__:
+            return sizeof(PACKED_void_GLsizei_GLuint___GENPT__);
+        case FORMAT_void_GLuint_GLuint_GLsizei_GLsizei___GENPT___GLint___GENPT___GLenum___GENPT___GLchar___GENPT__:
+            return sizeof(PACKED_void_GLuint_GLuint_GLsizei_GLsizei___GENPT___GLint___GENPT___GLenum___GENPT___GLchar___GENPT__);
+        case FORMAT_void_GLuint_GLsizei_GLsizei___GENPT___GLuint___GENPT__:
+            return sizeof(PACKED_void_GLuint_GLsizei_GLsizei___GENPT___GLuint___GENPT__);
+        case FORMAT_GLint_GLuint_const_GLchar___GENPT__:
+            return sizeof(PACKED_GLint_GLuint_const_GLchar___GENPT__);
+        case FORMAT_void_GLenum_GLboolean___GENPT__:
+            return sizeof(PACKED_void_GLenum_GLboolean___GENPT__);
+        case FORMAT_void_GLenum_GLenum_GLint___GENPT__:
+            return sizeof(PACKED_void_GLenum_GLenum_GLint___GENPT__);
+        case FORMAT_GLenum:
+            return sizeof(PACKED_GLenum);
+        case FORMAT_void_GLenum_GLfloat___GENPT__:
+            return sizeof(PACKED_void_GLenum_GLfloat___GENPT__);
+        case FORMAT_void_GLenum_GLenum_GLenum_GLint___GENPT__:
+            return sizeof(PACKED_void_GLenum_GLenum_GLenum_GLint___GENPT__);
+        case FORMAT_void_GLenum_GLint___GENPT__:
+            return sizeof(PACKED_void_GLenum_GLint___GENPT__);
+        case FORMAT_void_GLuint_GLsizei_GLsizei___GENPT___GLchar___GENPT__:
+            return sizeof(PACKED_void_GLuint_GLsizei_GLsizei___GENPT___GLchar___GENPT__);
+        case FORMAT_void_GLuint_GLenum_GLint___GENPT__:
+            return sizeof(PACKED_void_GLuint_GLenum_GLint___GENPT__);
+        case FORMAT_void_GLenum_GLenum_GLint___GENPT___GLint___GENPT__:
+            return sizeof(PACKED_void_GLenum_GLenum_GLint___GENPT___GLint___GENPT__);
+        case FORMAT_const_GLubyte___GENPT___GLenum:
+            return sizeof(PACKED_const_GLubyte___GENPT___GLenum);
+        case FORMAT_void_GLenum_GLenum_GLfloat___GENPT__:
+            return sizeof(PACKED_void_GLenum_GLenum_GLfloat___GENPT__);
+        case FORMAT_void_GLuint_GLint_GLfloat___GENPT__:
+            return sizeof(PACKED_void_GLuint_GLint_GLfloat___GENPT__);
+        case FORMAT_void_GLuint_GLint_GLint___GENPT__:
+            return sizeof(PACKED_void_GLuint_GLint_GLint___GENPT__);
+        case FORMAT_void_GLuint_GLenum_GLvoid___GENPT____GENPT__:
+            return sizeof(PACKED_void_GLuint_GLenum_GLvoid___GENPT____GENPT__);
+        case FORMAT_void_GLuint_GLenum_GLfloat___GENPT__:
+            return sizeof(PACKED_void_GLuint_GLenum_GLfloat___GENPT__);
+        case FORMAT_GLboolean_GLuint:
+            return sizeof(PACKED_GLboolean_GLuint);
+        case FORMAT_GLboolean_GLenum:
+            return sizeof(PACKED_GLboolean_GLenum);
+        case FORMAT_void_GLfloat:
+            return sizeof(PACKED_void_GLfloat);
+        case FORMAT_void_GLenum_GLint:
+            return sizeof(PACKED_void_GLenum_GLint);
+        case FORMAT_void_GLfloat_GLfloat:
+            return sizeof(PACKED_void_GLfloat_GLfloat);
+        case FORMAT_void_GLint_GLint_GLsizei_GLsizei_GLenum_GLenum_GLvoid___GENPT__:
+            return sizeof(PACKED_void_GLint_GLint_GLsizei_GLsizei_GLenum_GLenum_GLvoid___GENPT__);
+        case FORMAT_void_GLenum_GLenum_GLsizei_GLsizei:
+            return sizeof(PACKED_void_GLenum_GLenum_GLsizei_GLsizei);
+        case FORMAT_void_GLclampf_GLboolean:
+            return sizeof(PACKED_void_GLclampf_GLboolean);
+        case FORMAT_void_GLint_GLint_GLsizei_GLsizei:
+            return sizeof(PACKED_void_GLint_GLint_GLsizei_GLsizei);
+        case FORMAT_void_GLsizei_const_GLuint___GENPT___GLenum_const_GLvoid___GENPT___GLsizei:
+            return sizeof(PACKED_void_GLsizei_const_GLuint___GENPT___GLenum_const_GLvoid___GENPT___GLsizei);
+        case FORMAT_void_GLuint_GLsizei_const_GLchar___GENPT___const___GENPT___const_GLint___GENPT__:
+            return sizeof(PACKED_void_GLuint_GLsizei_const_GLchar___GENPT___const___GENPT___const_GLint___GENPT__);
+        case FORMAT_void_GLenum_GLint_GLuint:
+            return sizeof(PACKED_void_GLenum_GLint_GLuint);
+        case FORMAT_void_GLenum_GLenum_GLint_GLuint:
+            return sizeof(PACKED_void_GLenum_GLenum_GLint_GLuint);
+        case FORMAT_void_GLenum_GLenum_GLenum:
+            return sizeof(PACKED_void_GLenum_GLenum_GLenum);
+        case FORMAT_void_GLenum_GLint_GLint_GLsizei_GLsizei_GLint_GLenum_GLenum_const_GLvoid___GENPT__:
+            return sizeof(PACKED_void_GLenum_GLint_GLint_GLsizei_GLsizei_GLint_GLenum_GLenum_const_GLvoid___GENPT__);
+        case FORMAT_void_GLenum_GLenum_GLfloat:
+            return sizeof(PACKED_void_GLenum_GLenum_GLfloat);
+        case FORMAT_void_GLenum_GLenum_const_GLfloat___GENPT__:
+            return sizeof(PACKED_void_GLenum_GLenum_const_GLfloat___GENPT__);
+        case FORMAT_void_GLenum_GLenum_GLint:
+            return sizeof(PACKED_void_GLenum_GLenum_GLint);
+        case FORMAT_void_GLenum_GLenum_const_GLint___GENPT__:
+            return sizeof(PACKED_void_GLenum_GLenum_const_GLint___GENPT__);
+        case FORMAT_void_GLenum_GLint_GLint_GLint_GLsizei_GLsizei_GLenum_GLenum_const_GLvoid___GENPT__:
+            return sizeof(PACKED_void_GLenum_GLint_GLint_GLint_GLsizei_GLsizei_GLenum_GLenum_const_GLvoid___GENPT__);
+        case FORMAT_void_GLint_GLfloat:
+            return sizeof(PACKED_void_GLint_GLfloat);
+        case FORMAT_void_GLint_GLsizei_const_GLfloat___GENPT__:
+            return sizeof(PACKED_void_GLint_GLsizei_const_GLfloat___GENPT__);
+        case FORMAT_void_GLint_GLint:
+            return sizeof(PACKED_void_GLint_GLint);
+        case FORMAT_void_GLint_GLsizei_const_GLint___GENPT__:
+            return sizeof(PACKED_void_GLint_GLsizei_const_GLint___GENPT__);
+        case FORMAT_void_GLint_GLfloat_GLfloat:
+            return sizeof(PACKED_void_GLint_GLfloat_GLfloat);
+        case FORMAT_void_GLint_GLint_GLint:
+            return sizeof(PACKED_void_GLint_GLint_GLint);
+        case FORMAT_void_GLint_GLfloat_GLfloat_GLfloat:
+            return sizeof(PACKED_void_GLint_GLfloat_GLfloat_GLfloat);
+        case FORMAT_void_GLint_GLint_GLint_GLint:
+            return sizeof(PACKED_void_GLint_GLint_GLint_GLint);
+        case FORMAT_void_GLint_GLfloat_GLfloat_GLfloat_GLfloat:
+            return sizeof(PACKED_void_GLint_GLfloat_GLfloat_GLfloat_GLfloat);
+        case FORMAT_void_GLint_GLint_GLint_GLint_GLint:
+            return sizeof(PACKED_void_GLint_GLint_GLint_GLint_GLint);
+        case FORMAT_void_GLint_GLsizei_GLboolean_const_GLfloat___GENPT__:
+            return sizeof(PACKED_void_GLint_GLsizei_GLboolean_const_GLfloat___GENPT__);
+        case FORMAT_void_GLuint_GLfloat:
+            return sizeof(PACKED_void_GLuint_GLfloat);
+        case FORMAT_void_GLuint_const_GLfloat___GENPT__:
+            return sizeof(PACKED_void_GLuint_const_GLfloat___GENPT__);
+        case FORMAT_void_GLuint_GLfloat_GLfloat:
+            return sizeof(PACKED_void_GLuint_GLfloat_GLfloat);
+        case FORMAT_void_GLuint_GLfloat_GLfloat_GLfloat:
+            return sizeof(PACKED_void_GLuint_GLfloat_GLfloat_GLfloat);
+        case FORMAT_void_GLuint_GLfloat_GLfloat_GLfloat_GLfloat:
+            return sizeof(PACKED_void_GLuint_GLfloat_GLfloat_GLfloat_GLfloat);
+        case FORMAT_void_GLuint_GLint_GLenum_GLboolean_GLsizei_const_GLvoid___GENPT__:
+            return sizeof(PACKED_void_GLuint_GLint_GLenum_GLboolean_GLsizei_const_GLvoid___GENPT__);
+    }
+    return 0;
+}
 #endif
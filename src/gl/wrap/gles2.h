@@ -1392,6 +1392,7 @@ typedef struct {
 
 extern void glPushCall(void *data);
 void glPackedCall(const packed_call_t *packed);
+int glSizeofPackedCall(const packed_call_t *packed);
 void glIndexedCall(const indexed_call_t *packed, void *ret_v);
 
 #define glActiveTexture_INDEX 1
@@ -2678,7 +2679,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 
 #ifndef direct_glActiveTexture
 #define push_glActiveTexture(texture) { \
-    glActiveTexture_PACKED *packed_data = malloc(sizeof(glActiveTexture_PACKED)); \
+    glActiveTexture_PACKED packed_data[1]; \
     packed_data->format = glActiveTexture_FORMAT; \
     packed_data->func = glshim_glActiveTexture; \
     packed_data->args.a1 = (GLenum)texture; \
@@ -2687,7 +2688,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glAttachShader
 #define push_glAttachShader(program, shader) { \
-    glAttachShader_PACKED *packed_data = malloc(sizeof(glAttachShader_PACKED)); \
+    glAttachShader_PACKED packed_data[1]; \
     packed_data->format = glAttachShader_FORMAT; \
     packed_data->func = glshim_glAttachShader; \
     packed_data->args.a1 = (GLuint)program; \
@@ -2697,7 +2698,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glBindAttribLocation
 #define push_glBindAttribLocation(program, index, name) { \
-    glBindAttribLocation_PACKED *packed_data = malloc(sizeof(glBindAttribLocation_PACKED)); \
+    glBindAttribLocation_PACKED packed_data[1]; \
     packed_data->format = glBindAttribLocation_FORMAT; \
     packed_data->func = glshim_glBindAttribLocation; \
     packed_data->args.a1 = (GLuint)program; \
@@ -2708,7 +2709,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glBindBuffer
 #define push_glBindBuffer(target, buffer) { \
-    glBindBuffer_PACKED *packed_data = malloc(sizeof(glBindBuffer_PACKED)); \
+    glBindBuffer_PACKED packed_data[1]; \
     packed_data->format = glBindBuffer_FORMAT; \
     packed_data->func = glshim_glBindBuffer; \
     packed_data->args.a1 = (GLenum)target; \
@@ -2718,7 +2719,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glBindFramebuffer
 #define push_glBindFramebuffer(target, framebuffer) { \
-    glBindFramebuffer_PACKED *packed_data = malloc(sizeof(glBindFramebuffer_PACKED)); \
+    glBindFramebuffer_PACKED packed_data[1]; \
     packed_data->format = glBindFramebuffer_FORMAT; \
     packed_data->func = glshim_glBindFramebuffer; \
     packed_data->args.a1 = (GLenum)target; \
@@ -2728,7 +2729,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glBindRenderbuffer
 #define push_glBindRenderbuffer(target, renderbuffer) { \
-    glBindRenderbuffer_PACKED *packed_data = malloc(sizeof(glBindRenderbuffer_PACKED)); \
+    glBindRenderbuffer_PACKED packed_data[1]; \
     packed_data->format = glBindRenderbuffer_FORMAT; \
     packed_data->func = glshim_glBindRenderbuffer; \
     packed_data->args.a1 = (GLenum)target; \
@@ -2738,7 +2739,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glBindTexture
 #define push_glBindTexture(target, texture) { \
-    glBindTexture_PACKED *packed_data = malloc(sizeof(glBindTexture_PACKED)); \
+    glBindTexture_PACKED packed_data[1]; \
     packed_data->format = glBindTexture_FORMAT; \
     packed_data->func = glshim_glBindTexture; \
     packed_data->args.a1 = (GLenum)target; \
@@ -2748,7 +2749,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glBlendColor
 #define push_glBlendColor(red, green, blue, alpha) { \
-    glBlendColor_PACKED *packed_data = malloc(sizeof(glBlendColor_PACKED)); \
+    glBlendColor_PACKED packed_data[1]; \
     packed_data->format = glBlendColor_FORMAT; \
     packed_data->func = glshim_glBlendColor; \
     packed_data->args.a1 = (GLclampf)red; \
@@ -2760,7 +2761,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glBlendEquation
 #define push_glBlendEquation(mode) { \
-    glBlendEquation_PACKED *packed_data = malloc(sizeof(glBlendEquation_PACKED)); \
+    glBlendEquation_PACKED packed_data[1]; \
     packed_data->format = glBlendEquation_FORMAT; \
     packed_data->func = glshim_glBlendEquation; \
     packed_data->args.a1 = (GLenum)mode; \
@@ -2769,7 +2770,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glBlendEquationSeparate
 #define push_glBlendEquationSeparate(modeRGB, modeA) { \
-    glBlendEquationSeparate_PACKED *packed_data = malloc(sizeof(glBlendEquationSeparate_PACKED)); \
+    glBlendEquationSeparate_PACKED packed_data[1]; \
     packed_data->format = glBlendEquationSeparate_FORMAT; \
     packed_data->func = glshim_glBlendEquationSeparate; \
     packed_data->args.a1 = (GLenum)modeRGB; \
@@ -2779,7 +2780,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glBlendFunc
 #define push_glBlendFunc(sfactor, dfactor) { \
-    glBlendFunc_PACKED *packed_data = malloc(sizeof(glBlendFunc_PACKED)); \
+    glBlendFunc_PACKED packed_data[1]; \
     packed_data->format = glBlendFunc_FORMAT; \
     packed_data->func = glshim_glBlendFunc; \
     packed_data->args.a1 = (GLenum)sfactor; \
@@ -2789,7 +2790,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glBlendFuncSeparate
 #define push_glBlendFuncSeparate(sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha) { \
-    glBlendFuncSeparate_PACKED *packed_data = malloc(sizeof(glBlendFuncSeparate_PACKED)); \
+    glBlendFuncSeparate_PACKED packed_data[1]; \
     packed_data->format = glBlendFuncSeparate_FORMAT; \
     packed_data->func = glshim_glBlendFuncSeparate; \
     packed_data->args.a1 = (GLenum)sfactorRGB; \
@@ -2801,7 +2802,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glBufferData
 #define push_glBufferData(target, size, data, usage) { \
-    glBufferData_PACKED *packed_data = malloc(sizeof(glBufferData_PACKED)); \
+    glBufferData_PACKED packed_data[1]; \
     packed_data->format = glBufferData_FORMAT; \
     packed_data->func = glshim_glBufferData; \
     packed_data->args.a1 = (GLenum)target; \
@@ -2813,7 +2814,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glBufferSubData
 #define push_glBufferSubData(target, offset, size, data) { \
-    glBufferSubData_PACKED *packed_data = malloc(sizeof(glBufferSubData_PACKED)); \
+    glBufferSubData_PACKED packed_data[1]; \
     packed_data->format = glBufferSubData_FORMAT; \
     packed_data->func = glshim_glBufferSubData; \
     packed_data->args.a1 = (GLenum)target; \
@@ -2825,7 +2826,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glCheckFramebufferStatus
 #define push_glCheckFramebufferStatus(target) { \
-    glCheckFramebufferStatus_PACKED *packed_data = malloc(sizeof(glCheckFramebufferStatus_PACKED)); \
+    glCheckFramebufferStatus_PACKED packed_data[1]; \
     packed_data->format = glCheckFramebufferStatus_FORMAT; \
     packed_data->func = glshim_glCheckFramebufferStatus; \
     packed_data->args.a1 = (GLenum)target; \
@@ -2834,7 +2835,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glClear
 #define push_glClear(mask) { \
-    glClear_PACKED *packed_data = malloc(sizeof(glClear_PACKED)); \
+    glClear_PACKED packed_data[1]; \
     packed_data->format = glClear_FORMAT; \
     packed_data->func = glshim_glClear; \
     packed_data->args.a1 = (GLbitfield)mask; \
@@ -2843,7 +2844,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glClearColor
 #define push_glClearColor(red, green, blue, alpha) { \
-    glClearColor_PACKED *packed_data = malloc(sizeof(glClearColor_PACKED)); \
+    glClearColor_PACKED packed_data[1]; \
     packed_data->format = glClearColor_FORMAT; \
     packed_data->func = glshim_glClearColor; \
     packed_data->args.a1 = (GLclampf)red; \
@@ -2855,7 +2856,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glClearDepthf
 #define push_glClearDepthf(depth) { \
-    glClearDepthf_PACKED *packed_data = malloc(sizeof(glClearDepthf_PACKED)); \
+    glClearDepthf_PACKED packed_data[1]; \
     packed_data->format = glClearDepthf_FORMAT; \
     packed_data->func = glshim_glClearDepthf; \
     packed_data->args.a1 = (GLclampf)depth; \
@@ -2864,7 +2865,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glClearStencil
 #define push_glClearStencil(s) { \
-    glClearStencil_PACKED *packed_data = malloc(sizeof(glClearStencil_PACKED)); \
+    glClearStencil_PACKED packed_data[1]; \
     packed_data->format = glClearStencil_FORMAT; \
     packed_data->func = glshim_glClearStencil; \
     packed_data->args.a1 = (GLint)s; \
@@ -2873,7 +2874,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glColorMask
 #define push_glColorMask(red, green, blue, alpha) { \
-    glColorMask_PACKED *packed_data = malloc(sizeof(glColorMask_PACKED)); \
+    glColorMask_PACKED packed_data[1]; \
     packed_data->format = glColorMask_FORMAT; \
     packed_data->func = glshim_glColorMask; \
     packed_data->args.a1 = (GLboolean)red; \
@@ -2885,7 +2886,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glCompileShader
 #define push_glCompileShader(shader) { \
-    glCompileShader_PACKED *packed_data = malloc(sizeof(glCompileShader_PACKED)); \
+    glCompileShader_PACKED packed_data[1]; \
     packed_data->format = glCompileShader_FORMAT; \
     packed_data->func = glshim_glCompileShader; \
     packed_data->args.a1 = (GLuint)shader; \
@@ -2894,7 +2895,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glCompressedTexImage2D
 #define push_glCompressedTexImage2D(target, level, internalformat, width, height, border, imageSize, data) { \
-    glCompressedTexImage2D_PACKED *packed_data = malloc(sizeof(glCompressedTexImage2D_PACKED)); \
+    glCompressedTexImage2D_PACKED packed_data[1]; \
     packed_data->format = glCompressedTexImage2D_FORMAT; \
     packed_data->func = glshim_glCompressedTexImage2D; \
     packed_data->args.a1 = (GLenum)target; \
@@ -2910,7 +2911,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glCompressedTexSubImage2D
 #define push_glCompressedTexSubImage2D(target, level, xoffset, yoffset, width, height, format, imageSize, data) { \
-    glCompressedTexSubImage2D_PACKED *packed_data = malloc(sizeof(glCompressedTexSubImage2D_PACKED)); \
+    glCompressedTexSubImage2D_PACKED packed_data[1]; \
     packed_data->format = glCompressedTexSubImage2D_FORMAT; \
     packed_data->func = glshim_glCompressedTexSubImage2D; \
     packed_data->args.a1 = (GLenum)target; \
@@ -2927,7 +2928,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glCopyTexImage2D
 #define push_glCopyTexImage2D(target, level, internalformat, x, y, width, height, border) { \
-    glCopyTexImage2D_PACKED *packed_data = malloc(sizeof(glCopyTexImage2D_PACKED)); \
+    glCopyTexImage2D_PACKED packed_data[1]; \
     packed_data->format = glCopyTexImage2D_FORMAT; \
     packed_data->func = glshim_glCopyTexImage2D; \
     packed_data->args.a1 = (GLenum)target; \
@@ -2943,7 +2944,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glCopyTexSubImage2D
 #define push_glCopyTexSubImage2D(target, level, xoffset, yoffset, x, y, width, height) { \
-    glCopyTexSubImage2D_PACKED *packed_data = malloc(sizeof(glCopyTexSubImage2D_PACKED)); \
+    glCopyTexSubImage2D_PACKED packed_data[1]; \
     packed_data->format = glCopyTexSubImage2D_FORMAT; \
     packed_data->func = glshim_glCopyTexSubImage2D; \
     packed_data->args.a1 = (GLenum)target; \
@@ -2959,7 +2960,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glCreateProgram
 #define push_glCreateProgram() { \
-    glCreateProgram_PACKED *packed_data = malloc(sizeof(glCreateProgram_PACKED)); \
+    glCreateProgram_PACKED packed_data[1]; \
     packed_data->format = glCreateProgram_FORMAT; \
     packed_data->func = glshim_glCreateProgram; \
     glPushCall((void *)packed_data); \
@@ -2967,7 +2968,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glCreateShader
 #define push_glCreateShader(type) { \
-    glCreateShader_PACKED *packed_data = malloc(sizeof(glCreateShader_PACKED)); \
+    glCreateShader_PACKED packed_data[1]; \
     packed_data->format = glCreateShader_FORMAT; \
     packed_data->func = glshim_glCreateShader; \
     packed_data->args.a1 = (GLenum)type; \
@@ -2976,7 +2977,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glCullFace
 #define push_glCullFace(mode) { \
-    glCullFace_PACKED *packed_data = malloc(sizeof(glCullFace_PACKED)); \
+    glCullFace_PACKED packed_data[1]; \
     packed_data->format = glCullFace_FORMAT; \
     packed_data->func = glshim_glCullFace; \
     packed_data->args.a1 = (GLenum)mode; \
@@ -2985,7 +2986,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glDeleteBuffers
 #define push_glDeleteBuffers(n, buffer) { \
-    glDeleteBuffers_PACKED *packed_data = malloc(sizeof(glDeleteBuffers_PACKED)); \
+    glDeleteBuffers_PACKED packed_data[1]; \
     packed_data->format = glDeleteBuffers_FORMAT; \
     packed_data->func = glshim_glDeleteBuffers; \
     packed_data->args.a1 = (GLsizei)n; \
@@ -2995,7 +2996,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glDeleteFramebuffers
 #define push_glDeleteFramebuffers(n, framebuffers) { \
-    glDeleteFramebuffers_PACKED *packed_data = malloc(sizeof(glDeleteFramebuffers_PACKED)); \
+    glDeleteFramebuffers_PACKED packed_data[1]; \
     packed_data->format = glDeleteFramebuffers_FORMAT; \
     packed_data->func = glshim_glDeleteFramebuffers; \
     packed_data->args.a1 = (GLsizei)n; \
@@ -3005,7 +3006,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glDeleteProgram
 #define push_glDeleteProgram(program) { \
-    glDeleteProgram_PACKED *packed_data = malloc(sizeof(glDeleteProgram_PACKED)); \
+    glDeleteProgram_PACKED packed_data[1]; \
     packed_data->format = glDeleteProgram_FORMAT; \
     packed_data->func = glshim_glDeleteProgram; \
     packed_data->args.a1 = (GLuint)program; \
@@ -3014,7 +3015,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glDeleteRenderbuffers
 #define push_glDeleteRenderbuffers(n, renderbuffers) { \
-    glDeleteRenderbuffers_PACKED *packed_data = malloc(sizeof(glDeleteRenderbuffers_PACKED)); \
+    glDeleteRenderbuffers_PACKED packed_data[1]; \
     packed_data->format = glDeleteRenderbuffers_FORMAT; \
     packed_data->func = glshim_glDeleteRenderbuffers; \
     packed_data->args.a1 = (GLsizei)n; \
@@ -3024,7 +3025,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glDeleteShader
 #define push_glDeleteShader(program) { \
-    glDeleteShader_PACKED *packed_data = malloc(sizeof(glDeleteShader_PACKED)); \
+    glDeleteShader_PACKED packed_data[1]; \
     packed_data->format = glDeleteShader_FORMAT; \
     packed_data->func = glshim_glDeleteShader; \
     packed_data->args.a1 = (GLuint)program; \
@@ -3033,7 +3034,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glDeleteTextures
 #define push_glDeleteTextures(n, textures) { \
-    glDeleteTextures_PACKED *packed_data = malloc(sizeof(glDeleteTextures_PACKED)); \
+    glDeleteTextures_PACKED packed_data[1]; \
     packed_data->format = glDeleteTextures_FORMAT; \
     packed_data->func = glshim_glDeleteTextures; \
     packed_data->args.a1 = (GLsizei)n; \
@@ -3043,7 +3044,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glDepthFunc
 #define push_glDepthFunc(func) { \
-    glDepthFunc_PACKED *packed_data = malloc(sizeof(glDepthFunc_PACKED)); \
+    glDepthFunc_PACKED packed_data[1]; \
     packed_data->format = glDepthFunc_FORMAT; \
     packed_data->func = glshim_glDepthFunc; \
     packed_data->args.a1 = (GLenum)func; \
@@ -3052,7 +3053,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glDepthMask
 #define push_glDepthMask(flag) { \
-    glDepthMask_PACKED *packed_data = malloc(sizeof(glDepthMask_PACKED)); \
+    glDepthMask_PACKED packed_data[1]; \
     packed_data->format = glDepthMask_FORMAT; \
     packed_data->func = glshim_glDepthMask; \
     packed_data->args.a1 = (GLboolean)flag; \
@@ -3061,7 +3062,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glDepthRangef
 #define push_glDepthRangef(zNear, zFar) { \
-    glDepthRangef_PACKED *packed_data = malloc(sizeof(glDepthRangef_PACKED)); \
+    glDepthRangef_PACKED packed_data[1]; \
     packed_data->format = glDepthRangef_FORMAT; \
     packed_data->func = glshim_glDepthRangef; \
     packed_data->args.a1 = (GLclampf)zNear; \
@@ -3071,7 +3072,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glDetachShader
 #define push_glDetachShader(program, shader) { \
-    glDetachShader_PACKED *packed_data = malloc(sizeof(glDetachShader_PACKED)); \
+    glDetachShader_PACKED packed_data[1]; \
     packed_data->format = glDetachShader_FORMAT; \
     packed_data->func = glshim_glDetachShader; \
     packed_data->args.a1 = (GLuint)program; \
@@ -3081,7 +3082,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glDisable
 #define push_glDisable(cap) { \
-    glDisable_PACKED *packed_data = malloc(sizeof(glDisable_PACKED)); \
+    glDisable_PACKED packed_data[1]; \
     packed_data->format = glDisable_FORMAT; \
     packed_data->func = glshim_glDisable; \
     packed_data->args.a1 = (GLenum)cap; \
@@ -3090,7 +3091,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glDisableVertexAttribArray
 #define push_glDisableVertexAttribArray(index) { \
-    glDisableVertexAttribArray_PACKED *packed_data = malloc(sizeof(glDisableVertexAttribArray_PACKED)); \
+    glDisableVertexAttribArray_PACKED packed_data[1]; \
     packed_data->format = glDisableVertexAttribArray_FORMAT; \
     packed_data->func = glshim_glDisableVertexAttribArray; \
     packed_data->args.a1 = (GLuint)index; \
@@ -3099,7 +3100,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glDrawArrays
 #define push_glDrawArrays(mode, first, count) { \
-    glDrawArrays_PACKED *packed_data = malloc(sizeof(glDrawArrays_PACKED)); \
+    glDrawArrays_PACKED packed_data[1]; \
     packed_data->format = glDrawArrays_FORMAT; \
     packed_data->func = glshim_glDrawArrays; \
     packed_data->args.a1 = (GLenum)mode; \
@@ -3110,7 +3111,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glDrawElements
 #define push_glDrawElements(mode, count, type, indices) { \
-    glDrawElements_PACKED *packed_data = malloc(sizeof(glDrawElements_PACKED)); \
+    glDrawElements_PACKED packed_data[1]; \
     packed_data->format = glDrawElements_FORMAT; \
     packed_data->func = glshim_glDrawElements; \
     packed_data->args.a1 = (GLenum)mode; \
@@ -3122,7 +3123,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glEnable
 #define push_glEnable(cap) { \
-    glEnable_PACKED *packed_data = malloc(sizeof(glEnable_PACKED)); \
+    glEnable_PACKED packed_data[1]; \
     packed_data->format = glEnable_FORMAT; \
     packed_data->func = glshim_glEnable; \
     packed_data->args.a1 = (GLenum)cap; \
@@ -3131,7 +3132,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glEnableVertexAttribArray
 #define push_glEnableVertexAttribArray(index) { \
-    glEnableVertexAttribArray_PACKED *packed_data = malloc(sizeof(glEnableVertexAttribArray_PACKED)); \
+    glEnableVertexAttribArray_PACKED packed_data[1]; \
     packed_data->format = glEnableVertexAttribArray_FORMAT; \
     packed_data->func = glshim_glEnableVertexAttribArray; \
     packed_data->args.a1 = (GLuint)index; \
@@ -3140,7 +3141,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glFinish
 #define push_glFinish() { \
-    glFinish_PACKED *packed_data = malloc(sizeof(glFinish_PACKED)); \
+    glFinish_PACKED packed_data[1]; \
     packed_data->format = glFinish_FORMAT; \
     packed_data->func = glshim_glFinish; \
     glPushCall((void *)packed_data); \
@@ -3148,7 +3149,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glFlush
 #define push_glFlush() { \
-    glFlush_PACKED *packed_data = malloc(sizeof(glFlush_PACKED)); \
+    glFlush_PACKED packed_data[1]; \
     packed_data->format = glFlush_FORMAT; \
     packed_data->func = glshim_glFlush; \
     glPushCall((void *)packed_data); \
@@ -3156,7 +3157,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glFramebufferRenderbuffer
 #define push_glFramebufferRenderbuffer(target, attachment, renderbuffertarget, renderbuffer) { \
-    glFramebufferRenderbuffer_PACKED *packed_data = malloc(sizeof(glFramebufferRenderbuffer_PACKED)); \
+    glFramebufferRenderbuffer_PACKED packed_data[1]; \
     packed_data->format = glFramebufferRenderbuffer_FORMAT; \
     packed_data->func = glshim_glFramebufferRenderbuffer; \
     packed_data->args.a1 = (GLenum)target; \
@@ -3168,7 +3169,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glFramebufferTexture2D
 #define push_glFramebufferTexture2D(target, attachment, textarget, texture, level) { \
-    glFramebufferTexture2D_PACKED *packed_data = malloc(sizeof(glFramebufferTexture2D_PACKED)); \
+    glFramebufferTexture2D_PACKED packed_data[1]; \
     packed_data->format = glFramebufferTexture2D_FORMAT; \
     packed_data->func = glshim_glFramebufferTexture2D; \
     packed_data->args.a1 = (GLenum)target; \
@@ -3181,7 +3182,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glFrontFace
 #define push_glFrontFace(mode) { \
-    glFrontFace_PACKED *packed_data = malloc(sizeof(glFrontFace_PACKED)); \
+    glFrontFace_PACKED packed_data[1]; \
     packed_data->format = glFrontFace_FORMAT; \
     packed_data->func = glshim_glFrontFace; \
     packed_data->args.a1 = (GLenum)mode; \
@@ -3190,7 +3191,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glGenBuffers
 #define push_glGenBuffers(n, buffer) { \
-    glGenBuffers_PACKED *packed_data = malloc(sizeof(glGenBuffers_PACKED)); \
+    glGenBuffers_PACKED packed_data[1]; \
     packed_data->format = glGenBuffers_FORMAT; \
     packed_data->func = glshim_glGenBuffers; \
     packed_data->args.a1 = (GLsizei)n; \
@@ -3200,7 +3201,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glGenFramebuffers
 #define push_glGenFramebuffers(n, framebuffers) { \
-    glGenFramebuffers_PACKED *packed_data = malloc(sizeof(glGenFramebuffers_PACKED)); \
+    glGenFramebuffers_PACKED packed_data[1]; \
     packed_data->format = glGenFramebuffers_FORMAT; \
     packed_data->func = glshim_glGenFramebuffers; \
     packed_data->args.a1 = (GLsizei)n; \
@@ -3210,7 +3211,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glGenRenderbuffers
 #define push_glGenRenderbuffers(n, renderbuffers) { \
-    glGenRenderbuffers_PACKED *packed_data = malloc(sizeof(glGenRenderbuffers_PACKED)); \
+    glGenRenderbuffers_PACKED packed_data[1]; \
     packed_data->format = glGenRenderbuffers_FORMAT; \
     packed_data->func = glshim_glGenRenderbuffers; \
     packed_data->args.a1 = (GLsizei)n; \
@@ -3220,7 +3221,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glGenTextures
 #define push_glGenTextures(n, textures) { \
-    glGenTextures_PACKED *packed_data = malloc(sizeof(glGenTextures_PACKED)); \
+    glGenTextures_PACKED packed_data[1]; \
     packed_data->format = glGenTextures_FORMAT; \
     packed_data->func = glshim_glGenTextures; \
     packed_data->args.a1 = (GLsizei)n; \
@@ -3230,7 +3231,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glGenerateMipmap
 #define push_glGenerateMipmap(target) { \
-    glGenerateMipmap_PACKED *packed_data = malloc(sizeof(glGenerateMipmap_PACKED)); \
+    glGenerateMipmap_PACKED packed_data[1]; \
     packed_data->format = glGenerateMipmap_FORMAT; \
     packed_data->func = glshim_glGenerateMipmap; \
     packed_data->args.a1 = (GLenum)target; \
@@ -3239,7 +3240,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glGetActiveAttrib
 #define push_glGetActiveAttrib(program, index, bufSize, length, size, type, name) { \
-    glGetActiveAttrib_PACKED *packed_data = malloc(sizeof(glGetActiveAttrib_PACKED)); \
+    glGetActiveAttrib_PACKED packed_data[1]; \
     packed_data->format = glGetActiveAttrib_FORMAT; \
     packed_data->func = glshim_glGetActiveAttrib; \
     packed_data->args.a1 = (GLuint)program; \
@@ -3254,7 +3255,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glGetActiveUniform
 #define push_glGetActiveUniform(program, index, bufSize, length, size, type, name) { \
-    glGetActiveUniform_PACKED *packed_data = malloc(sizeof(glGetActiveUniform_PACKED)); \
+    glGetActiveUniform_PACKED packed_data[1]; \
     packed_data->format = glGetActiveUniform_FORMAT; \
     packed_data->func = glshim_glGetActiveUniform; \
     packed_data->args.a1 = (GLuint)program; \
@@ -3269,7 +3270,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glGetAttachedShaders
 #define push_glGetAttachedShaders(program, maxCount, count, obj) { \
-    glGetAttachedShaders_PACKED *packed_data = malloc(sizeof(glGetAttachedShaders_PACKED)); \
+    glGetAttachedShaders_PACKED packed_data[1]; \
     packed_data->format = glGetAttachedShaders_FORMAT; \
     packed_data->func = glshim_glGetAttachedShaders; \
     packed_data->args.a1 = (GLuint)program; \
@@ -3281,7 +3282,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glGetAttribLocation
 #define push_glGetAttribLocation(program, name) { \
-    glGetAttribLocation_PACKED *packed_data = malloc(sizeof(glGetAttribLocation_PACKED)); \
+    glGetAttribLocation_PACKED packed_data[1]; \
     packed_data->format = glGetAttribLocation_FORMAT; \
     packed_data->func = glshim_glGetAttribLocation; \
     packed_data->args.a1 = (GLuint)program; \
@@ -3291,7 +3292,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glGetBooleanv
 #define push_glGetBooleanv(pname, params) { \
-    glGetBooleanv_PACKED *packed_data = malloc(sizeof(glGetBooleanv_PACKED)); \
+    glGetBooleanv_PACKED packed_data[1]; \
     packed_data->format = glGetBooleanv_FORMAT; \
     packed_data->func = glshim_glGetBooleanv; \
     packed_data->args.a1 = (GLenum)pname; \
@@ -3301,7 +3302,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glGetBufferParameteriv
 #define push_glGetBufferParameteriv(target, pname, params) { \
-    glGetBufferParameteriv_PACKED *packed_data = malloc(sizeof(glGetBufferParameteriv_PACKED)); \
+    glGetBufferParameteriv_PACKED packed_data[1]; \
     packed_data->format = glGetBufferParameteriv_FORMAT; \
     packed_data->func = glshim_glGetBufferParameteriv; \
     packed_data->args.a1 = (GLenum)target; \
@@ -3312,7 +3313,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glGetError
 #define push_glGetError() { \
-    glGetError_PACKED *packed_data = malloc(sizeof(glGetError_PACKED)); \
+    glGetError_PACKED packed_data[1]; \
     packed_data->format = glGetError_FORMAT; \
     packed_data->func = glshim_glGetError; \
     glPushCall((void *)packed_data); \
@@ -3320,7 +3321,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glGetFloatv
 #define push_glGetFloatv(pname, params) { \
-    glGetFloatv_PACKED *packed_data = malloc(sizeof(glGetFloatv_PACKED)); \
+    glGetFloatv_PACKED packed_data[1]; \
     packed_data->format = glGetFloatv_FORMAT; \
     packed_data->func = glshim_glGetFloatv; \
     packed_data->args.a1 = (GLenum)pname; \
@@ -3330,7 +3331,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glGetFramebufferAttachmentParameteriv
 #define push_glGetFramebufferAttachmentParameteriv(target, attachment, pname, params) { \
-    glGetFramebufferAttachmentParameteriv_PACKED *packed_data = malloc(sizeof(glGetFramebufferAttachmentParameteriv_PACKED)); \
+    glGetFramebufferAttachmentParameteriv_PACKED packed_data[1]; \
     packed_data->format = glGetFramebufferAttachmentParameteriv_FORMAT; \
     packed_data->func = glshim_glGetFramebufferAttachmentParameteriv; \
     packed_data->args.a1 = (GLenum)target; \
@@ -3342,7 +3343,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glGetIntegerv
 #define push_glGetIntegerv(pname, params) { \
-    glGetIntegerv_PACKED *packed_data = malloc(sizeof(glGetIntegerv_PACKED)); \
+    glGetIntegerv_PACKED packed_data[1]; \
     packed_data->format = glGetIntegerv_FORMAT; \
     packed_data->func = glshim_glGetIntegerv; \
     packed_data->args.a1 = (GLenum)pname; \
@@ -3352,7 +3353,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glGetProgramInfoLog
 #define push_glGetProgramInfoLog(program, bufSize, length, infoLog) { \
-    glGetProgramInfoLog_PACKED *packed_data = malloc(sizeof(glGetProgramInfoLog_PACKED)); \
+    glGetProgramInfoLog_PACKED packed_data[1]; \
     packed_data->format = glGetProgramInfoLog_FORMAT; \
     packed_data->func = glshim_glGetProgramInfoLog; \
     packed_data->args.a1 = (GLuint)program; \
@@ -3364,7 +3365,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glGetProgramiv
 #define push_glGetProgramiv(program, pname, params) { \
-    glGetProgramiv_PACKED *packed_data = malloc(sizeof(glGetProgramiv_PACKED)); \
+    glGetProgramiv_PACKED packed_data[1]; \
     packed_data->format = glGetProgramiv_FORMAT; \
     packed_data->func = glshim_glGetProgramiv; \
     packed_data->args.a1 = (GLuint)program; \
@@ -3375,7 +3376,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glGetRenderbufferParameteriv
 #define push_glGetRenderbufferParameteriv(target, pname, params) { \
-    glGetRenderbufferParameteriv_PACKED *packed_data = malloc(sizeof(glGetRenderbufferParameteriv_PACKED)); \
+    glGetRenderbufferParameteriv_PACKED packed_data[1]; \
     packed_data->format = glGetRenderbufferParameteriv_FORMAT; \
     packed_data->func = glshim_glGetRenderbufferParameteriv; \
     packed_data->args.a1 = (GLenum)target; \
@@ -3386,7 +3387,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glGetShaderInfoLog
 #define push_glGetShaderInfoLog(shader, bufSize, length, infoLog) { \
-    glGetShaderInfoLog_PACKED *packed_data = malloc(sizeof(glGetShaderInfoLog_PACKED)); \
+    glGetShaderInfoLog_PACKED packed_data[1]; \
     packed_data->format = glGetShaderInfoLog_FORMAT; \
     packed_data->func = glshim_glGetShaderInfoLog; \
     packed_data->args.a1 = (GLuint)shader; \
@@ -3398,7 +3399,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glGetShaderPrecisionFormat
 #define push_glGetShaderPrecisionFormat(shadertype, precisiontype, range, precision) { \
-    glGetShaderPrecisionFormat_PACKED *packed_data = malloc(sizeof(glGetShaderPrecisionFormat_PACKED)); \
+    glGetShaderPrecisionFormat_PACKED packed_data[1]; \
     packed_data->format = glGetShaderPrecisionFormat_FORMAT; \
     packed_data->func = glshim_glGetShaderPrecisionFormat; \
     packed_data->args.a1 = (GLenum)shadertype; \
@@ -3410,7 +3411,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glGetShaderSource
 #define push_glGetShaderSource(shader, bufSize, length, source) { \
-    glGetShaderSource_PACKED *packed_data = malloc(sizeof(glGetShaderSource_PACKED)); \
+    glGetShaderSource_PACKED packed_data[1]; \
     packed_data->format = glGetShaderSource_FORMAT; \
     packed_data->func = glshim_glGetShaderSource; \
     packed_data->args.a1 = (GLuint)shader; \
@@ -3422,7 +3423,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glGetShaderiv
 #define push_glGetShaderiv(shader, pname, params) { \
-    glGetShaderiv_PACKED *packed_data = malloc(sizeof(glGetShaderiv_PACKED)); \
+    glGetShaderiv_PACKED packed_data[1]; \
     packed_data->format = glGetShaderiv_FORMAT; \
     packed_data->func = glshim_glGetShaderiv; \
     packed_data->args.a1 = (GLuint)shader; \
@@ -3433,7 +3434,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glGetString
 #define push_glGetString(name) { \
-    glGetString_PACKED *packed_data = malloc(sizeof(glGetString_PACKED)); \
+    glGetString_PACKED packed_data[1]; \
     packed_data->format = glGetString_FORMAT; \
     packed_data->func = glshim_glGetString; \
     packed_data->args.a1 = (GLenum)name; \
@@ -3442,7 +3443,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glGetTexParameterfv
 #define push_glGetTexParameterfv(target, pname, params) { \
-    glGetTexParameterfv_PACKED *packed_data = malloc(sizeof(glGetTexParameterfv_PACKED)); \
+    glGetTexParameterfv_PACKED packed_data[1]; \
     packed_data->format = glGetTexParameterfv_FORMAT; \
     packed_data->func = glshim_glGetTexParameterfv; \
     packed_data->args.a1 = (GLenum)target; \
@@ -3453,7 +3454,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glGetTexParameteriv
 #define push_glGetTexParameteriv(target, pname, params) { \
-    glGetTexParameteriv_PACKED *packed_data = malloc(sizeof(glGetTexParameteriv_PACKED)); \
+    glGetTexParameteriv_PACKED packed_data[1]; \
     packed_data->format = glGetTexParameteriv_FORMAT; \
     packed_data->func = glshim_glGetTexParameteriv; \
     packed_data->args.a1 = (GLenum)target; \
@@ -3464,7 +3465,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glGetUniformLocation
 #define push_glGetUniformLocation(program, name) { \
-    glGetUniformLocation_PACKED *packed_data = malloc(sizeof(glGetUniformLocation_PACKED)); \
+    glGetUniformLocation_PACKED packed_data[1]; \
     packed_data->format = glGetUniformLocation_FORMAT; \
     packed_data->func = glshim_glGetUniformLocation; \
     packed_data->args.a1 = (GLuint)program; \
@@ -3474,7 +3475,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glGetUniformfv
 #define push_glGetUniformfv(program, location, params) { \
-    glGetUniformfv_PACKED *packed_data = malloc(sizeof(glGetUniformfv_PACKED)); \
+    glGetUniformfv_PACKED packed_data[1]; \
     packed_data->format = glGetUniformfv_FORMAT; \
     packed_data->func = glshim_glGetUniformfv; \
     packed_data->args.a1 = (GLuint)program; \
@@ -3485,7 +3486,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glGetUniformiv
 #define push_glGetUniformiv(program, location, params) { \
-    glGetUniformiv_PACKED *packed_data = malloc(sizeof(glGetUniformiv_PACKED)); \
+    glGetUniformiv_PACKED packed_data[1]; \
     packed_data->format = glGetUniformiv_FORMAT; \
     packed_data->func = glshim_glGetUniformiv; \
     packed_data->args.a1 = (GLuint)program; \
@@ -3496,7 +3497,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glGetVertexAttribPointerv
 #define push_glGetVertexAttribPointerv(index, pname, pointer) { \
-    glGetVertexAttribPointerv_PACKED *packed_data = malloc(sizeof(glGetVertexAttribPointerv_PACKED)); \
+    glGetVertexAttribPointerv_PACKED packed_data[1]; \
     packed_data->format = glGetVertexAttribPointerv_FORMAT; \
     packed_data->func = glshim_glGetVertexAttribPointerv; \
     packed_data->args.a1 = (GLuint)index; \
@@ -3507,7 +3508,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glGetVertexAttribfv
 #define push_glGetVertexAttribfv(index, pname, params) { \
-    glGetVertexAttribfv_PACKED *packed_data = malloc(sizeof(glGetVertexAttribfv_PACKED)); \
+    glGetVertexAttribfv_PACKED packed_data[1]; \
     packed_data->format = glGetVertexAttribfv_FORMAT; \
     packed_data->func = glshim_glGetVertexAttribfv; \
     packed_data->args.a1 = (GLuint)index; \
@@ -3518,7 +3519,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glGetVertexAttribiv
 #define push_glGetVertexAttribiv(index, pname, params) { \
-    glGetVertexAttribiv_PACKED *packed_data = malloc(sizeof(glGetVertexAttribiv_PACKED)); \
+    glGetVertexAttribiv_PACKED packed_data[1]; \
     packed_data->format = glGetVertexAttribiv_FORMAT; \
     packed_data->func = glshim_glGetVertexAttribiv; \
     packed_data->args.a1 = (GLuint)index; \
@@ -3529,7 +3530,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glHint
 #define push_glHint(target, mode) { \
-    glHint_PACKED *packed_data = malloc(sizeof(glHint_PACKED)); \
+    glHint_PACKED packed_data[1]; \
     packed_data->format = glHint_FORMAT; \
     packed_data->func = glshim_glHint; \
     packed_data->args.a1 = (GLenum)target; \
@@ -3539,7 +3540,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glIsBuffer
 #define push_glIsBuffer(buffer) { \
-    glIsBuffer_PACKED *packed_data = malloc(sizeof(glIsBuffer_PACKED)); \
+    glIsBuffer_PACKED packed_data[1]; \
     packed_data->format = glIsBuffer_FORMAT; \
     packed_data->func = glshim_glIsBuffer; \
     packed_data->args.a1 = (GLuint)buffer; \
@@ -3548,7 +3549,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glIsEnabled
 #define push_glIsEnabled(cap) { \
-    glIsEnabled_PACKED *packed_data = malloc(sizeof(glIsEnabled_PACKED)); \
+    glIsEnabled_PACKED packed_data[1]; \
     packed_data->format = glIsEnabled_FORMAT; \
     packed_data->func = glshim_glIsEnabled; \
     packed_data->args.a1 = (GLenum)cap; \
@@ -3557,7 +3558,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glIsFramebuffer
 #define push_glIsFramebuffer(framebuffer) { \
-    glIsFramebuffer_PACKED *packed_data = malloc(sizeof(glIsFramebuffer_PACKED)); \
+    glIsFramebuffer_PACKED packed_data[1]; \
     packed_data->format = glIsFramebuffer_FORMAT; \
     packed_data->func = glshim_glIsFramebuffer; \
     packed_data->args.a1 = (GLuint)framebuffer; \
@@ -3566,7 +3567,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glIsProgram
 #define push_glIsProgram(program) { \
-    glIsProgram_PACKED *packed_data = malloc(sizeof(glIsProgram_PACKED)); \
+    glIsProgram_PACKED packed_data[1]; \
     packed_data->format = glIsProgram_FORMAT; \
     packed_data->func = glshim_glIsProgram; \
     packed_data->args.a1 = (GLuint)program; \
@@ -3575,7 +3576,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glIsRenderbuffer
 #define push_glIsRenderbuffer(renderbuffer) { \
-    glIsRenderbuffer_PACKED *packed_data = malloc(sizeof(glIsRenderbuffer_PACKED)); \
+    glIsRenderbuffer_PACKED packed_data[1]; \
     packed_data->format = glIsRenderbuffer_FORMAT; \
     packed_data->func = glshim_glIsRenderbuffer; \
     packed_data->args.a1 = (GLuint)renderbuffer; \
@@ -3584,7 +3585,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glIsShader
 #define push_glIsShader(shader) { \
-    glIsShader_PACKED *packed_data = malloc(sizeof(glIsShader_PACKED)); \
+    glIsShader_PACKED packed_data[1]; \
     packed_data->format = glIsShader_FORMAT; \
     packed_data->func = glshim_glIsShader; \
     packed_data->args.a1 = (GLuint)shader; \
@@ -3593,7 +3594,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glIsTexture
 #define push_glIsTexture(texture) { \
-    glIsTexture_PACKED *packed_data = malloc(sizeof(glIsTexture_PACKED)); \
+    glIsTexture_PACKED packed_data[1]; \
     packed_data->format = glIsTexture_FORMAT; \
     packed_data->func = glshim_glIsTexture; \
     packed_data->args.a1 = (GLuint)texture; \
@@ -3602,7 +3603,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glLineWidth
 #define push_glLineWidth(width) { \
-    glLineWidth_PACKED *packed_data = malloc(sizeof(glLineWidth_PACKED)); \
+    glLineWidth_PACKED packed_data[1]; \
     packed_data->format = glLineWidth_FORMAT; \
     packed_data->func = glshim_glLineWidth; \
     packed_data->args.a1 = (GLfloat)width; \
@@ -3611,7 +3612,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glLinkProgram
 #define push_glLinkProgram(program) { \
-    glLinkProgram_PACKED *packed_data = malloc(sizeof(glLinkProgram_PACKED)); \
+    glLinkProgram_PACKED packed_data[1]; \
     packed_data->format = glLinkProgram_FORMAT; \
     packed_data->func = glshim_glLinkProgram; \
     packed_data->args.a1 = (GLuint)program; \
@@ -3620,7 +3621,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glPixelStorei
 #define push_glPixelStorei(pname, param) { \
-    glPixelStorei_PACKED *packed_data = malloc(sizeof(glPixelStorei_PACKED)); \
+    glPixelStorei_PACKED packed_data[1]; \
     packed_data->format = glPixelStorei_FORMAT; \
     packed_data->func = glshim_glPixelStorei; \
     packed_data->args.a1 = (GLenum)pname; \
@@ -3630,7 +3631,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glPolygonOffset
 #define push_glPolygonOffset(factor, units) { \
-    glPolygonOffset_PACKED *packed_data = malloc(sizeof(glPolygonOffset_PACKED)); \
+    glPolygonOffset_PACKED packed_data[1]; \
     packed_data->format = glPolygonOffset_FORMAT; \
     packed_data->func = glshim_glPolygonOffset; \
     packed_data->args.a1 = (GLfloat)factor; \
@@ -3640,7 +3641,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glReadPixels
 #define push_glReadPixels(x, y, width, height, format, type, pixels) { \
-    glReadPixels_PACKED *packed_data = malloc(sizeof(glReadPixels_PACKED)); \
+    glReadPixels_PACKED packed_data[1]; \
     packed_data->format = glReadPixels_FORMAT; \
     packed_data->func = glshim_glReadPixels; \
     packed_data->args.a1 = (GLint)x; \
@@ -3655,7 +3656,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glReleaseShaderCompiler
 #define push_glReleaseShaderCompiler() { \
-    glReleaseShaderCompiler_PACKED *packed_data = malloc(sizeof(glReleaseShaderCompiler_PACKED)); \
+    glReleaseShaderCompiler_PACKED packed_data[1]; \
     packed_data->format = glReleaseShaderCompiler_FORMAT; \
     packed_data->func = glshim_glReleaseShaderCompiler; \
     glPushCall((void *)packed_data); \
@@ -3663,7 +3664,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glRenderbufferStorage
 #define push_glRenderbufferStorage(target, internalformat, width, height) { \
-    glRenderbufferStorage_PACKED *packed_data = malloc(sizeof(glRenderbufferStorage_PACKED)); \
+    glRenderbufferStorage_PACKED packed_data[1]; \
     packed_data->format = glRenderbufferStorage_FORMAT; \
     packed_data->func = glshim_glRenderbufferStorage; \
     packed_data->args.a1 = (GLenum)target; \
@@ -3675,7 +3676,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glSampleCoverage
 #define push_glSampleCoverage(value, invert) { \
-    glSampleCoverage_PACKED *packed_data = malloc(sizeof(glSampleCoverage_PACKED)); \
+    glSampleCoverage_PACKED packed_data[1]; \
     packed_data->format = glSampleCoverage_FORMAT; \
     packed_data->func = glshim_glSampleCoverage; \
     packed_data->args.a1 = (GLclampf)value; \
@@ -3685,7 +3686,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glScissor
 #define push_glScissor(x, y, width, height) { \
-    glScissor_PACKED *packed_data = malloc(sizeof(glScissor_PACKED)); \
+    glScissor_PACKED packed_data[1]; \
     packed_data->format = glScissor_FORMAT; \
     packed_data->func = glshim_glScissor; \
     packed_data->args.a1 = (GLint)x; \
@@ -3697,7 +3698,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glShaderBinary
 #define push_glShaderBinary(n, shaders, binaryformat, binary, length) { \
-    glShaderBinary_PACKED *packed_data = malloc(sizeof(glShaderBinary_PACKED)); \
+    glShaderBinary_PACKED packed_data[1]; \
     packed_data->format = glShaderBinary_FORMAT; \
     packed_data->func = glshim_glShaderBinary; \
     packed_data->args.a1 = (GLsizei)n; \
@@ -3710,7 +3711,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glShaderSource
 #define push_glShaderSource(shader, count, string, length) { \
-    glShaderSource_PACKED *packed_data = malloc(sizeof(glShaderSource_PACKED)); \
+    glShaderSource_PACKED packed_data[1]; \
     packed_data->format = glShaderSource_FORMAT; \
     packed_data->func = glshim_glShaderSource; \
     packed_data->args.a1 = (GLuint)shader; \
@@ -3722,7 +3723,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glStencilFunc
 #define push_glStencilFunc(func, ref, mask) { \
-    glStencilFunc_PACKED *packed_data = malloc(sizeof(glStencilFunc_PACKED)); \
+    glStencilFunc_PACKED packed_data[1]; \
     packed_data->format = glStencilFunc_FORMAT; \
     packed_data->func = glshim_glStencilFunc; \
     packed_data->args.a1 = (GLenum)func; \
@@ -3733,7 +3734,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glStencilFuncSeparate
 #define push_glStencilFuncSeparate(face, func, ref, mask) { \
-    glStencilFuncSeparate_PACKED *packed_data = malloc(sizeof(glStencilFuncSeparate_PACKED)); \
+    glStencilFuncSeparate_PACKED packed_data[1]; \
     packed_data->format = glStencilFuncSeparate_FORMAT; \
     packed_data->func = glshim_glStencilFuncSeparate; \
     packed_data->args.a1 = (GLenum)face; \
@@ -3745,7 +3746,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glStencilMask
 #define push_glStencilMask(mask) { \
-    glStencilMask_PACKED *packed_data = malloc(sizeof(glStencilMask_PACKED)); \
+    glStencilMask_PACKED packed_data[1]; \
     packed_data->format = glStencilMask_FORMAT; \
     packed_data->func = glshim_glStencilMask; \
     packed_data->args.a1 = (GLuint)mask; \
@@ -3754,7 +3755,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glStencilMaskSeparate
 #define push_glStencilMaskSeparate(face, mask) { \
-    glStencilMaskSeparate_PACKED *packed_data = malloc(sizeof(glStencilMaskSeparate_PACKED)); \
+    glStencilMaskSeparate_PACKED packed_data[1]; \
     packed_data->format = glStencilMaskSeparate_FORMAT; \
     packed_data->func = glshim_glStencilMaskSeparate; \
     packed_data->args.a1 = (GLenum)face; \
@@ -3764,7 +3765,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glStencilOp
 #define push_glStencilOp(fail, zfail, zpass) { \
-    glStencilOp_PACKED *packed_data = malloc(sizeof(glStencilOp_PACKED)); \
+    glStencilOp_PACKED packed_data[1]; \
     packed_data->format = glStencilOp_FORMAT; \
     packed_data->func = glshim_glStencilOp; \
     packed_data->args.a1 = (GLenum)fail; \
@@ -3775,7 +3776,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glStencilOpSeparate
 #define push_glStencilOpSeparate(face, sfail, zfail, zpass) { \
-    glStencilOpSeparate_PACKED *packed_data = malloc(sizeof(glStencilOpSeparate_PACKED)); \
+    glStencilOpSeparate_PACKED packed_data[1]; \
     packed_data->format = glStencilOpSeparate_FORMAT; \
     packed_data->func = glshim_glStencilOpSeparate; \
     packed_data->args.a1 = (GLenum)face; \
@@ -3787,7 +3788,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glTexImage2D
 #define push_glTexImage2D(target, level, internalformat, width, height, border, format, type, pixels) { \
-    glTexImage2D_PACKED *packed_data = malloc(sizeof(glTexImage2D_PACKED)); \
+    glTexImage2D_PACKED packed_data[1]; \
     packed_data->format = glTexImage2D_FORMAT; \
     packed_data->func = glshim_glTexImage2D; \
     packed_data->args.a1 = (GLenum)target; \
@@ -3804,7 +3805,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glTexParameterf
 #define push_glTexParameterf(target, pname, param) { \
-    glTexParameterf_PACKED *packed_data = malloc(sizeof(glTexParameterf_PACKED)); \
+    glTexParameterf_PACKED packed_data[1]; \
     packed_data->format = glTexParameterf_FORMAT; \
     packed_data->func = glshim_glTexParameterf; \
     packed_data->args.a1 = (GLenum)target; \
@@ -3815,7 +3816,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glTexParameterfv
 #define push_glTexParameterfv(target, pname, params) { \
-    glTexParameterfv_PACKED *packed_data = malloc(sizeof(glTexParameterfv_PACKED)); \
+    glTexParameterfv_PACKED packed_data[1]; \
     packed_data->format = glTexParameterfv_FORMAT; \
     packed_data->func = glshim_glTexParameterfv; \
     packed_data->args.a1 = (GLenum)target; \
@@ -3826,7 +3827,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glTexParameteri
 #define push_glTexParameteri(target, pname, param) { \
-    glTexParameteri_PACKED *packed_data = malloc(sizeof(glTexParameteri_PACKED)); \
+    glTexParameteri_PACKED packed_data[1]; \
     packed_data->format = glTexParameteri_FORMAT; \
     packed_data->func = glshim_glTexParameteri; \
     packed_data->args.a1 = (GLenum)target; \
@@ -3837,7 +3838,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glTexParameteriv
 #define push_glTexParameteriv(target, pname, params) { \
-    glTexParameteriv_PACKED *packed_data = malloc(sizeof(glTexParameteriv_PACKED)); \
+    glTexParameteriv_PACKED packed_data[1]; \
     packed_data->format = glTexParameteriv_FORMAT; \
     packed_data->func = glshim_glTexParameteriv; \
     packed_data->args.a1 = (GLenum)target; \
@@ -3848,7 +3849,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glTexSubImage2D
 #define push_glTexSubImage2D(target, level, xoffset, yoffset, width, height, format, type, pixels) { \
-    glTexSubImage2D_PACKED *packed_data = malloc(sizeof(glTexSubImage2D_PACKED)); \
+    glTexSubImage2D_PACKED packed_data[1]; \
     packed_data->format = glTexSubImage2D_FORMAT; \
     packed_data->func = glshim_glTexSubImage2D; \
     packed_data->args.a1 = (GLenum)target; \
@@ -3865,7 +3866,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glUniform1f
 #define push_glUniform1f(location, v0) { \
-    glUniform1f_PACKED *packed_data = malloc(sizeof(glUniform1f_PACKED)); \
+    glUniform1f_PACKED packed_data[1]; \
     packed_data->format = glUniform1f_FORMAT; \
     packed_data->func = glshim_glUniform1f; \
     packed_data->args.a1 = (GLint)location; \
@@ -3875,7 +3876,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glUniform1fv
 #define push_glUniform1fv(location, count, value) { \
-    glUniform1fv_PACKED *packed_data = malloc(sizeof(glUniform1fv_PACKED)); \
+    glUniform1fv_PACKED packed_data[1]; \
     packed_data->format = glUniform1fv_FORMAT; \
     packed_data->func = glshim_glUniform1fv; \
     packed_data->args.a1 = (GLint)location; \
@@ -3886,7 +3887,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glUniform1i
 #define push_glUniform1i(location, v0) { \
-    glUniform1i_PACKED *packed_data = malloc(sizeof(glUniform1i_PACKED)); \
+    glUniform1i_PACKED packed_data[1]; \
     packed_data->format = glUniform1i_FORMAT; \
     packed_data->func = glshim_glUniform1i; \
     packed_data->args.a1 = (GLint)location; \
@@ -3896,7 +3897,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glUniform1iv
 #define push_glUniform1iv(location, count, value) { \
-    glUniform1iv_PACKED *packed_data = malloc(sizeof(glUniform1iv_PACKED)); \
+    glUniform1iv_PACKED packed_data[1]; \
     packed_data->format = glUniform1iv_FORMAT; \
     packed_data->func = glshim_glUniform1iv; \
     packed_data->args.a1 = (GLint)location; \
@@ -3907,7 +3908,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glUniform2f
 #define push_glUniform2f(location, v0, v1) { \
-    glUniform2f_PACKED *packed_data = malloc(sizeof(glUniform2f_PACKED)); \
+    glUniform2f_PACKED packed_data[1]; \
     packed_data->format = glUniform2f_FORMAT; \
     packed_data->func = glshim_glUniform2f; \
     packed_data->args.a1 = (GLint)location; \
@@ -3918,7 +3919,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glUniform2fv
 #define push_glUniform2fv(location, count, value) { \
-    glUniform2fv_PACKED *packed_data = malloc(sizeof(glUniform2fv_PACKED)); \
+    glUniform2fv_PACKED packed_data[1]; \
     packed_data->format = glUniform2fv_FORMAT; \
     packed_data->func = glshim_glUniform2fv; \
     packed_data->args.a1 = (GLint)location; \
@@ -3929,7 +3930,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glUniform2i
 #define push_glUniform2i(location, v0, v1) { \
-    glUniform2i_PACKED *packed_data = malloc(sizeof(glUniform2i_PACKED)); \
+    glUniform2i_PACKED packed_data[1]; \
     packed_data->format = glUniform2i_FORMAT; \
     packed_data->func = glshim_glUniform2i; \
     packed_data->args.a1 = (GLint)location; \
@@ -3940,7 +3941,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glUniform2iv
 #define push_glUniform2iv(location, count, value) { \
-    glUniform2iv_PACKED *packed_data = malloc(sizeof(glUniform2iv_PACKED)); \
+    glUniform2iv_PACKED packed_data[1]; \
     packed_data->format = glUniform2iv_FORMAT; \
     packed_data->func = glshim_glUniform2iv; \
     packed_data->args.a1 = (GLint)location; \
@@ -3951,7 +3952,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glUniform3f
 #define push_glUniform3f(location, v0, v1, v2) { \
-    glUniform3f_PACKED *packed_data = malloc(sizeof(glUniform3f_PACKED)); \
+    glUniform3f_PACKED packed_data[1]; \
     packed_data->format = glUniform3f_FORMAT; \
     packed_data->func = glshim_glUniform3f; \
     packed_data->args.a1 = (GLint)location; \
@@ -3963,7 +3964,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glUniform3fv
 #define push_glUniform3fv(location, count, value) { \
-    glUniform3fv_PACKED *packed_data = malloc(sizeof(glUniform3fv_PACKED)); \
+    glUniform3fv_PACKED packed_data[1]; \
     packed_data->format = glUniform3fv_FORMAT; \
     packed_data->func = glshim_glUniform3fv; \
     packed_data->args.a1 = (GLint)location; \
@@ -3974,7 +3975,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glUniform3i
 #define push_glUniform3i(location, v0, v1, v2) { \
-    glUniform3i_PACKED *packed_data = malloc(sizeof(glUniform3i_PACKED)); \
+    glUniform3i_PACKED packed_data[1]; \
     packed_data->format = glUniform3i_FORMAT; \
     packed_data->func = glshim_glUniform3i; \
     packed_data->args.a1 = (GLint)location; \
@@ -3986,7 +3987,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glUniform3iv
 #define push_glUniform3iv(location, count, value) { \
-    glUniform3iv_PACKED *packed_data = malloc(sizeof(glUniform3iv_PACKED)); \
+    glUniform3iv_PACKED packed_data[1]; \
     packed_data->format = glUniform3iv_FORMAT; \
     packed_data->func = glshim_glUniform3iv; \
     packed_data->args.a1 = (GLint)location; \
@@ -3997,7 +3998,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glUniform4f
 #define push_glUniform4f(location, v0, v1, v2, v3) { \
-    glUniform4f_PACKED *packed_data = malloc(sizeof(glUniform4f_PACKED)); \
+    glUniform4f_PACKED packed_data[1]; \
     packed_data->format = glUniform4f_FORMAT; \
     packed_data->func = glshim_glUniform4f; \
     packed_data->args.a1 = (GLint)location; \
@@ -4010,7 +4011,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glUniform4fv
 #define push_glUniform4fv(location, count, value) { \
-    glUniform4fv_PACKED *packed_data = malloc(sizeof(glUniform4fv_PACKED)); \
+    glUniform4fv_PACKED packed_data[1]; \
     packed_data->format = glUniform4fv_FORMAT; \
     packed_data->func = glshim_glUniform4fv; \
     packed_data->args.a1 = (GLint)location; \
@@ -4021,7 +4022,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glUniform4i
 #define push_glUniform4i(location, v0, v1, v2, v3) { \
-    glUniform4i_PACKED *packed_data = malloc(sizeof(glUniform4i_PACKED)); \
+    glUniform4i_PACKED packed_data[1]; \
     packed_data->format = glUniform4i_FORMAT; \
     packed_data->func = glshim_glUniform4i; \
     packed_data->args.a1 = (GLint)location; \
@@ -4034,7 +4035,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glUniform4iv
 #define push_glUniform4iv(location, count, value) { \
-    glUniform4iv_PACKED *packed_data = malloc(sizeof(glUniform4iv_PACKED)); \
+    glUniform4iv_PACKED packed_data[1]; \
     packed_data->format = glUniform4iv_FORMAT; \
     packed_data->func = glshim_glUniform4iv; \
     packed_data->args.a1 = (GLint)location; \
@@ -4045,7 +4046,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glUniformMatrix2fv
 #define push_glUniformMatrix2fv(location, count, transpose, value) { \
-    glUniformMatrix2fv_PACKED *packed_data = malloc(sizeof(glUniformMatrix2fv_PACKED)); \
+    glUniformMatrix2fv_PACKED packed_data[1]; \
     packed_data->format = glUniformMatrix2fv_FORMAT; \
     packed_data->func = glshim_glUniformMatrix2fv; \
     packed_data->args.a1 = (GLint)location; \
@@ -4057,7 +4058,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glUniformMatrix3fv
 #define push_glUniformMatrix3fv(location, count, transpose, value) { \
-    glUniformMatrix3fv_PACKED *packed_data = malloc(sizeof(glUniformMatrix3fv_PACKED)); \
+    glUniformMatrix3fv_PACKED packed_data[1]; \
     packed_data->format = glUniformMatrix3fv_FORMAT; \
     packed_data->func = glshim_glUniformMatrix3fv; \
     packed_data->args.a1 = (GLint)location; \
@@ -4069,7 +4070,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glUniformMatrix4fv
 #define push_glUniformMatrix4fv(location, count, transpose, value) { \
-    glUniformMatrix4fv_PACKED *packed_data = malloc(sizeof(glUniformMatrix4fv_PACKED)); \
+    glUniformMatrix4fv_PACKED packed_data[1]; \
     packed_data->format = glUniformMatrix4fv_FORMAT; \
     packed_data->func = glshim_glUniformMatrix4fv; \
     packed_data->args.a1 = (GLint)location; \
@@ -4081,7 +4082,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glUseProgram
 #define push_glUseProgram(program) { \
-    glUseProgram_PACKED *packed_data = malloc(sizeof(glUseProgram_PACKED)); \
+    glUseProgram_PACKED packed_data[1]; \
     packed_data->format = glUseProgram_FORMAT; \
     packed_data->func = glshim_glUseProgram; \
     packed_data->args.a1 = (GLuint)program; \
@@ -4090,7 +4091,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glValidateProgram
 #define push_glValidateProgram(program) { \
-    glValidateProgram_PACKED *packed_data = malloc(sizeof(glValidateProgram_PACKED)); \
+    glValidateProgram_PACKED packed_data[1]; \
     packed_data->format = glValidateProgram_FORMAT; \
     packed_data->func = glshim_glValidateProgram; \
     packed_data->args.a1 = (GLuint)program; \
@@ -4099,7 +4100,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glVertexAttrib1f
 #define push_glVertexAttrib1f(index, x) { \
-    glVertexAttrib1f_PACKED *packed_data = malloc(sizeof(glVertexAttrib1f_PACKED)); \
+    glVertexAttrib1f_PACKED packed_data[1]; \
     packed_data->format = glVertexAttrib1f_FORMAT; \
     packed_data->func = glshim_glVertexAttrib1f; \
     packed_data->args.a1 = (GLuint)index; \
@@ -4109,7 +4110,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glVertexAttrib1fv
 #define push_glVertexAttrib1fv(index, v) { \
-    glVertexAttrib1fv_PACKED *packed_data = malloc(sizeof(glVertexAttrib1fv_PACKED)); \
+    glVertexAttrib1fv_PACKED packed_data[1]; \
     packed_data->format = glVertexAttrib1fv_FORMAT; \
     packed_data->func = glshim_glVertexAttrib1fv; \
     packed_data->args.a1 = (GLuint)index; \
@@ -4119,7 +4120,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glVertexAttrib2f
 #define push_glVertexAttrib2f(index, x, y) { \
-    glVertexAttrib2f_PACKED *packed_data = malloc(sizeof(glVertexAttrib2f_PACKED)); \
+    glVertexAttrib2f_PACKED packed_data[1]; \
     packed_data->format = glVertexAttrib2f_FORMAT; \
     packed_data->func = glshim_glVertexAttrib2f; \
     packed_data->args.a1 = (GLuint)index; \
@@ -4130,7 +4131,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glVertexAttrib2fv
 #define push_glVertexAttrib2fv(index, v) { \
-    glVertexAttrib2fv_PACKED *packed_data = malloc(sizeof(glVertexAttrib2fv_PACKED)); \
+    glVertexAttrib2fv_PACKED packed_data[1]; \
     packed_data->format = glVertexAttrib2fv_FORMAT; \
     packed_data->func = glshim_glVertexAttrib2fv; \
     packed_data->args.a1 = (GLuint)index; \
@@ -4140,7 +4141,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glVertexAttrib3f
 #define push_glVertexAttrib3f(index, x, y, z) { \
-    glVertexAttrib3f_PACKED *packed_data = malloc(sizeof(glVertexAttrib3f_PACKED)); \
+    glVertexAttrib3f_PACKED packed_data[1]; \
     packed_data->format = glVertexAttrib3f_FORMAT; \
     packed_data->func = glshim_glVertexAttrib3f; \
     packed_data->args.a1 = (GLuint)index; \
@@ -4152,7 +4153,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glVertexAttrib3fv
 #define push_glVertexAttrib3fv(index, v) { \
-    glVertexAttrib3fv_PACKED *packed_data = malloc(sizeof(glVertexAttrib3fv_PACKED)); \
+    glVertexAttrib3fv_PACKED packed_data[1]; \
     packed_data->format = glVertexAttrib3fv_FORMAT; \
     packed_data->func = glshim_glVertexAttrib3fv; \
     packed_data->args.a1 = (GLuint)index; \
@@ -4162,7 +4163,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glVertexAttrib4f
 #define push_glVertexAttrib4f(index, x, y, z, w) { \
-    glVertexAttrib4f_PACKED *packed_data = malloc(sizeof(glVertexAttrib4f_PACKED)); \
+    glVertexAttrib4f_PACKED packed_data[1]; \
     packed_data->format = glVertexAttrib4f_FORMAT; \
     packed_data->func = glshim_glVertexAttrib4f; \
     packed_data->args.a1 = (GLuint)index; \
@@ -4175,7 +4176,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glVertexAttrib4fv
 #define push_glVertexAttrib4fv(index, v) { \
-    glVertexAttrib4fv_PACKED *packed_data = malloc(sizeof(glVertexAttrib4fv_PACKED)); \
+    glVertexAttrib4fv_PACKED packed_data[1]; \
     packed_data->format = glVertexAttrib4fv_FORMAT; \
     packed_data->func = glshim_glVertexAttrib4fv; \
     packed_data->args.a1 = (GLuint)index; \
@@ -4185,7 +4186,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glVertexAttribPointer
 #define push_glVertexAttribPointer(index, size, type, normalized, stride, pointer) { \
-    glVertexAttribPointer_PACKED *packed_data = malloc(sizeof(glVertexAttribPointer_PACKED)); \
+    glVertexAttribPointer_PACKED packed_data[1]; \
     packed_data->format = glVertexAttribPointer_FORMAT; \
     packed_data->func = glshim_glVertexAttribPointer; \
     packed_data->args.a1 = (GLuint)index; \
@@ -4199,7 +4200,7 @@ typedef void (*glViewport_PTR)(glViewport_ARG_EXPAND);
 #endif
 #ifndef direct_glViewport
 #define push_glViewport(x, y, width, height) { \
-    glViewport_PACKED *packed_data = malloc(sizeof(glViewport_PACKED)); \
+    glViewport_PACKED packed_data[1]; \
     packed_data->format = glViewport_FORMAT; \
     packed_data->func = glshim_glViewport; \
     packed_data->args.a1 = (GLint)x; \
@@ -2,250 +2,275 @@
 #include "gles.h"
 #ifndef skip_glBindFramebuffer
 void glshim_glBindFramebuffer(GLenum target, GLuint framebuffer) {
-    LOAD_GLES_OES(glBindFramebuffer);
+    LOAD_GLES_OES_NOSYNC(glBindFramebuffer);
 #ifndef direct_glBindFramebuffer
     PUSH_IF_COMPILING(glBindFramebuffer)
 #endif
+    thread_sync();
     gles_glBindFramebuffer(target, framebuffer);
 }
 void glBindFramebuffer(GLenum target, GLuint framebuffer) __attribute__((alias("glshim_glBindFramebuffer"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glBindRenderbuffer
 void glshim_glBindRenderbuffer(GLenum target, GLuint renderbuffer) {
-    LOAD_GLES_OES(glBindRenderbuffer);
+    LOAD_GLES_OES_NOSYNC(glBindRenderbuffer);
 #ifndef direct_glBindRenderbuffer
     PUSH_IF_COMPILING(glBindRenderbuffer)
 #endif
+    thread_sync();
     gles_glBindRenderbuffer(target, renderbuffer);
 }
 void glBindRenderbuffer(GLenum target, GLuint renderbuffer) __attribute__((alias("glshim_glBindRenderbuffer"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glBlendColor
 void glshim_glBlendColor(GLclampf red, GLclampf green, GLclampf blue, GLclampf alpha) {
-    LOAD_GLES_OES(glBlendColor);
+    LOAD_GLES_OES_NOSYNC(glBlendColor);
 #ifndef direct_glBlendColor
     PUSH_IF_COMPILING(glBlendColor)
 #endif
+    thread_sync();
     gles_glBlendColor(red, green, blue, alpha);
 }
 void glBlendColor(GLclampf red, GLclampf green, GLclampf blue, GLclampf alpha) __attribute__((alias("glshim_glBlendColor"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glBlendEquation
 void glshim_glBlendEquation(GLenum mode) {
-    LOAD_GLES_OES(glBlendEquation);
+    LOAD_GLES_OES_NOSYNC(glBlendEquation);
 #ifndef direct_glBlendEquation
     PUSH_IF_COMPILING(glBlendEquation)
 #endif
+    thread_sync();
     gles_glBlendEquation(mode);
 }
 void glBlendEquation(GLenum mode) __attribute__((alias("glshim_glBlendEquation"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glBlendEquationSeparate
 void glshim_glBlendEquationSeparate(GLenum modeRGB, GLenum modeA) {
-    LOAD_GLES_OES(glBlendEquationSeparate);
+    LOAD_GLES_OES_NOSYNC(glBlendEquationSeparate);
 #ifndef direct_glBlendEquationSeparate
     PUSH_IF_COMPILING(glBlendEquationSeparate)
 #endif
+    thread_sync();
     gles_glBlendEquationSeparate(modeRGB, modeA);
 }
 void glBlendEquationSeparate(GLenum modeRGB, GLenum modeA) __attribute__((alias("glshim_glBlendEquationSeparate"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glBlendFuncSeparate
 void glshim_glBlendFuncSeparate(GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha) {
-    LOAD_GLES_OES(glBlendFuncSeparate);
+    LOAD_GLES_OES_NOSYNC(glBlendFuncSeparate);
 #ifndef direct_glBlendFuncSeparate
     PUSH_IF_COMPILING(glBlendFuncSeparate)
 #endif
+    thread_sync();
     gles_glBlendFuncSeparate(sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);
 }
 void glBlendFuncSeparate(GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha) __attribute__((alias("glshim_glBlendFuncSeparate"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glCheckFramebufferStatus
 GLenum glshim_glCheckFramebufferStatus(GLenum target) {
-    LOAD_GLES_OES(glCheckFramebufferStatus);
+    LOAD_GLES_OES_NOSYNC(glCheckFramebufferStatus);
 #ifndef direct_glCheckFramebufferStatus
     PUSH_IF_COMPILING(glCheckFramebufferStatus)
 #endif
+    thread_sync();
     return gles_glCheckFramebufferStatus(target);
 }
 GLenum glCheckFramebufferStatus(GLenum target) __attribute__((alias("glshim_glCheckFramebufferStatus"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glDeleteFramebuffers
 void glshim_glDeleteFramebuffers(GLsizei n, GLuint * framebuffers) {
-    LOAD_GLES_OES(glDeleteFramebuffers);
+    LOAD_GLES_OES_NOSYNC(glDeleteFramebuffers);
 #ifndef direct_glDeleteFramebuffers
     PUSH_IF_COMPILING(glDeleteFramebuffers)
 #endif
+    thread_sync();
     gles_glDeleteFramebuffers(n, framebuffers);
 }
 void glDeleteFramebuffers(GLsizei n, GLuint * framebuffers) __attribute__((alias("glshim_glDeleteFramebuffers"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glDeleteRenderbuffers
 void glshim_glDeleteRenderbuffers(GLsizei n, GLuint * renderbuffers) {
-    LOAD_GLES_OES(glDeleteRenderbuffers);
+    LOAD_GLES_OES_NOSYNC(glDeleteRenderbuffers);
 #ifndef direct_glDeleteRenderbuffers
     PUSH_IF_COMPILING(glDeleteRenderbuffers)
 #endif
+    thread_sync();
     gles_glDeleteRenderbuffers(n, renderbuffers);
 }
 void glDeleteRenderbuffers(GLsizei n, GLuint * renderbuffers) __attribute__((alias("glshim_glDeleteRenderbuffers"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glDrawTexf
 void glshim_glDrawTexf(GLfloat x, GLfloat y, GLfloat z, GLfloat width, GLfloat height) {
-    LOAD_GLES_OES(glDrawTexf);
+    LOAD_GLES_OES_NOSYNC(glDrawTexf);
 #ifndef direct_glDrawTexf
     PUSH_IF_COMPILING(glDrawTexf)
 #endif
+    thread_sync();
     gles_glDrawTexf(x, y, z, width, height);
 }
 void glDrawTexf(GLfloat x, GLfloat y, GLfloat z, GLfloat width, GLfloat height) __attribute__((alias("glshim_glDrawTexf"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glDrawTexi
 void glshim_glDrawTexi(GLint x, GLint y, GLint z, GLint width, GLint height) {
-    LOAD_GLES_OES(glDrawTexi);
+    LOAD_GLES_OES_NOSYNC(glDrawTexi);
 #ifndef direct_glDrawTexi
     PUSH_IF_COMPILING(glDrawTexi)
 #endif
+    thread_sync();
     gles_glDrawTexi(x, y, z, width, height);
 }
 void glDrawTexi(GLint x, GLint y, GLint z, GLint width, GLint height) __attribute__((alias("glshim_glDrawTexi"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glFramebufferRenderbuffer
 void glshim_glFramebufferRenderbuffer(GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer) {
-    LOAD_GLES_OES(glFramebufferRenderbuffer);
+    LOAD_GLES_OES_NOSYNC(glFramebufferRenderbuffer);
 #ifndef direct_glFramebufferRenderbuffer
     PUSH_IF_COMPILING(glFramebufferRenderbuffer)
 #endif
+    thread_sync();
     gles_glFramebufferRenderbuffer(target, attachment, renderbuffertarget, renderbuffer);
 }
 void glFramebufferRenderbuffer(GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer) __attribute__((alias("glshim_glFramebufferRenderbuffer"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glFramebufferTexture2D
 void glshim_glFramebufferTexture2D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) {
-    LOAD_GLES_OES(glFramebufferTexture2D);
+    LOAD_GLES_OES_NOSYNC(glFramebufferTexture2D);
 #ifndef direct_glFramebufferTexture2D
     PUSH_IF_COMPILING(glFramebufferTexture2D)
 #endif
+    thread_sync();
     gles_glFramebufferTexture2D(target, attachment, textarget, texture, level);
 }
 void glFramebufferTexture2D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) __attribute__((alias("glshim_glFramebufferTexture2D"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glGenFramebuffers
 void glshim_glGenFramebuffers(GLsizei n, GLuint * ids) {
-    LOAD_GLES_OES(glGenFramebuffers);
+    LOAD_GLES_OES_NOSYNC(glGenFramebuffers);
 #ifndef direct_glGenFramebuffers
     PUSH_IF_COMPILING(glGenFramebuffers)
 #endif
+    thread_sync();
     gles_glGenFramebuffers(n, ids);
 }
 void glGenFramebuffers(GLsizei n, GLuint * ids) __attribute__((alias("glshim_glGenFramebuffers"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glGenRenderbuffers
 void glshim_glGenRenderbuffers(GLsizei n, GLuint * renderbuffers) {
-    LOAD_GLES_OES(glGenRenderbuffers);
+    LOAD_GLES_OES_NOSYNC(glGenRenderbuffers);
 #ifndef direct_glGenRenderbuffers
     PUSH_IF_COMPILING(glGenRenderbuffers)
 #endif
+    thread_sync();
     gles_glGenRenderbuffers(n, renderbuffers);
 }
 void glGenRenderbuffers(GLsizei n, GLuint * renderbuffers) __attribute__((alias("glshim_glGenRenderbuffers"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glGenerateMipmap
 void glshim_glGenerateMipmap(GLenum target) {
-    LOAD_GLES_OES(glGenerateMipmap);
+    LOAD_GLES_OES_NOSYNC(glGenerateMipmap);
 #ifndef direct_glGenerateMipmap
     PUSH_IF_COMPILING(glGenerateMipmap)
 #endif
+    thread_sync();
     gles_glGenerateMipmap(target);
 }
 void glGenerateMipmap(GLenum target) __attribute__((alias("glshim_glGenerateMipmap"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glGetFramebufferAttachmentParameteriv
 void glshim_glGetFramebufferAttachmentParameteriv(GLenum target, GLenum attachment, GLenum pname, GLint * params) {
-    LOAD_GLES_OES(glGetFramebufferAttachmentParameteriv);
+    LOAD_GLES_OES_NOSYNC(glGetFramebufferAttachmentParameteriv);
 #ifndef direct_glGetFramebufferAttachmentParameteriv
     PUSH_IF_COMPILING(glGetFramebufferAttachmentParameteriv)
 #endif
+    thread_sync();
     gles_glGetFramebufferAttachmentParameteriv(target, attachment, pname, params);
 }
 void glGetFramebufferAttachmentParameteriv(GLenum target, GLenum attachment, GLenum pname, GLint * params) __attribute__((alias("glshim_glGetFramebufferAttachmentParameteriv"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glGetRenderbufferParameteriv
 void glshim_glGetRenderbufferParameteriv(GLenum target, GLenum pname, GLint * params) {
-    LOAD_GLES_OES(glGetRenderbufferParameteriv);
+    LOAD_GLES_OES_NOSYNC(glGetRenderbufferParameteriv);
 #ifndef direct_glGetRenderbufferParameteriv
     PUSH_IF_COMPILING(glGetRenderbufferParameteriv)
 #endif
+    thread_sync();
     gles_glGetRenderbufferParameteriv(target, pname, params);
 }
 void glGetRenderbufferParameteriv(GLenum target, GLenum pname, GLint * params) __attribute__((alias("glshim_glGetRenderbufferParameteriv"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glIsFramebuffer
 GLboolean glshim_glIsFramebuffer(GLuint framebuffer) {
-    LOAD_GLES_OES(glIsFramebuffer);
+    LOAD_GLES_OES_NOSYNC(glIsFramebuffer);
 #ifndef direct_glIsFramebuffer
     PUSH_IF_COMPILING(glIsFramebuffer)
 #endif
+    thread_sync();
     return gles_glIsFramebuffer(framebuffer);
 }
 GLboolean glIsFramebuffer(GLuint framebuffer) __attribute__((alias("glshim_glIsFramebuffer"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glIsRenderbuffer
 GLboolean glshim_glIsRenderbuffer(GLuint renderbuffer) {
-    LOAD_GLES_OES(glIsRenderbuffer);
+    LOAD_GLES_OES_NOSYNC(glIsRenderbuffer);
 #ifndef direct_glIsRenderbuffer
     PUSH_IF_COMPILING(glIsRenderbuffer)
 #endif
+    thread_sync();
     return gles_glIsRenderbuffer(renderbuffer);
 }
 GLboolean glIsRenderbuffer(GLuint renderbuffer) __attribute__((alias("glshim_glIsRenderbuffer"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glMultiDrawArrays
 void glshim_glMultiDrawArrays(GLenum mode, const GLint * first, const GLsizei * count, GLsizei primcount) {
-    LOAD_GLES_OES(glMultiDrawArrays);
+    LOAD_GLES_OES_NOSYNC(glMultiDrawArrays);
 #ifndef direct_glMultiDrawArrays
     PUSH_IF_COMPILING(glMultiDrawArrays)
 #endif
+    thread_sync();
     gles_glMultiDrawArrays(mode, first, count, primcount);
 }
 void glMultiDrawArrays(GLenum mode, const GLint * first, const GLsizei * count, GLsizei primcount) __attribute__((alias("glshim_glMultiDrawArrays"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glMultiDrawElements
 void glshim_glMultiDrawElements(GLenum mode, GLsizei * count, GLenum type, const void * const * indices, GLsizei primcount) {
-    LOAD_GLES_OES(glMultiDrawElements);
+    LOAD_GLES_OES_NOSYNC(glMultiDrawElements);
 #ifndef direct_glMultiDrawElements
     PUSH_IF_COMPILING(glMultiDrawElements)
 #endif
+    thread_sync();
     gles_glMultiDrawElements(mode, count, type, indices, primcount);
 }
 void glMultiDrawElements(GLenum mode, GLsizei * count, GLenum type, const void * const * indices, GLsizei primcount) __attribute__((alias("glshim_glMultiDrawElements"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glRenderbufferStorage
 void glshim_glRenderbufferStorage(GLenum target, GLenum internalformat, GLsizei width, GLsizei height) {
-    LOAD_GLES_OES(glRenderbufferStorage);
+    LOAD_GLES_OES_NOSYNC(glRenderbufferStorage);
 #ifndef direct_glRenderbufferStorage
     PUSH_IF_COMPILING(glRenderbufferStorage)
 #endif
+    thread_sync();
     gles_glRenderbufferStorage(target, internalformat, width, height);
 }
 void glRenderbufferStorage(GLenum target, GLenum internalformat, GLsizei width, GLsizei height) __attribute__((alias("glshim_glRenderbufferStorage"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glTexGenfv
 void glshim_glTexGenfv(GLenum coord, GLenum pname, const GLfloat * params) {
-    LOAD_GLES_OES(glTexGenfv);
+    LOAD_GLES_OES_NOSYNC(glTexGenfv);
 #ifndef direct_glTexGenfv
     PUSH_IF_COMPILING(glTexGenfv)
 #endif
+    thread_sync();
     gles_glTexGenfv(coord, pname, params);
 }
 void glTexGenfv(GLenum coord, GLenum pname, const GLfloat * params) __attribute__((alias("glshim_glTexGenfv"))) __attribute__((visibility("default")));
 #endif
 #ifndef skip_glTexGeni
 void glshim_glTexGeni(GLenum coord, GLenum pname, GLint param) {
-    LOAD_GLES_OES(glTexGeni);
+    LOAD_GLES_OES_NOSYNC(glTexGeni);
 #ifndef direct_glTexGeni
     PUSH_IF_COMPILING(glTexGeni)
 #endif
+    thread_sync();
     gles_glTexGeni(coord, pname, param);
 }
 void glTexGeni(GLenum coord, GLenum pname, GLint param) __attribute__((alias("glshim_glTexGeni"))) __attribute__((visibility("default")));
@@ -18,6 +18,8 @@
 
 #include "glx.h"
 #include "utils.h"
+#include "../gl/shadow.h"
+#include "../gl/thread.h"
 //#include <GLES/gl.h>
 #include "../gl/gl.h"
 #include "../glx/streaming.h"
@@ -175,8 +177,12 @@ static bool g_usefb = true;
 static bool g_usefbo = false;
 static bool g_xrefresh = false;
 static bool g_stacktrace = false;
+static bool g_swapthread = false;
 extern int automipmap;
 extern int texcopydata;
+extern int texcoalesce;
+extern char *texcache_dir;
+extern int texcache_max;
 extern int tested_env;
 extern int texshrink;
 extern int texdump;
@@ -356,6 +362,7 @@ static void scan_env() {
             g_usefbo = true;
     }
     env(LIBGL_FPS, g_showfps, "fps counter enabled");
+    env(LIBGL_SWAPTHREAD, g_swapthread, "buffer swap done in a separate thread");
 #ifdef USE_FBIO
     env(LIBGL_VSYNC, g_vsync, "vsync enabled");
     if (g_vsync) {
@@ -392,6 +399,20 @@ static void scan_env() {
         texcopydata = 1;
         SHUT(printf("LIBGL: Texture copy enabled\n"));
     }
+    char *env_texcoalesce = getenv("LIBGL_TEXCOALESCE");
+    if (env_texcoalesce && strcmp(env_texcoalesce, "1") == 0) {
+        texcoalesce = 1;
+        SHUT(printf("LIBGL: Coalescing of small texture updates enabled\n"));
+    }
+    char *env_texcache = getenv("LIBGL_TEXCACHE");
+    if (env_texcache && *env_texcache) {
+        texcache_dir = env_texcache;
+        SHUT(printf("LIBGL: Texture cache in %s\n", texcache_dir));
+        char *env_texcachesize = getenv("LIBGL_TEXCACHESIZE");
+        if (env_texcachesize && atoi(env_texcachesize) > 0)
+            texcache_max = atoi(env_texcachesize);
+        SHUT(printf("LIBGL: Texture cache limited to %d MB\n", texcache_max));
+    }
     char *env_shrink = getenv("LIBGL_SHRINK");
     if (env_shrink && strcmp(env_shrink, "1") == 0) {
         texshrink = 1;
@@ -656,6 +677,7 @@ EXPORT GLXContext glXCreateContextAttribsARB(Display *display, void *config,
 
 EXPORT void glXDestroyContext(Display *display, GLXContext ctx) {
 //printf("glXDestroyContext(%p, %p)\n", display, ctx);
+    thread_wait();
     if (g_usefb) {
         if (fbcontext_count==0)
             return; // Should not happens!
@@ -717,6 +739,7 @@ EXPORT Bool glXMakeCurrent(Display *display,
                     GLXDrawable drawable,
                     GLXContext context) {
 	Display *dpy;					
+    thread_wait();
     LOAD_EGL(eglCreateWindowSurface);
     LOAD_EGL(eglDestroySurface);
     LOAD_EGL(eglMakeCurrent);
@@ -744,6 +767,8 @@ EXPORT Bool glXMakeCurrent(Display *display,
 
     EGLBoolean result = egl_eglMakeCurrent(eglDisplay, eglSurface, eglSurface, eglContext);
     CheckEGLErrors();
+    // new context, nothing is known about its state
+    shadow_invalidate();
     if (result) {
         return true;
     }
@@ -755,15 +780,7 @@ EXPORT Bool glXMakeContextCurrent(Display *display, int drawable,
     return glXMakeCurrent(display, drawable, context);
 }
 
-EXPORT void glXSwapBuffers(Display *display,
-                    int drawable) {
-    static int frames = 0;
-    
-    LOAD_EGL(eglSwapBuffers);
-    int old_batch = glstate.gl_batch;
-    if (glstate.gl_batch || glstate.list.active){
-        flush();
-    }
+static void swap_vsync() {
 #ifdef USE_FBIO
     if (g_vsync && fbdev >= 0) {
         // TODO: can I just return if I don't meet vsync over multiple frames?
@@ -774,15 +791,53 @@ EXPORT void glXSwapBuffers(Display *display,
         }
     }
 #endif
-    if (g_usefbo) {
-        glstate.gl_batch = 0;
-        unbindMainFBO();
-        blitMainFBO();
-        // blit the main_fbo before swap
-    }
+}
 
+static void swap_bind(int current) {
+    // move the context between the application thread and the swap thread
+    LOAD_EGL(eglMakeCurrent);
+    if (current)
+        egl_eglMakeCurrent(eglDisplay, eglSurface, eglSurface, eglContext);
+    else
+        egl_eglMakeCurrent(eglDisplay, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+}
+
+static void swap_job(void *data) {
+    // runs on the swap thread
+    LOAD_EGL(eglSwapBuffers);
+    swap_vsync();
     egl_eglSwapBuffers(eglDisplay, eglSurface);
     CheckEGLErrors();
+}
+
+EXPORT void glXSwapBuffers(Display *display,
+                    int drawable) {
+    static int frames = 0;
+    
+    LOAD_EGL(eglSwapBuffers);
+    int old_batch = glstate.gl_batch;
+    if (glstate.gl_batch || glstate.list.active){
+        flush();
+        endframe_batch();
+    }
+    shadow_endframe();
+    endframe_lists();
+    if (g_swapthread && !g_usefbo) {
+        // the application goes on with its next frame while the swap waits for the GPU,
+        // until it needs GLES again
+        thread_submit(swap_job, NULL, swap_bind);
+    } else {
+        swap_vsync();
+        if (g_usefbo) {
+            glstate.gl_batch = 0;
+            unbindMainFBO();
+            blitMainFBO();
+            // blit the main_fbo before swap
+        }
+
+        egl_eglSwapBuffers(eglDisplay, eglSurface);
+        CheckEGLErrors();
+    }
 #ifdef PANDORA
     if (g_showfps || (sock>-1)) {
         // framerate counter
@@ -939,6 +994,7 @@ EXPORT void glXSwapIntervalMESA(int interval) {
     swap_interval = interval;
 #else
     LOAD_EGL(eglSwapInterval);
+    thread_wait();
     egl_eglSwapInterval(eglDisplay, swap_interval);
 #endif
 }
@@ -947,6 +1003,21 @@ EXPORT void glXSwapIntervalSGI(int interval) {
     glXSwapIntervalMESA(interval);
 }
 
+// batch mode counters for the application (get it with glXGetProcAddress): copies up to
+// count of frames, flushes, draws, vertices, merges, limited, draw_time and merge_time,
+// returns the number of counters copied
+EXPORT int glXGetBatchStatsGLSHIM(unsigned long *counters, int count) {
+    const unsigned long values[] = {batchstats.frames, batchstats.flushes, batchstats.draws, batchstats.vertices,
+        batchstats.merges, batchstats.limited, batchstats.draw_time, batchstats.merge_time};
+    int n = sizeof(values)/sizeof(values[0]);
+    if (!counters || count < 0)
+        return 0;
+    if (count < n)
+        n = count;
+    memcpy(counters, values, n*sizeof(unsigned long));
+    return n;
+}
+
 #ifndef ANDROID
 EXPORT void glXSwapIntervalEXT(Display *display, int drawable, int interval) {
     glXSwapIntervalMESA(interval);
@@ -211,6 +211,7 @@ void glXSwapIntervalEXT(Display *display, int drawable, int interval);
 #endif //ANDROID
 void glXSwapIntervalMESA(int interval);
 void glXSwapIntervalSGI(int interval);
+int glXGetBatchStatsGLSHIM(unsigned long *counters, int count);
 
 // GLX 1.1?
 #ifndef ANDROID
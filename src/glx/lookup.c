@@ -83,6 +83,7 @@ EXPORT void *glXGetProcAddressARB(const char *name) {
 #endif //ANDROID
     EX(glXSwapIntervalMESA);
     EX(glXSwapIntervalSGI);
+    EX(glXGetBatchStatsGLSHIM);
 #ifndef ANDROID
     EX(glXUseXFont);
     EX(glXWaitGL);